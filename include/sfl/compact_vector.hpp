@@ -30,21 +30,23 @@
 #include <sfl/detail/memory/destroy_a.hpp>
 #include <sfl/detail/memory/destroy_at_a.hpp>
 #include <sfl/detail/memory/destroy_n_a.hpp>
+#include <sfl/detail/memory/relocate_a.hpp>
 #include <sfl/detail/memory/to_address.hpp>
 #include <sfl/detail/memory/uninitialized_copy_a.hpp>
 #include <sfl/detail/memory/uninitialized_default_construct_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_fill_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_move_a.hpp>
-#include <sfl/detail/memory/uninitialized_move_if_noexcept_a.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
 #include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/growth_policy.hpp>
 #include <sfl/detail/normal_iterator.hpp>
 
 #include <algorithm>        // copy, move, swap, swap_ranges
+#include <exception>        // terminate
 #include <initializer_list> // initializer_list
 #include <iterator>         // distance, next, reverse_iterator
 #include <limits>           // numeric_limits
@@ -620,7 +622,7 @@ public:
 
             new_last = nullptr;
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -630,7 +632,7 @@ public:
 
             ++new_last;
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 pos.base(),
@@ -668,7 +670,7 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -813,7 +815,7 @@ public:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -821,7 +823,7 @@ public:
                 new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 last.base(),
@@ -848,10 +850,24 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
+            first.base()
+        );
+
+        sfl::dtl::destroy_a
+        (
+            data_.ref_to_alloc(),
+            first.base(),
+            last.base()
+        );
+
+        sfl::dtl::destroy_relocated_a
+        (
+            data_.ref_to_alloc(),
+            last.base(),
             data_.last_
         );
 
@@ -887,24 +903,31 @@ public:
         {
             if (n > size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // First we will construct new elements and after that
+                // we can relocate existing elements.
+
+                sfl::dtl::uninitialized_default_construct_n_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.last_,
-                    new_first
+                    new_first + size(),
+                    n - size()
                 );
 
-                new_last = sfl::dtl::uninitialized_default_construct_n_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    new_last,
-                    n - size()
+                    data_.first_,
+                    data_.last_,
+                    new_first
                 );
+
+                new_last += n - size();
             }
             else if (n < size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -915,12 +938,24 @@ public:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first + size(),
+                    new_first + n
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -932,12 +967,31 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
-        (
-            data_.ref_to_alloc(),
-            data_.first_,
-            data_.last_
-        );
+        if (n > size())
+        {
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.last_
+            );
+        }
+        else
+        {
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.first_ + n
+            );
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_ + n,
+                data_.last_
+            );
+        }
 
         sfl::dtl::deallocate
         (
@@ -969,25 +1023,32 @@ public:
         {
             if (n > size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // First we will construct new elements and after that
+                // we can relocate existing elements.
+
+                sfl::dtl::uninitialized_fill_n_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.last_,
-                    new_first
+                    new_first + size(),
+                    n - size(),
+                    value
                 );
 
-                new_last = sfl::dtl::uninitialized_fill_n_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    new_last,
-                    n - size(),
-                    value
+                    data_.first_,
+                    data_.last_,
+                    new_first
                 );
+
+                new_last += n - size();
             }
             else if (n < size())
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -998,12 +1059,24 @@ public:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first + size(),
+                    new_first + n
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -1015,12 +1088,31 @@ public:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
-        (
-            data_.ref_to_alloc(),
-            data_.first_,
-            data_.last_
-        );
+        if (n > size())
+        {
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.last_
+            );
+        }
+        else
+        {
+            sfl::dtl::destroy_relocated_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_,
+                data_.first_ + n
+            );
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                data_.first_ + n,
+                data_.last_
+            );
+        }
 
         sfl::dtl::deallocate
         (
@@ -1062,6 +1154,523 @@ public:
         swap(this->data_.last_,  other.data_.last_);
     }
 
+    //
+    // ---- BATCH EDITING -----------------------------------------------------
+    //
+
+    //
+    // Edit session takes the storage of the vector and works with it as
+    // with growable buffer, i.e. capacity grows geometrically and insertion
+    // and deletion do not reallocate storage. When the session ends, the
+    // storage is shrunk to exact size with at most one allocation and given
+    // back to the vector.
+    //
+    // Session ends when member function `commit` is called or when it is
+    // destroyed. Destructor cannot report allocation failure and elements
+    // cannot be given back to the vector while storage has extra capacity,
+    // so if the final allocation fails in destructor, `std::terminate` is
+    // called. Call `commit` explicitly to handle allocation failure.
+    //
+    // Vector must not be accessed directly while session is active.
+    //
+    class edit_session
+    {
+        friend class compact_vector;
+
+    private:
+
+        compact_vector* vec_;
+
+        pointer first_;
+        pointer last_;
+        pointer eos_;
+
+        explicit edit_session(compact_vector& vec) noexcept
+            : vec_(&vec)
+            , first_(vec.data_.first_)
+            , last_(vec.data_.last_)
+            , eos_(vec.data_.last_)
+        {
+            vec.data_.first_ = nullptr;
+            vec.data_.last_  = nullptr;
+        }
+
+    public:
+
+        edit_session(const edit_session&) = delete;
+
+        edit_session(edit_session&& other) noexcept
+            : vec_(other.vec_)
+            , first_(other.first_)
+            , last_(other.last_)
+            , eos_(other.eos_)
+        {
+            other.vec_   = nullptr;
+            other.first_ = nullptr;
+            other.last_  = nullptr;
+            other.eos_   = nullptr;
+        }
+
+        edit_session& operator=(const edit_session&) = delete;
+
+        edit_session& operator=(edit_session&&) = delete;
+
+        ~edit_session()
+        {
+            if (vec_ == nullptr)
+            {
+                return;
+            }
+
+            SFL_TRY
+            {
+                commit();
+            }
+            SFL_CATCH (...)
+            {
+                // Elements must not be lost and storage with extra capacity
+                // cannot be given back to the vector.
+                std::terminate();
+            }
+        }
+
+        //
+        // ---- SESSION -------------------------------------------------------
+        //
+
+        SFL_NODISCARD
+        bool active() const noexcept
+        {
+            return vec_ != nullptr;
+        }
+
+        // Shrinks storage to exact size and gives it back to the vector.
+        // If allocation fails, exception is thrown and session remains
+        // active (strong exception guarantee).
+        //
+        void commit()
+        {
+            SFL_ASSERT(active());
+
+            if (last_ != eos_)
+            {
+                const size_type n = size();
+
+                pointer new_first = nullptr;
+                pointer new_last  = nullptr;
+
+                if (n != 0)
+                {
+                    new_first = sfl::dtl::allocate(alloc(), n);
+
+                    SFL_TRY
+                    {
+                        new_last = sfl::dtl::uninitialized_relocate_a
+                        (
+                            alloc(),
+                            first_,
+                            last_,
+                            new_first
+                        );
+                    }
+                    SFL_CATCH (...)
+                    {
+                        sfl::dtl::deallocate(alloc(), new_first, n);
+                        SFL_RETHROW;
+                    }
+                }
+
+                sfl::dtl::destroy_relocated_a(alloc(), first_, last_);
+
+                sfl::dtl::deallocate(alloc(), first_, std::distance(first_, eos_));
+
+                first_ = new_first;
+                last_  = new_last;
+                eos_   = new_last;
+            }
+
+            vec_->data_.first_ = first_;
+            vec_->data_.last_  = last_;
+
+            vec_   = nullptr;
+            first_ = nullptr;
+            last_  = nullptr;
+            eos_   = nullptr;
+        }
+
+        //
+        // ---- ITERATORS -----------------------------------------------------
+        //
+
+        SFL_NODISCARD
+        iterator begin() noexcept
+        {
+            return iterator(first_);
+        }
+
+        SFL_NODISCARD
+        const_iterator begin() const noexcept
+        {
+            return const_iterator(first_);
+        }
+
+        SFL_NODISCARD
+        const_iterator cbegin() const noexcept
+        {
+            return const_iterator(first_);
+        }
+
+        SFL_NODISCARD
+        iterator end() noexcept
+        {
+            return iterator(last_);
+        }
+
+        SFL_NODISCARD
+        const_iterator end() const noexcept
+        {
+            return const_iterator(last_);
+        }
+
+        SFL_NODISCARD
+        const_iterator cend() const noexcept
+        {
+            return const_iterator(last_);
+        }
+
+        SFL_NODISCARD
+        iterator nth(size_type pos) noexcept
+        {
+            SFL_ASSERT(pos <= size());
+            return iterator(first_ + pos);
+        }
+
+        SFL_NODISCARD
+        const_iterator nth(size_type pos) const noexcept
+        {
+            SFL_ASSERT(pos <= size());
+            return const_iterator(first_ + pos);
+        }
+
+        //
+        // ---- SIZE AND CAPACITY ---------------------------------------------
+        //
+
+        SFL_NODISCARD
+        bool empty() const noexcept
+        {
+            return first_ == last_;
+        }
+
+        SFL_NODISCARD
+        size_type size() const noexcept
+        {
+            return std::distance(first_, last_);
+        }
+
+        SFL_NODISCARD
+        size_type capacity() const noexcept
+        {
+            return std::distance(first_, eos_);
+        }
+
+        void reserve(size_type new_cap)
+        {
+            SFL_ASSERT(active());
+
+            if (new_cap > capacity())
+            {
+                if (new_cap > vec_->max_size())
+                {
+                    sfl::dtl::throw_length_error("sfl::compact_vector::edit_session::reserve");
+                }
+
+                grow_storage(new_cap);
+            }
+        }
+
+        //
+        // ---- ELEMENT ACCESS ------------------------------------------------
+        //
+
+        SFL_NODISCARD
+        reference operator[](size_type pos) noexcept
+        {
+            SFL_ASSERT(pos < size());
+            return first_[pos];
+        }
+
+        SFL_NODISCARD
+        const_reference operator[](size_type pos) const noexcept
+        {
+            SFL_ASSERT(pos < size());
+            return first_[pos];
+        }
+
+        SFL_NODISCARD
+        reference front() noexcept
+        {
+            SFL_ASSERT(!empty());
+            return *first_;
+        }
+
+        SFL_NODISCARD
+        const_reference front() const noexcept
+        {
+            SFL_ASSERT(!empty());
+            return *first_;
+        }
+
+        SFL_NODISCARD
+        reference back() noexcept
+        {
+            SFL_ASSERT(!empty());
+            return *(last_ - 1);
+        }
+
+        SFL_NODISCARD
+        const_reference back() const noexcept
+        {
+            SFL_ASSERT(!empty());
+            return *(last_ - 1);
+        }
+
+        //
+        // ---- MODIFIERS -----------------------------------------------------
+        //
+
+        void clear() noexcept
+        {
+            sfl::dtl::destroy_a(alloc(), first_, last_);
+            last_ = first_;
+        }
+
+        template <typename... Args>
+        iterator emplace(const_iterator pos, Args&&... args)
+        {
+            SFL_ASSERT(active());
+            SFL_ASSERT(cbegin() <= pos && pos <= cend());
+
+            const difference_type offset = std::distance(cbegin(), pos);
+
+            if (pos == cend() && last_ != eos_)
+            {
+                sfl::dtl::construct_at_a
+                (
+                    alloc(),
+                    last_,
+                    std::forward<Args>(args)...
+                );
+
+                ++last_;
+            }
+            else
+            {
+                // The order of operations is critical. First we will
+                // construct temporary value because arguments `args...`
+                // can contain reference to element in this container and
+                // after that we will grow storage and insert new element.
+                value_type tmp(std::forward<Args>(args)...);
+
+                if (last_ == eos_)
+                {
+                    grow_storage(calculate_new_capacity(1));
+                }
+
+                const pointer p = first_ + offset;
+
+                if (p == last_)
+                {
+                    sfl::dtl::construct_at_a(alloc(), last_, std::move(tmp));
+                    ++last_;
+                }
+                else
+                {
+                    sfl::dtl::insert_shift_a(alloc(), p, last_, std::move(tmp));
+                }
+            }
+
+            return iterator(first_ + offset);
+        }
+
+        iterator insert(const_iterator pos, const T& value)
+        {
+            SFL_ASSERT(cbegin() <= pos && pos <= cend());
+            return emplace(pos, value);
+        }
+
+        iterator insert(const_iterator pos, T&& value)
+        {
+            SFL_ASSERT(cbegin() <= pos && pos <= cend());
+            return emplace(pos, std::move(value));
+        }
+
+        template <typename... Args>
+        reference emplace_back(Args&&... args)
+        {
+            return *emplace(cend(), std::forward<Args>(args)...);
+        }
+
+        void push_back(const T& value)
+        {
+            emplace(cend(), value);
+        }
+
+        void push_back(T&& value)
+        {
+            emplace(cend(), std::move(value));
+        }
+
+        void pop_back()
+        {
+            SFL_ASSERT(!empty());
+
+            --last_;
+
+            sfl::dtl::destroy_at_a(alloc(), last_);
+        }
+
+        iterator erase(const_iterator pos)
+        {
+            SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+            const pointer p = first_ + std::distance(cbegin(), pos);
+
+            last_ = sfl::dtl::erase_shift_a(alloc(), p, p + 1, last_);
+
+            return iterator(p);
+        }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+            const pointer p1 = first_ + std::distance(cbegin(), first);
+            const pointer p2 = first_ + std::distance(cbegin(), last);
+
+            if (p1 != p2)
+            {
+                last_ = sfl::dtl::erase_shift_a(alloc(), p1, p2, last_);
+            }
+
+            return iterator(p1);
+        }
+
+        void resize(size_type n)
+        {
+            SFL_ASSERT(active());
+
+            if (n < size())
+            {
+                const pointer new_last = first_ + n;
+                sfl::dtl::destroy_a(alloc(), new_last, last_);
+                last_ = new_last;
+            }
+            else
+            {
+                reserve(n);
+
+                last_ = sfl::dtl::uninitialized_default_construct_n_a
+                (
+                    alloc(),
+                    last_,
+                    n - size()
+                );
+            }
+        }
+
+        void resize(size_type n, const T& value)
+        {
+            SFL_ASSERT(active());
+
+            if (n < size())
+            {
+                const pointer new_last = first_ + n;
+                sfl::dtl::destroy_a(alloc(), new_last, last_);
+                last_ = new_last;
+            }
+            else if (n > size())
+            {
+                // `value` can refer to element in this container.
+                const value_type tmp(value);
+
+                reserve(n);
+
+                last_ = sfl::dtl::uninitialized_fill_n_a
+                (
+                    alloc(),
+                    last_,
+                    n - size(),
+                    tmp
+                );
+            }
+        }
+
+    private:
+
+        allocator_type& alloc() noexcept
+        {
+            return vec_->data_.ref_to_alloc();
+        }
+
+        size_type calculate_new_capacity(size_type num_additional_elements)
+        {
+            const size_type size = this->size();
+            const size_type max_size = vec_->max_size();
+
+            if (max_size - size < num_additional_elements)
+            {
+                sfl::dtl::throw_length_error("sfl::compact_vector::edit_session::calculate_new_capacity");
+            }
+
+            return sfl::growth_factor_1_5::template new_capacity<T>
+            (
+                capacity(),
+                size_type(size + num_additional_elements),
+                max_size
+            );
+        }
+
+        void grow_storage(size_type new_cap)
+        {
+            const pointer new_first = sfl::dtl::allocate(alloc(), new_cap);
+
+            pointer new_last = new_first;
+
+            SFL_TRY
+            {
+                new_last = sfl::dtl::uninitialized_relocate_a
+                (
+                    alloc(),
+                    first_,
+                    last_,
+                    new_first
+                );
+            }
+            SFL_CATCH (...)
+            {
+                sfl::dtl::deallocate(alloc(), new_first, new_cap);
+                SFL_RETHROW;
+            }
+
+            sfl::dtl::destroy_relocated_a(alloc(), first_, last_);
+
+            sfl::dtl::deallocate(alloc(), first_, std::distance(first_, eos_));
+
+            first_ = new_first;
+            last_  = new_last;
+            eos_   = new_first + new_cap;
+        }
+    };
+
+    // Starts batch editing. See `edit_session`.
+    //
+    SFL_NODISCARD
+    edit_session edit() noexcept
+    {
+        return edit_session(*this);
+    }
+
 private:
 
     void initialize_default_n(size_type n)
@@ -1523,7 +2132,7 @@ private:
 
             new_last = nullptr;
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1533,7 +2142,7 @@ private:
 
             new_last += n;
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 pos.base(),
@@ -1572,7 +2181,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -1635,23 +2244,30 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            // First we will copy new elements and after that we
+            // can relocate existing elements.
+
+            sfl::dtl::uninitialized_copy_a
             (
                 data_.ref_to_alloc(),
-                data_.first_,
-                pos.base(),
-                new_first
+                first,
+                last,
+                new_first + offset
             );
 
-            new_last = sfl::dtl::uninitialized_copy_a
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
-                first,
-                last,
-                new_last
+                data_.first_,
+                pos.base(),
+                new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last += new_size - size();
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 pos.base(),
@@ -1661,12 +2277,24 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_n_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first + offset,
+                    new_size - size()
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
@@ -1678,7 +2306,7 @@ private:
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
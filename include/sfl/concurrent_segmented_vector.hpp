@@ -0,0 +1,570 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_CONCURRENT_SEGMENTED_VECTOR_HPP_INCLUDED
+#define SFL_CONCURRENT_SEGMENTED_VECTOR_HPP_INCLUDED
+
+#include <sfl/detail/bit/bit_log2.hpp>
+#include <sfl/detail/memory/allocate.hpp>
+#include <sfl/detail/memory/construct_at_a.hpp>
+#include <sfl/detail/memory/deallocate.hpp>
+#include <sfl/detail/memory/destroy_at_a.hpp>
+#include <sfl/detail/allocator_traits.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+
+#include <algorithm>    // min
+#include <atomic>       // atomic, memory_order
+#include <cstddef>      // size_t
+#include <limits>       // numeric_limits
+#include <memory>       // allocator
+#include <type_traits>  // is_same, is_nothrow_xxxxx
+#include <utility>      // forward, move
+
+namespace sfl
+{
+
+template < typename T,
+           std::size_t N,
+           typename Allocator = std::allocator<T> >
+class concurrent_segmented_vector
+{
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using allocator_type  = Allocator;
+    using value_type      = T;
+    using size_type       = typename sfl::dtl::allocator_traits<allocator_type>::size_type;
+    using difference_type = typename sfl::dtl::allocator_traits<allocator_type>::difference_type;
+    using reference       = T&;
+    using const_reference = const T&;
+    using pointer         = typename sfl::dtl::allocator_traits<allocator_type>::pointer;
+    using const_pointer   = typename sfl::dtl::allocator_traits<allocator_type>::const_pointer;
+
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, value_type>::value,
+        "Allocator::value_type must be same as sfl::concurrent_segmented_vector::value_type."
+    );
+
+    static_assert
+    (
+        std::is_same<pointer, value_type*>::value,
+        "Allocator::pointer must be raw pointer because segment pointers are stored in std::atomic."
+    );
+
+public:
+
+    static constexpr size_type segment_capacity = N;
+
+private:
+
+    // State of each slot in segment.
+    enum : unsigned char
+    {
+        slot_empty     = 0, // Position is not claimed or element is under construction
+        slot_published = 1, // Element is constructed and visible to readers
+        slot_failed    = 2  // Constructor of element has thrown exception
+    };
+
+    struct segment
+    {
+        pointer elements_;
+        std::atomic<unsigned char> state_[N];
+    };
+
+    using segment_allocator = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<segment>;
+
+    using entry_type = std::atomic<segment*>;
+
+    using entry_allocator = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<entry_type>;
+
+    //
+    // Segment pointers are stored in blocks of entries. Block `b` has
+    // `2^b` entries, so blocks are never reallocated and the number of
+    // blocks is bounded by the number of bits in `size_type`. Blocks and
+    // segments are allocated on demand and published with compare-and-swap.
+    // Thread that loses the race deallocates its own block or segment.
+    //
+
+    static constexpr std::size_t max_blocks = std::numeric_limits<size_type>::digits;
+
+    class data : public allocator_type
+    {
+    public:
+
+        std::atomic<entry_type*> blocks_[max_blocks];
+
+        std::atomic<size_type> size_; // Number of claimed positions
+
+        data() noexcept(std::is_nothrow_default_constructible<allocator_type>::value)
+            : allocator_type()
+        {
+            initialize();
+        }
+
+        data(const allocator_type& alloc) noexcept(std::is_nothrow_copy_constructible<allocator_type>::value)
+            : allocator_type(alloc)
+        {
+            initialize();
+        }
+
+        allocator_type& ref_to_alloc() noexcept
+        {
+            return *this;
+        }
+
+        const allocator_type& ref_to_alloc() const noexcept
+        {
+            return *this;
+        }
+
+    private:
+
+        void initialize() noexcept
+        {
+            for (std::size_t b = 0; b != max_blocks; ++b)
+            {
+                blocks_[b].store(nullptr, std::memory_order_relaxed);
+            }
+
+            size_.store(0, std::memory_order_relaxed);
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    concurrent_segmented_vector()
+        : data_()
+    {}
+
+    explicit concurrent_segmented_vector(const Allocator& alloc)
+        : data_(alloc)
+    {}
+
+    concurrent_segmented_vector(const concurrent_segmented_vector&) = delete;
+
+    concurrent_segmented_vector(concurrent_segmented_vector&&) = delete;
+
+    ~concurrent_segmented_vector()
+    {
+        clear();
+        deallocate_storage();
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    concurrent_segmented_vector& operator=(const concurrent_segmented_vector&) = delete;
+
+    concurrent_segmented_vector& operator=(concurrent_segmented_vector&&) = delete;
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return std::min(data_.size_.load(std::memory_order_acquire), max_size());
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>
+        (
+            sfl::dtl::allocator_traits<allocator_type>::max_size(data_.ref_to_alloc()),
+            std::numeric_limits<difference_type>::max() / sizeof(value_type)
+        );
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        size_type n = 0;
+
+        for (std::size_t b = 0; b != max_blocks; ++b)
+        {
+            const entry_type* block = data_.blocks_[b].load(std::memory_order_acquire);
+
+            // Block is missing if its allocation has failed. Later blocks
+            // can still exist.
+            if (block == nullptr)
+            {
+                continue;
+            }
+
+            for (size_type i = 0; i != block_size(b); ++i)
+            {
+                if (block[i].load(std::memory_order_acquire) != nullptr)
+                {
+                    n += N;
+                }
+            }
+        }
+
+        return n;
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > max_size())
+        {
+            sfl::dtl::throw_length_error("sfl::concurrent_segmented_vector::reserve");
+        }
+
+        const size_type num_segments = new_capacity / N + (new_capacity % N == 0 ? 0 : 1);
+
+        for (size_type s = 0; s != num_segments; ++s)
+        {
+            acquire_segment(s);
+        }
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool is_published(size_type pos) const noexcept
+    {
+        const segment* seg = find_segment(pos / N);
+
+        return seg != nullptr &&
+               seg->state_[pos % N].load(std::memory_order_acquire) == slot_published;
+    }
+
+    SFL_NODISCARD
+    reference at(size_type pos)
+    {
+        if (!is_published(pos))
+        {
+            sfl::dtl::throw_out_of_range("sfl::concurrent_segmented_vector::at");
+        }
+
+        return *element(pos);
+    }
+
+    SFL_NODISCARD
+    const_reference at(size_type pos) const
+    {
+        if (!is_published(pos))
+        {
+            sfl::dtl::throw_out_of_range("sfl::concurrent_segmented_vector::at");
+        }
+
+        return *element(pos);
+    }
+
+    SFL_NODISCARD
+    reference operator[](size_type pos) noexcept
+    {
+        SFL_ASSERT(is_published(pos));
+        return *element(pos);
+    }
+
+    SFL_NODISCARD
+    const_reference operator[](size_type pos) const noexcept
+    {
+        SFL_ASSERT(is_published(pos));
+        return *element(pos);
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        const size_type n = data_.size_.load(std::memory_order_acquire);
+
+        for (size_type pos = 0; pos != n; ++pos)
+        {
+            segment* seg = find_segment(pos / N);
+
+            if (seg == nullptr)
+            {
+                continue;
+            }
+
+            std::atomic<unsigned char>& state = seg->state_[pos % N];
+
+            if (state.load(std::memory_order_relaxed) == slot_published)
+            {
+                sfl::dtl::destroy_at_a(data_.ref_to_alloc(), seg->elements_ + pos % N);
+            }
+
+            state.store(slot_empty, std::memory_order_relaxed);
+        }
+
+        data_.size_.store(0, std::memory_order_release);
+    }
+
+    template <typename... Args>
+    size_type emplace_back(Args&&... args)
+    {
+        // Claim position. This never blocks and never retries.
+        const size_type pos = data_.size_.fetch_add(1, std::memory_order_relaxed);
+
+        if (pos >= max_size())
+        {
+            sfl::dtl::throw_length_error("sfl::concurrent_segmented_vector::emplace_back");
+        }
+
+        segment* seg = acquire_segment(pos / N);
+
+        std::atomic<unsigned char>& state = seg->state_[pos % N];
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at_a
+            (
+                data_.ref_to_alloc(),
+                seg->elements_ + pos % N,
+                std::forward<Args>(args)...
+            );
+        }
+        SFL_CATCH (...)
+        {
+            state.store(slot_failed, std::memory_order_release);
+            SFL_RETHROW;
+        }
+
+        // Publish element.
+        state.store(slot_published, std::memory_order_release);
+
+        return pos;
+    }
+
+    size_type push_back(const T& value)
+    {
+        return emplace_back(value);
+    }
+
+    size_type push_back(T&& value)
+    {
+        return emplace_back(std::move(value));
+    }
+
+private:
+
+    static constexpr size_type block_size(std::size_t b) noexcept
+    {
+        return size_type(1) << b;
+    }
+
+    // Calculates block and index within block of entry for segment `s`.
+    // Blocks 0, 1, 2, ... contain entries for segments [0, 1), [1, 3),
+    // [3, 7), ..., i.e. block `b` starts at segment `2^b - 1`.
+    //
+    static void locate(size_type s, std::size_t& b, size_type& i) noexcept
+    {
+        b = std::size_t(sfl::dtl::bit_log2(s + 1));
+        i = s + 1 - block_size(b);
+    }
+
+    pointer element(size_type pos) const noexcept
+    {
+        return find_segment(pos / N)->elements_ + pos % N;
+    }
+
+    // Returns pointer to segment `s` or null if segment is not allocated.
+    //
+    segment* find_segment(size_type s) const noexcept
+    {
+        std::size_t b;
+        size_type i;
+
+        locate(s, b, i);
+
+        const entry_type* block = data_.blocks_[b].load(std::memory_order_acquire);
+
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+
+        return block[i].load(std::memory_order_acquire);
+    }
+
+    // Returns pointer to segment `s`. Allocates block and segment if
+    // neccessary.
+    //
+    segment* acquire_segment(size_type s)
+    {
+        std::size_t b;
+        size_type i;
+
+        locate(s, b, i);
+
+        entry_type* block = data_.blocks_[b].load(std::memory_order_acquire);
+
+        if (block == nullptr)
+        {
+            entry_type* new_block = allocate_block(b);
+
+            if (data_.blocks_[b].compare_exchange_strong(block, new_block, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                block = new_block;
+            }
+            else
+            {
+                // Other thread has published block. It is loaded into `block`.
+                deallocate_block(new_block, b);
+            }
+        }
+
+        segment* seg = block[i].load(std::memory_order_acquire);
+
+        if (seg == nullptr)
+        {
+            segment* new_seg = allocate_segment();
+
+            if (block[i].compare_exchange_strong(seg, new_seg, std::memory_order_acq_rel, std::memory_order_acquire))
+            {
+                seg = new_seg;
+            }
+            else
+            {
+                // Other thread has published segment. It is loaded into `seg`.
+                deallocate_segment(new_seg);
+            }
+        }
+
+        return seg;
+    }
+
+    entry_type* allocate_block(std::size_t b)
+    {
+        entry_allocator entry_alloc(data_.ref_to_alloc());
+
+        entry_type* block = sfl::dtl::allocate(entry_alloc, block_size(b));
+
+        for (size_type i = 0; i != block_size(b); ++i)
+        {
+            sfl::dtl::construct_at_a(entry_alloc, block + i, nullptr);
+        }
+
+        return block;
+    }
+
+    void deallocate_block(entry_type* block, std::size_t b) noexcept
+    {
+        entry_allocator entry_alloc(data_.ref_to_alloc());
+
+        for (size_type i = 0; i != block_size(b); ++i)
+        {
+            sfl::dtl::destroy_at_a(entry_alloc, block + i);
+        }
+
+        sfl::dtl::deallocate(entry_alloc, block, block_size(b));
+    }
+
+    segment* allocate_segment()
+    {
+        segment_allocator seg_alloc(data_.ref_to_alloc());
+
+        segment* seg = sfl::dtl::allocate(seg_alloc, 1);
+
+        SFL_TRY
+        {
+            seg->elements_ = sfl::dtl::allocate(data_.ref_to_alloc(), N);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::deallocate(seg_alloc, seg, 1);
+            SFL_RETHROW;
+        }
+
+        for (std::size_t j = 0; j != N; ++j)
+        {
+            ::new (static_cast<void*>(&seg->state_[j])) std::atomic<unsigned char>(slot_empty);
+        }
+
+        return seg;
+    }
+
+    void deallocate_segment(segment* seg) noexcept
+    {
+        segment_allocator seg_alloc(data_.ref_to_alloc());
+
+        sfl::dtl::deallocate(data_.ref_to_alloc(), seg->elements_, N);
+
+        sfl::dtl::deallocate(seg_alloc, seg, 1);
+    }
+
+    // Deallocates all blocks and segments. It does not destroy any element.
+    //
+    void deallocate_storage() noexcept
+    {
+        for (std::size_t b = 0; b != max_blocks; ++b)
+        {
+            entry_type* block = data_.blocks_[b].load(std::memory_order_acquire);
+
+            if (block == nullptr)
+            {
+                continue;
+            }
+
+            for (size_type i = 0; i != block_size(b); ++i)
+            {
+                segment* seg = block[i].load(std::memory_order_relaxed);
+
+                if (seg != nullptr)
+                {
+                    deallocate_segment(seg);
+                }
+            }
+
+            deallocate_block(block, b);
+
+            data_.blocks_[b].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace sfl
+
+#endif // SFL_CONCURRENT_SEGMENTED_VECTOR_HPP_INCLUDED
@@ -0,0 +1,326 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_FIND_KEY_HPP_INCLUDED
+#define SFL_DETAIL_FIND_KEY_HPP_INCLUDED
+
+#include <sfl/detail/bit/countr_zero.hpp>
+#include <sfl/detail/type_traits/remove_cvref_t.hpp>
+#include <sfl/detail/cpp.hpp>
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstring>      // memcpy
+#include <functional>   // equal_to
+#include <memory>       // addressof
+#include <type_traits>  // integral_constant, is_xxxxx
+#include <utility>      // declval
+
+#ifdef SFL_SSE2
+#include <emmintrin.h>  // _mm_xxxxx
+#endif
+
+#ifdef SFL_AVX2
+#include <immintrin.h>  // _mm256_xxxxx
+#endif
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+namespace find_key_impl
+{
+
+template <typename Key, typename KeyEqual>
+struct is_std_equal_to : std::false_type {};
+
+template <typename Key>
+struct is_std_equal_to<Key, std::equal_to<Key>> : std::true_type {};
+
+#if SFL_CPP_VERSION >= SFL_CPP_14
+template <typename Key>
+struct is_std_equal_to<Key, std::equal_to<>> : std::true_type {};
+#endif
+
+// True if two keys are equal if and only if their object representations
+// are equal, so keys can be compared as raw bytes.
+template <typename Key, typename K, typename KeyEqual>
+struct is_bitwise_comparable : std::integral_constant
+<
+    bool,
+    (std::is_integral<Key>::value || std::is_enum<Key>::value || std::is_pointer<Key>::value) &&
+    (sizeof(Key) == 1 || sizeof(Key) == 2 || sizeof(Key) == 4 || sizeof(Key) == 8) &&
+    std::is_same<sfl::dtl::remove_cvref_t<K>, Key>::value &&
+    is_std_equal_to<Key, KeyEqual>::value
+> {};
+
+template <std::size_t KeySize>
+struct key_bits;
+
+template <> struct key_bits<1> { using type = std::uint8_t;  };
+template <> struct key_bits<2> { using type = std::uint16_t; };
+template <> struct key_bits<4> { using type = std::uint32_t; };
+template <> struct key_bits<8> { using type = std::uint64_t; };
+
+template <typename Key>
+typename key_bits<sizeof(Key)>::type to_bits(const Key& k) noexcept
+{
+    typename key_bits<sizeof(Key)>::type bits;
+    std::memcpy(&bits, std::addressof(k), sizeof(Key));
+    return bits;
+}
+
+template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+const Value* scalar_find(const Value* first, const Value* last, const K& k, const KeyEqual& equal)
+{
+    for (; first != last; ++first)
+    {
+        if (equal(KeyOfValue()(*first), k))
+        {
+            break;
+        }
+    }
+
+    return first;
+}
+
+#ifdef SFL_SSE2
+
+struct sse2
+{
+    using vector_type = __m128i;
+
+    using mask_type = std::uint32_t;
+
+    static constexpr std::size_t width = 16;
+
+    static vector_type load(const unsigned char* p) noexcept
+    {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    static vector_type broadcast(std::uint8_t  x) noexcept { return _mm_set1_epi8(static_cast<char>(x)); }
+    static vector_type broadcast(std::uint16_t x) noexcept { return _mm_set1_epi16(static_cast<short>(x)); }
+    static vector_type broadcast(std::uint32_t x) noexcept { return _mm_set1_epi32(static_cast<int>(x)); }
+    static vector_type broadcast(std::uint64_t x) noexcept { return _mm_set1_epi64x(static_cast<long long>(x)); }
+
+    // Returns one bit per byte. All bytes of equal lanes are set.
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 1>) noexcept
+    {
+        return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+    }
+
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 2>) noexcept
+    {
+        return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi16(a, b)));
+    }
+
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 4>) noexcept
+    {
+        return static_cast<mask_type>(_mm_movemask_epi8(_mm_cmpeq_epi32(a, b)));
+    }
+
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 8>) noexcept
+    {
+        // SSE2 has no 64-bit comparison. A 64-bit lane is equal if both of
+        // its 32-bit halves are equal.
+        const __m128i eq = _mm_cmpeq_epi32(a, b);
+        return static_cast<mask_type>
+        (
+            _mm_movemask_epi8(_mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1))))
+        );
+    }
+};
+
+#endif // SFL_SSE2
+
+#ifdef SFL_AVX2
+
+struct avx2
+{
+    using vector_type = __m256i;
+
+    using mask_type = std::uint32_t;
+
+    static constexpr std::size_t width = 32;
+
+    static vector_type load(const unsigned char* p) noexcept
+    {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    }
+
+    static vector_type broadcast(std::uint8_t  x) noexcept { return _mm256_set1_epi8(static_cast<char>(x)); }
+    static vector_type broadcast(std::uint16_t x) noexcept { return _mm256_set1_epi16(static_cast<short>(x)); }
+    static vector_type broadcast(std::uint32_t x) noexcept { return _mm256_set1_epi32(static_cast<int>(x)); }
+    static vector_type broadcast(std::uint64_t x) noexcept { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+
+    // Returns one bit per byte. All bytes of equal lanes are set.
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 1>) noexcept
+    {
+        return static_cast<mask_type>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+    }
+
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 2>) noexcept
+    {
+        return static_cast<mask_type>(_mm256_movemask_epi8(_mm256_cmpeq_epi16(a, b)));
+    }
+
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 4>) noexcept
+    {
+        return static_cast<mask_type>(_mm256_movemask_epi8(_mm256_cmpeq_epi32(a, b)));
+    }
+
+    static mask_type match(vector_type a, vector_type b, std::integral_constant<std::size_t, 8>) noexcept
+    {
+        return static_cast<mask_type>(_mm256_movemask_epi8(_mm256_cmpeq_epi64(a, b)));
+    }
+};
+
+using simd = avx2;
+
+#elif defined(SFL_SSE2)
+
+using simd = sse2;
+
+#endif
+
+#if defined(SFL_SSE2) || defined(SFL_AVX2)
+
+// Loads `simd::width` bytes at once, which is `simd::width / sizeof(Value)`
+// elements, and compares all key lanes with one instruction. Bytes that do
+// not belong to keys (mapped values, padding) are compared too, but their
+// bits are removed from the result by `key_mask`.
+template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+const Value* simd_find(const Value* first, const Value* last, const K& k, const KeyEqual& equal)
+{
+    using key_type = sfl::dtl::remove_cvref_t<decltype(KeyOfValue()(std::declval<const Value&>()))>;
+
+    constexpr std::size_t stride = sizeof(Value);
+
+    constexpr std::size_t per_vector = simd::width / stride;
+
+    const std::size_t n = std::size_t(last - first);
+
+    if (n < per_vector)
+    {
+        return scalar_find<KeyOfValue>(first, last, k, equal);
+    }
+
+    const unsigned char* const bytes = reinterpret_cast<const unsigned char*>(first);
+
+    const std::size_t offset = std::size_t
+    (
+        reinterpret_cast<const unsigned char*>(std::addressof(KeyOfValue()(*first))) - bytes
+    );
+
+    if (offset % sizeof(key_type) != 0)
+    {
+        return scalar_find<KeyOfValue>(first, last, k, equal);
+    }
+
+    typename simd::mask_type key_mask = 0;
+
+    for (std::size_t i = 0; i < per_vector; ++i)
+    {
+        key_mask |= typename simd::mask_type(1) << (i * stride + offset);
+    }
+
+    const typename simd::vector_type needle = simd::broadcast(sfl::dtl::find_key_impl::to_bits(k));
+
+    std::size_t i = 0;
+
+    for (; i + per_vector <= n; i += per_vector)
+    {
+        const typename simd::mask_type mask = key_mask & simd::match
+        (
+            simd::load(bytes + i * stride),
+            needle,
+            std::integral_constant<std::size_t, sizeof(key_type)>()
+        );
+
+        if (mask != 0)
+        {
+            return first + i + std::size_t(sfl::dtl::countr_zero(mask)) / stride;
+        }
+    }
+
+    return scalar_find<KeyOfValue>(first + i, last, k, equal);
+}
+
+template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+struct use_simd : std::integral_constant
+<
+    bool,
+    is_bitwise_comparable
+    <
+        sfl::dtl::remove_cvref_t<decltype(KeyOfValue()(std::declval<const Value&>()))>,
+        K,
+        KeyEqual
+    >::value &&
+    (simd::width % sizeof(Value) == 0) &&
+    (simd::width / sizeof(Value) >= 2)
+> {};
+
+template <typename KeyOfValue, typename Value, typename K, typename KeyEqual,
+          typename std::enable_if<use_simd<KeyOfValue, Value, K, KeyEqual>::value>::type* = nullptr>
+const Value* find(const Value* first, const Value* last, const K& k, const KeyEqual& equal)
+{
+    return simd_find<KeyOfValue>(first, last, k, equal);
+}
+
+template <typename KeyOfValue, typename Value, typename K, typename KeyEqual,
+          typename std::enable_if<!use_simd<KeyOfValue, Value, K, KeyEqual>::value>::type* = nullptr>
+const Value* find(const Value* first, const Value* last, const K& k, const KeyEqual& equal)
+{
+    return scalar_find<KeyOfValue>(first, last, k, equal);
+}
+
+#else // SFL_SSE2 || SFL_AVX2
+
+template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+const Value* find(const Value* first, const Value* last, const K& k, const KeyEqual& equal)
+{
+    return scalar_find<KeyOfValue>(first, last, k, equal);
+}
+
+#endif // SFL_SSE2 || SFL_AVX2
+
+} // namespace find_key_impl
+
+// Returns pointer to the first element in the contiguous range [first, last)
+// whose key is equal to `k`, or `last` if there is no such element.
+//
+// If keys are integers, enumerations or pointers compared with
+// `std::equal_to` and several elements fit into one SIMD register, keys are
+// compared using SSE2 or AVX2 instructions. Otherwise `equal` is called for
+// each element.
+template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+const Value* find_key(const Value* first, const Value* last, const K& k, const KeyEqual& equal)
+{
+    return sfl::dtl::find_key_impl::find<KeyOfValue>(first, last, k, equal);
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_FIND_KEY_HPP_INCLUDED
@@ -0,0 +1,86 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_FOR_EACH_SEGMENT_HPP_INCLUDED
+#define SFL_DETAIL_FOR_EACH_SEGMENT_HPP_INCLUDED
+
+#include <sfl/detail/memory/to_address.hpp>
+#include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/type_traits/is_segmented_iterator.hpp>
+#include <sfl/detail/type_traits/segmented_iterator_traits.hpp>
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Calls `f(local_first, local_last)` for each contiguous part of the range
+// [first, last). If `ForwardIt` is segmented iterator then `local_first` and
+// `local_last` are raw pointers into one segment. Otherwise `f` is called
+// exactly once with `first` and `last`.
+//
+
+template <typename ForwardIt, typename Function,
+          sfl::dtl::enable_if_t< !sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
+Function for_each_segment(ForwardIt first, ForwardIt last, Function f)
+{
+    f(first, last);
+    return f;
+}
+
+template <typename ForwardIt, typename Function,
+          sfl::dtl::enable_if_t< sfl::dtl::is_segmented_iterator<ForwardIt>::value >* = nullptr>
+Function for_each_segment(ForwardIt first, ForwardIt last, Function f)
+{
+    using traits = sfl::dtl::segmented_iterator_traits<ForwardIt>;
+
+    auto first_seg = traits::segment(first);
+    auto last_seg  = traits::segment(last);
+
+    if (first_seg == last_seg)
+    {
+        f(sfl::dtl::to_address(traits::local(first)), sfl::dtl::to_address(traits::local(last)));
+    }
+    else
+    {
+        f(sfl::dtl::to_address(traits::local(first)), sfl::dtl::to_address(traits::end(first_seg)));
+
+        ++first_seg;
+
+        while (first_seg != last_seg)
+        {
+            f(sfl::dtl::to_address(traits::begin(first_seg)), sfl::dtl::to_address(traits::end(first_seg)));
+
+            ++first_seg;
+        }
+
+        f(sfl::dtl::to_address(traits::begin(last_seg)), sfl::dtl::to_address(traits::local(last)));
+    }
+
+    return f;
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_FOR_EACH_SEGMENT_HPP_INCLUDED
@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_MERGE_WITHOUT_BUFFER_HPP_INCLUDED
+#define SFL_DETAIL_MERGE_WITHOUT_BUFFER_HPP_INCLUDED
+
+#include <algorithm> // iter_swap, lower_bound, rotate, upper_bound
+#include <iterator>  // distance, next
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+// Merges two consecutive sorted ranges [first, middle) and [middle, last)
+// into one sorted range [first, last). The merge is stable and, unlike
+// std::inplace_merge, it never allocates a temporary buffer.
+//
+// Complexity: O(N log N) comparisons and moves, where N = last - first.
+//
+template <typename RandomIt, typename Compare>
+void merge_without_buffer(RandomIt first, RandomIt middle, RandomIt last, Compare comp)
+{
+    while (first != middle && middle != last)
+    {
+        const auto len1 = std::distance(first, middle);
+        const auto len2 = std::distance(middle, last);
+
+        if (len1 + len2 == 2)
+        {
+            if (comp(*middle, *first))
+            {
+                std::iter_swap(first, middle);
+            }
+
+            return;
+        }
+
+        RandomIt first_cut;
+        RandomIt second_cut;
+
+        if (len1 > len2)
+        {
+            first_cut  = std::next(first, len1 / 2);
+            second_cut = std::lower_bound(middle, last, *first_cut, comp);
+        }
+        else
+        {
+            second_cut = std::next(middle, len2 / 2);
+            first_cut  = std::upper_bound(first, middle, *second_cut, comp);
+        }
+
+        const RandomIt new_middle = std::rotate(first_cut, middle, second_cut);
+
+        sfl::dtl::merge_without_buffer(first, first_cut, new_middle, comp);
+
+        first  = new_middle;
+        middle = second_cut;
+    }
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_MERGE_WITHOUT_BUFFER_HPP_INCLUDED
@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_STABLE_SORT_WITH_BUFFER_HPP_INCLUDED
+#define SFL_DETAIL_STABLE_SORT_WITH_BUFFER_HPP_INCLUDED
+
+#include <sfl/detail/algorithm/stable_sort_without_buffer.hpp>
+
+#include <iterator>  // distance, next
+#include <utility>   // move
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+// Moves elements from sorted ranges [first1, last1) and [first2, last2)
+// into range beginning at `out`. Elements from the first range go before
+// equivalent elements from the second range.
+template <typename InputIt1, typename InputIt2, typename OutputIt, typename Compare>
+OutputIt move_merge(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, OutputIt out, Compare comp)
+{
+    while (first1 != last1 && first2 != last2)
+    {
+        if (comp(*first2, *first1))
+        {
+            *out = std::move(*first2);
+            ++first2;
+        }
+        else
+        {
+            *out = std::move(*first1);
+            ++first1;
+        }
+        ++out;
+    }
+
+    out = std::move(first1, last1, out);
+    return std::move(first2, last2, out);
+}
+
+template <typename RandomIt, typename BufferIt, typename Compare>
+void stable_sort_with_buffer(RandomIt first, RandomIt last, BufferIt buffer, Compare comp);
+
+// Sorts elements in range [first, last) and moves them into range beginning
+// at `out`. Elements in range [first, last) are used as scratch space.
+template <typename RandomIt, typename BufferIt, typename Compare>
+void stable_sort_move(RandomIt first, RandomIt last, BufferIt out, Compare comp)
+{
+    const auto len = std::distance(first, last);
+
+    if (len < 16)
+    {
+        sfl::dtl::insertion_sort(first, last, comp);
+        std::move(first, last, out);
+    }
+    else
+    {
+        const RandomIt middle = std::next(first, len / 2);
+        sfl::dtl::stable_sort_with_buffer(first, middle, out, comp);
+        sfl::dtl::stable_sort_with_buffer(middle, last, std::next(out, len / 2), comp);
+        sfl::dtl::move_merge(first, middle, middle, last, out, comp);
+    }
+}
+
+// Sorts elements in range [first, last). The order of equivalent elements
+// is preserved. Range beginning at `buffer` must hold at least
+// `last - first` elements that can be move-assigned. They are used as
+// scratch space and their values are unspecified afterwards.
+//
+// Complexity: O(N log N) comparisons and moves, where N = last - first.
+//
+template <typename RandomIt, typename BufferIt, typename Compare>
+void stable_sort_with_buffer(RandomIt first, RandomIt last, BufferIt buffer, Compare comp)
+{
+    const auto len = std::distance(first, last);
+
+    if (len < 16)
+    {
+        sfl::dtl::insertion_sort(first, last, comp);
+    }
+    else
+    {
+        const BufferIt buffer_middle = std::next(buffer, len / 2);
+        const BufferIt buffer_last = std::next(buffer, len);
+        sfl::dtl::stable_sort_move(first, std::next(first, len / 2), buffer, comp);
+        sfl::dtl::stable_sort_move(std::next(first, len / 2), last, buffer_middle, comp);
+        sfl::dtl::move_merge(buffer, buffer_middle, buffer_middle, buffer_last, first, comp);
+    }
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_STABLE_SORT_WITH_BUFFER_HPP_INCLUDED
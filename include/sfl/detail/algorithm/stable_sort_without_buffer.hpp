@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_STABLE_SORT_WITHOUT_BUFFER_HPP_INCLUDED
+#define SFL_DETAIL_STABLE_SORT_WITHOUT_BUFFER_HPP_INCLUDED
+
+#include <sfl/detail/algorithm/merge_without_buffer.hpp>
+
+#include <algorithm> // move_backward
+#include <iterator>  // distance, next, prev
+#include <utility>   // move
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+template <typename RandomIt, typename Compare>
+void insertion_sort(RandomIt first, RandomIt last, Compare comp)
+{
+    if (first == last)
+    {
+        return;
+    }
+
+    for (RandomIt curr = std::next(first); curr != last; ++curr)
+    {
+        if (comp(*curr, *first))
+        {
+            auto tmp = std::move(*curr);
+            std::move_backward(first, curr, std::next(curr));
+            *first = std::move(tmp);
+        }
+        else
+        {
+            auto tmp = std::move(*curr);
+            RandomIt hole = curr;
+            RandomIt prev = std::prev(curr);
+            while (comp(tmp, *prev))
+            {
+                *hole = std::move(*prev);
+                hole = prev;
+                --prev;
+            }
+            *hole = std::move(tmp);
+        }
+    }
+}
+
+// Sorts elements in range [first, last). The order of equivalent elements
+// is preserved and, unlike std::stable_sort, it never allocates a temporary
+// buffer.
+//
+// Complexity: O(N log^2 N) comparisons and moves, where N = last - first.
+//
+template <typename RandomIt, typename Compare>
+void stable_sort_without_buffer(RandomIt first, RandomIt last, Compare comp)
+{
+    const auto len = std::distance(first, last);
+
+    if (len < 16)
+    {
+        sfl::dtl::insertion_sort(first, last, comp);
+    }
+    else
+    {
+        const RandomIt middle = std::next(first, len / 2);
+        sfl::dtl::stable_sort_without_buffer(first, middle, comp);
+        sfl::dtl::stable_sort_without_buffer(middle, last, comp);
+        sfl::dtl::merge_without_buffer(first, middle, last, comp);
+    }
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_STABLE_SORT_WITHOUT_BUFFER_HPP_INCLUDED
@@ -21,15 +21,21 @@
 #ifndef SFL_DETAIL_ASSOCIATIVE_VECTOR_HPP_INCLUDED
 #define SFL_DETAIL_ASSOCIATIVE_VECTOR_HPP_INCLUDED
 
+#include <sfl/detail/algorithm/stable_sort_with_buffer.hpp>
+#include <sfl/detail/algorithm/stable_sort_without_buffer.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/type_traits/has_allocator_type.hpp>
+#include <sfl/detail/type_traits/is_forward_iterator.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
+#include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
+#include <sfl/vector.hpp>
 
-#include <algorithm>    // lexicographical_compare, lower_bound, upper_bound
-#include <iterator>     // distance, next, prev
+#include <algorithm>    // adjacent_find, is_sorted, lexicographical_compare, lower_bound, min, reverse, rotate, unique, upper_bound
+#include <iterator>     // distance, make_move_iterator, next, prev
 #include <tuple>        // forward_as_tuple
-#include <type_traits>  // is_same
-#include <utility>      // forward, move, pair, piecewise_construct
+#include <type_traits>  // false_type, integral_constant, is_rvalue_reference, is_same, true_type
+#include <utility>      // declval, forward, move, pair, piecewise_construct
 
 #ifdef SFL_TEST_ASSOCIATIVE_VECTOR
 template <int>
@@ -179,12 +185,7 @@ public:
     void assign_range_equal(InputIt first, InputIt last)
     {
         clear();
-
-        while (first != last)
-        {
-            insert_equal(*first);
-            ++first;
-        }
+        insert_range_equal(first, last);
     }
 
     template <typename InputIt,
@@ -192,12 +193,7 @@ public:
     void assign_range_unique(InputIt first, InputIt last)
     {
         clear();
-
-        while (first != last)
-        {
-            insert_unique(*first);
-            ++first;
-        }
+        insert_range_unique(first, last);
     }
 
     //
@@ -467,6 +463,153 @@ public:
         }
     }
 
+    // Inserts elements from range [first, last). Elements are appended at the
+    // end of the underlying vector, then new elements are sorted and merged
+    // with existing elements. The result is the same as if each element were
+    // inserted by `insert_equal`.
+    //
+    // Complexity: O(N + M log M), where N = size() and M = distance(first, last).
+    //
+    template <typename InputIt, typename Sentinel>
+    void insert_range_equal(InputIt first, Sentinel last)
+    {
+        const size_type old_size = size();
+
+        append_range(first, last);
+
+        merge_tail_equal(old_size);
+
+        // Vector is full. Another batch would merge all elements again for
+        // only a few new elements, so insert the rest one by one and let
+        // the vector handle the overflow.
+        while (first != last)
+        {
+            insert_equal(*first);
+            ++first;
+        }
+    }
+
+    // Inserts elements from range [first, last) whose keys are not already
+    // present in the container. If multiple elements in the range have
+    // equivalent keys, only the first one is inserted.
+    //
+    // Complexity: O(N + M log M), where N = size() and M = distance(first, last).
+    //
+    // Elements from ranges that yield rvalue references (e.g. move iterators)
+    // are inserted one by one, so that elements with duplicate keys are not
+    // moved from.
+    //
+    template <typename InputIt, typename Sentinel,
+              sfl::dtl::enable_if_t<!std::is_rvalue_reference<decltype(*std::declval<InputIt&>())>::value>* = nullptr>
+    void insert_range_unique(InputIt first, Sentinel last)
+    {
+        const size_type old_size = size();
+
+        append_range(first, last);
+
+        merge_tail_unique(old_size);
+
+        // Vector is full. Another batch would merge all elements again for
+        // only a few new elements, so insert the rest one by one. Each
+        // element is either a duplicate of an existing element or the
+        // vector handles the overflow.
+        while (first != last)
+        {
+            insert_unique(*first);
+            ++first;
+        }
+    }
+
+    template <typename InputIt, typename Sentinel,
+              sfl::dtl::enable_if_t<std::is_rvalue_reference<decltype(*std::declval<InputIt&>())>::value>* = nullptr>
+    void insert_range_unique(InputIt first, Sentinel last)
+    {
+        while (first != last)
+        {
+            insert_unique(*first);
+            ++first;
+        }
+    }
+
+    // Inserts elements from range [first, last) that is sorted with respect
+    // to key compare. New elements are merged with existing elements in
+    // linear time. Relative order of new elements is preserved and each new
+    // element is placed before existing elements with equivalent keys.
+    //
+    // Complexity: O(N + M), where N = size() and M = distance(first, last).
+    //
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_equal(InputIt first, Sentinel last)
+    {
+        const size_type old_size = size();
+
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                ref_to_vector().emplace_back(*first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), end());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(is_sorted_equal(nth(old_size), end()));
+
+        merge_sorted_tail(old_size);
+    }
+
+    // Inserts elements from range [first, last) that is sorted with respect
+    // to key compare and contains no elements with equivalent keys. Elements
+    // whose keys are already present in the container are not inserted.
+    // New elements are merged with existing elements in linear time.
+    //
+    // Complexity: O(N + M), where N = size() and M = distance(first, last).
+    //
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_unique(InputIt first, Sentinel last)
+    {
+        const size_type old_size = size();
+
+        // Position of the first existing element that is not less than
+        // the current element from range.
+        size_type pos = 0;
+
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                auto&& value = *first;
+
+                const auto& k = KeyOfValue()(value);
+
+                while (pos != old_size && ref_to_key_compare()(KeyOfValue()(*nth(pos)), k))
+                {
+                    ++pos;
+                }
+
+                if (pos == old_size || ref_to_key_compare()(k, KeyOfValue()(*nth(pos))))
+                {
+                    ref_to_vector().emplace_back(std::forward<decltype(value)>(value));
+                }
+
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), end());
+            SFL_RETHROW;
+        }
+
+        SFL_ASSERT(is_sorted_unique(nth(old_size), end()));
+
+        merge_sorted_tail(old_size);
+    }
+
     template <typename K, typename M>
     std::pair<iterator, bool> insert_or_assign(K&& k, M&& obj)
     {
@@ -599,6 +742,105 @@ public:
         swap(ref_to_vector(), other.ref_to_vector());
     }
 
+    // Inserts copies of elements from `other` whose keys are not present in
+    // this container. New elements are merged with existing elements in
+    // linear time. Returns the number of inserted elements.
+    size_type union_unique(const associative_vector& other)
+    {
+        if (this == &other)
+        {
+            return 0;
+        }
+
+        const size_type old_size = size();
+        insert_range_sorted_unique(other.begin(), other.end());
+        return size() - old_size;
+    }
+
+    // Erases elements whose keys are not present in `other`. Kept elements
+    // are moved towards the beginning in a single pass. Returns the number
+    // of erased elements.
+    size_type intersection_unique(const associative_vector& other)
+    {
+        if (this == &other)
+        {
+            return 0;
+        }
+
+        iterator out = begin();
+        iterator it = begin();
+        const_iterator jt = other.begin();
+
+        while (it != end() && jt != other.end())
+        {
+            if (value_less(*it, *jt))
+            {
+                ++it;
+            }
+            else if (value_less(*jt, *it))
+            {
+                ++jt;
+            }
+            else
+            {
+                if (out != it)
+                {
+                    *out = std::move(*it);
+                }
+                ++out;
+                ++it;
+                ++jt;
+            }
+        }
+
+        const size_type old_size = size();
+        erase(out, end());
+        return old_size - size();
+    }
+
+    // Erases elements whose keys are present in `other`. Kept elements are
+    // moved towards the beginning in a single pass. Returns the number of
+    // erased elements.
+    size_type difference_unique(const associative_vector& other)
+    {
+        const size_type old_size = size();
+
+        if (this == &other)
+        {
+            clear();
+            return old_size;
+        }
+
+        iterator out = begin();
+        iterator it = begin();
+        const_iterator jt = other.begin();
+
+        while (it != end())
+        {
+            if (jt == other.end() || value_less(*it, *jt))
+            {
+                if (out != it)
+                {
+                    *out = std::move(*it);
+                }
+                ++out;
+                ++it;
+            }
+            else if (value_less(*jt, *it))
+            {
+                ++jt;
+            }
+            else
+            {
+                ++it;
+                ++jt;
+            }
+        }
+
+        erase(out, end());
+        return old_size - size();
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -760,6 +1002,356 @@ private:
         bool     status;
     };
 
+    // Vectors that have allocator sort and merge using temporary buffer that
+    // is allocated by the same allocator. Vectors without allocator (static
+    // vectors) must not allocate memory at all, so they use buffer-free
+    // algorithms instead.
+    using use_temporary_buffer = std::integral_constant
+    <
+        bool,
+        sfl::dtl::has_allocator_type<Vector>::value
+    >;
+
+    template <typename V>
+    using temporary_buffer = sfl::vector
+    <
+        value_type,
+        typename sfl::dtl::allocator_traits<typename V::allocator_type>::template rebind_alloc<value_type>
+    >;
+
+    template <typename V = Vector>
+    typename temporary_buffer<V>::allocator_type temporary_buffer_allocator() const
+    {
+        return typename temporary_buffer<V>::allocator_type(ref_to_vector().get_allocator());
+    }
+
+    bool value_less(const value_type& x, const value_type& y) const
+    {
+        return ref_to_key_compare()(KeyOfValue()(x), KeyOfValue()(y));
+    }
+
+    // Appends elements from range [first, last) at the end of the underlying
+    // vector until the range is exhausted or the vector is full. On exception,
+    // all appended elements are erased.
+    template <typename InputIt, typename Sentinel>
+    void append_range(InputIt& first, Sentinel& last)
+    {
+        const size_type old_size = size();
+
+        reserve_for_range(first, last, use_temporary_buffer());
+
+        SFL_TRY
+        {
+            while (first != last && size() != max_size())
+            {
+                ref_to_vector().emplace_back(*first);
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), end());
+            SFL_RETHROW;
+        }
+    }
+
+    // Reserves storage for all elements from range [first, last) if its
+    // length is known, so bulk insertion reallocates at most once.
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_forward_iterator<InputIt>::value>* = nullptr>
+    void reserve_for_range(const InputIt& first, const InputIt& last, std::true_type)
+    {
+        const size_type n = size_type(std::distance(first, last));
+
+        ref_to_vector().reserve(size() + std::min(n, size_type(max_size() - size())));
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void reserve_for_range(const InputIt&, const Sentinel&, std::true_type)
+    {}
+
+    // Static vectors never reallocate.
+    template <typename InputIt, typename Sentinel>
+    void reserve_for_range(const InputIt&, const Sentinel&, std::false_type)
+    {}
+
+    // Moves elements into temporary buffer and sorts them back into range
+    // [first, last).
+    //
+    // Complexity: O(M log M), where M = distance(first, last).
+    //
+    void stable_sort(iterator first, iterator last, std::true_type)
+    {
+        if (std::distance(first, last) < 2)
+        {
+            return;
+        }
+
+        temporary_buffer<Vector> buffer
+        (
+            std::make_move_iterator(first),
+            std::make_move_iterator(last),
+            temporary_buffer_allocator()
+        );
+
+        sfl::dtl::stable_sort_move
+        (
+            buffer.begin(),
+            buffer.end(),
+            first,
+            [&](const value_type& x, const value_type& y)
+            {
+                return value_less(x, y);
+            }
+        );
+    }
+
+    void stable_sort(iterator first, iterator last, std::false_type)
+    {
+        sfl::dtl::stable_sort_without_buffer
+        (
+            first,
+            last,
+            [&](const value_type& x, const value_type& y)
+            {
+                return value_less(x, y);
+            }
+        );
+    }
+
+    bool is_sorted_equal(const_iterator first, const_iterator last) const
+    {
+        return std::is_sorted
+        (
+            first,
+            last,
+            [&](const value_type& x, const value_type& y)
+            {
+                return value_less(x, y);
+            }
+        );
+    }
+
+    bool is_sorted_unique(const_iterator first, const_iterator last) const
+    {
+        return std::adjacent_find
+        (
+            first,
+            last,
+            [&](const value_type& x, const value_type& y)
+            {
+                return !value_less(x, y);
+            }
+        ) == last;
+    }
+
+    // Merges unsorted elements [nth(old_size), end()) with sorted elements
+    // [begin(), nth(old_size)). The result is the same as if new elements
+    // were inserted one by one using `insert_equal`, that is, each new element
+    // is placed before all existing elements with equivalent keys.
+    void merge_tail_equal(size_type old_size)
+    {
+        SFL_TRY
+        {
+            std::reverse(nth(old_size), end());
+            stable_sort(nth(old_size), end(), use_temporary_buffer());
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), end());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_tail(old_size);
+    }
+
+    // Merges unsorted elements [nth(old_size), end()) with sorted elements
+    // [begin(), nth(old_size)). New elements whose keys are equivalent to
+    // keys of existing elements or keys of preceding new elements are erased.
+    void merge_tail_unique(size_type old_size)
+    {
+        SFL_TRY
+        {
+            const iterator middle = nth(old_size);
+
+            stable_sort(middle, end(), use_temporary_buffer());
+
+            const iterator new_last = std::unique
+            (
+                middle,
+                end(),
+                [&](const value_type& x, const value_type& y)
+                {
+                    return !value_less(x, y);
+                }
+            );
+
+            erase(new_last, end());
+
+            if (old_size != 0)
+            {
+                // Remove new elements that are already present. Both ranges
+                // are sorted, so a single linear pass is enough.
+                iterator curr = begin();
+                iterator dest = middle;
+
+                for (iterator it = middle; it != end(); ++it)
+                {
+                    while (curr != middle && value_less(*curr, *it))
+                    {
+                        ++curr;
+                    }
+
+                    if (curr == middle || value_less(*it, *curr))
+                    {
+                        if (dest != it)
+                        {
+                            *dest = std::move(*it);
+                        }
+
+                        ++dest;
+                    }
+                }
+
+                erase(dest, end());
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), end());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_tail(old_size);
+    }
+
+    // Merges sorted elements [nth(old_size), end()) with sorted elements
+    // [begin(), nth(old_size)). Each new element is placed before all
+    // existing elements with equivalent keys. On exception, new elements
+    // that are not merged yet are erased and existing elements are kept.
+    void merge_sorted_tail(size_type old_size)
+    {
+        if (old_size == 0 || old_size == size())
+        {
+            return;
+        }
+
+        SFL_TRY
+        {
+            if (value_less(*nth(old_size - 1), *nth(old_size)))
+            {
+                // All new elements go after existing elements.
+                return;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), end());
+            SFL_RETHROW;
+        }
+
+        merge_sorted_tail(old_size, use_temporary_buffer());
+    }
+
+    // Moves new elements into temporary buffer and merges from the back.
+    // Elements [begin(), nth(i)) are existing elements that are not merged
+    // yet, elements [nth(i + j), end()) are merged, and elements in between
+    // are moved-from. On exception, moved-from elements are erased and
+    // the remaining elements are still sorted.
+    //
+    // Complexity: O(N + M).
+    //
+    void merge_sorted_tail(size_type old_size, std::true_type)
+    {
+        temporary_buffer<Vector> buffer(temporary_buffer_allocator());
+
+        SFL_TRY
+        {
+            buffer.assign(std::make_move_iterator(nth(old_size)), std::make_move_iterator(end()));
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(old_size), end());
+            SFL_RETHROW;
+        }
+
+        size_type i = old_size;
+        size_type j = buffer.size();
+
+        SFL_TRY
+        {
+            while (j != 0)
+            {
+                if (i != 0 && !value_less(*nth(i - 1), buffer[j - 1]))
+                {
+                    *nth(i + j - 1) = std::move(*nth(i - 1));
+                    --i;
+                }
+                else
+                {
+                    *nth(i + j - 1) = std::move(buffer[j - 1]);
+                    --j;
+                }
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(i), nth(i + j));
+            SFL_RETHROW;
+        }
+    }
+
+    // Merges from the back without buffer. The greatest new element that is
+    // not merged yet is rotated in front of existing elements that must go
+    // after it. Elements [begin(), nth(i)) are existing elements that are
+    // not merged yet, elements [nth(i), nth(i + j)) are new elements that
+    // are not merged yet, and elements [nth(i + j), end()) are merged. On
+    // exception, elements that are not merged yet are erased. Existing
+    // elements are erased only if rotation throws.
+    //
+    // Complexity: O(M log N) comparisons and O(N + M^2) moves.
+    //
+    void merge_sorted_tail(size_type old_size, std::false_type)
+    {
+        size_type i = old_size;
+        size_type j = size() - old_size;
+
+        // Index of the first element whose position is unspecified on
+        // exception.
+        size_type first = i;
+
+        SFL_TRY
+        {
+            while (i != 0 && j != 0)
+            {
+                const iterator pos = std::lower_bound
+                (
+                    begin(),
+                    nth(i),
+                    *nth(i + j - 1),
+                    [&](const value_type& x, const value_type& y)
+                    {
+                        return value_less(x, y);
+                    }
+                );
+
+                if (pos != nth(i))
+                {
+                    first = std::distance(begin(), pos);
+                    std::rotate(pos, nth(i), nth(i + j));
+                    i = first;
+                }
+
+                --j;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            erase(nth(first), nth(i + j));
+            SFL_RETHROW;
+        }
+    }
+
     template <typename K>
     position_for_insert_equal calculate_position_for_insert_equal(const K& k)
     {
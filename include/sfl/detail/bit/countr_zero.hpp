@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_COUNTR_ZERO_HPP_INCLUDED
+#define SFL_DETAIL_COUNTR_ZERO_HPP_INCLUDED
+
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/type_traits/is_unsigned_integer.hpp>
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+#include <bit>          // countr_zero
+#else
+#include <limits>       // numeric_limits
+#endif
+
+#include <type_traits>  // enable_if
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+namespace countr_zero_impl
+{
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+template <typename T>
+constexpr int calculate(T x)
+{
+    return std::countr_zero(x);
+}
+
+#else // before C++20
+
+#if defined(__GNUC__) || defined(__clang__)
+
+constexpr int calculate(unsigned char x)
+{
+    return x ? __builtin_ctz(x) : std::numeric_limits<unsigned char>::digits;
+}
+
+constexpr int calculate(unsigned short x)
+{
+    return x ? __builtin_ctz(x) : std::numeric_limits<unsigned short>::digits;
+}
+
+constexpr int calculate(unsigned int x)
+{
+    return x ? __builtin_ctz(x) : std::numeric_limits<unsigned int>::digits;
+}
+
+constexpr int calculate(unsigned long x)
+{
+    return x ? __builtin_ctzl(x) : std::numeric_limits<unsigned long>::digits;
+}
+
+constexpr int calculate(unsigned long long x)
+{
+    return x ? __builtin_ctzll(x) : std::numeric_limits<unsigned long long>::digits;
+}
+
+#else // unknown compiler
+
+template <typename T>
+constexpr int count(T x)
+{
+    return (x & 1) ? 0 : (1 + count(static_cast<T>(x >> 1)));
+}
+
+template <typename T>
+constexpr int calculate(T x)
+{
+    return x ? count(x) : std::numeric_limits<T>::digits;
+}
+
+#endif // unknown compiler
+
+#endif // before C++20
+
+} // namespace countr_zero_impl
+
+template <typename T,
+          typename std::enable_if<sfl::dtl::is_unsigned_integer<T>::value>::type* = nullptr>
+constexpr int countr_zero(T x)
+{
+    return sfl::dtl::countr_zero_impl::calculate(x);
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_COUNTR_ZERO_HPP_INCLUDED
@@ -0,0 +1,2506 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_BTREE_HPP_INCLUDED
+#define SFL_DETAIL_BTREE_HPP_INCLUDED
+
+#include <sfl/detail/memory/construct_at_a.hpp>
+#include <sfl/detail/memory/destroy_at_a.hpp>
+#include <sfl/detail/type_traits/disjunction.hpp>
+#include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/type_traits/is_input_iterator.hpp>
+#include <sfl/detail/type_traits/is_trivially_relocatable.hpp>
+#include <sfl/detail/utility/optional_value.hpp>
+#include <sfl/detail/allocator_traits.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/small_node_allocator.hpp>
+#include <sfl/detail/static_node_allocator.hpp>
+
+#include <algorithm>    // equal, lexicographical_compare
+#include <cstddef>      // size_t, ptrdiff_t
+#include <cstring>      // memmove
+#include <iterator>     // distance, xxxxx_iterator_tag, reverse_iterator
+#include <memory>       // pointer_traits
+#include <tuple>        // forward_as_tuple
+#include <type_traits>  // is_xxxxx, integral_constant
+#include <utility>      // forward, move, pair
+
+#ifdef SFL_TEST_BTREE
+template <int>
+void test_btree();
+#endif
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// NODES
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// Number of values stored in one node. Values of a node are stored
+// contiguously and node is sized to span a few cache lines, but it holds
+// at least 16 and at most 64 values. Capacity is always even.
+//
+template <typename Value>
+struct btree_node_capacity
+{
+    static constexpr std::size_t target_size = 256;
+
+    static constexpr std::size_t raw = target_size / sizeof(Value);
+
+    static constexpr std::size_t value = raw < 16 ? 16 : raw > 64 ? 64 : (raw & ~std::size_t(1));
+};
+
+//
+// Every node except the root holds at least `capacity / 2 - 1` values. This
+// gives upper bound on the number of nodes in a tree with at most N values.
+// Containers with static storage use it to size their node pools.
+//
+template <typename Value, std::size_t N>
+struct btree_max_node_count
+{
+    static constexpr std::size_t min_count = btree_node_capacity<Value>::value / 2 - 1;
+
+    static constexpr std::size_t value = N == 0 ? 0 : 1 + (N - 1) / min_count;
+};
+
+//
+// Upper bound on the number of internal nodes in a tree with at most
+// NodeCount nodes. Internal root has at least 2 children and every other
+// internal node has at least `min_count + 1` children. Result is zero only if
+// NodeCount is zero because static pools can't be empty.
+//
+template <typename Value, std::size_t NodeCount>
+struct btree_max_internal_node_count
+{
+    static constexpr std::size_t min_count = btree_node_capacity<Value>::value / 2 - 1;
+
+    static constexpr std::size_t value = NodeCount == 0 ? 0 : NodeCount < 3 ? 1 : 1 + (NodeCount - 3) / (min_count + 1);
+};
+
+//
+// Allocator for internal nodes. Allocators with node pools are rebound to
+// smaller pools because only a fraction of nodes are internal nodes.
+//
+template <typename Allocator, typename InternalNode>
+struct btree_internal_node_allocator
+{
+    using type = typename sfl::dtl::allocator_traits<Allocator>::template rebind_alloc<InternalNode>;
+};
+
+template <typename Value, std::size_t N, typename InternalNode>
+struct btree_internal_node_allocator<sfl::dtl::static_node_allocator<Value, N>, InternalNode>
+{
+    using type = sfl::dtl::static_node_allocator
+    <
+        InternalNode,
+        btree_max_internal_node_count<Value, N>::value
+    >;
+};
+
+template <typename Value, std::size_t N, typename BaseAllocator, typename InternalNode>
+struct btree_internal_node_allocator<sfl::dtl::small_node_allocator<Value, N, BaseAllocator>, InternalNode>
+{
+    using type = sfl::dtl::small_node_allocator
+    <
+        InternalNode,
+        btree_max_internal_node_count<Value, N>::value,
+        typename sfl::dtl::allocator_traits<BaseAllocator>::template rebind_alloc<InternalNode>
+    >;
+};
+
+template <typename Value, typename VoidPointer, std::size_t Capacity>
+struct btree_node
+{
+    static_assert(Capacity >= 4 && Capacity <= 255, "Invalid node capacity.");
+
+    using node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<btree_node>;
+
+    node_pointer parent_;
+
+    // Position of this node in the array of children of its parent.
+    unsigned char position_;
+
+    // Number of values stored in this node.
+    unsigned char count_;
+
+    bool leaf_;
+
+    union
+    {
+        Value values_[Capacity];
+    };
+
+    btree_node() noexcept
+        : parent_(nullptr)
+        , position_(0)
+        , count_(0)
+        , leaf_(true)
+    {}
+
+    btree_node(const btree_node& other) = delete;
+
+    btree_node& operator=(const btree_node& other) = delete;
+
+    ~btree_node() noexcept
+    {}
+};
+
+template <typename Value, typename VoidPointer, std::size_t Capacity>
+struct btree_internal_node : btree_node<Value, VoidPointer, Capacity>
+{
+    using typename btree_node<Value, VoidPointer, Capacity>::node_pointer;
+
+    using internal_node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<btree_internal_node>;
+
+    // Child `i` holds values that are less than `values_[i]` and greater than
+    // `values_[i - 1]`.
+    node_pointer children_[Capacity + 1];
+
+    btree_internal_node() noexcept
+    {
+        this->leaf_ = false;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// B-TREE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+//
+// B-tree with unique keys. Values are stored in both leaf and internal nodes,
+// so keys are never copied into separators. Leaf nodes don't have array of
+// children. Insertion and erasure invalidate all iterators.
+//
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyCompare,
+           typename Allocator >
+class btree
+{
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, Value>::value,
+        "Allocator::value_type must be Value."
+    );
+
+    #ifdef SFL_TEST_BTREE
+    template <int>
+    friend void ::test_btree();
+    #endif
+
+public:
+
+    using allocator_type  = Allocator;
+    using key_type        = Key;
+    using value_type      = Value;
+    using size_type       = typename sfl::dtl::allocator_traits<allocator_type>::size_type;
+    using difference_type = typename sfl::dtl::allocator_traits<allocator_type>::difference_type;
+    using key_compare     = KeyCompare;
+    using reference       = value_type&;
+    using const_reference = const value_type&;
+    using pointer         = typename sfl::dtl::allocator_traits<allocator_type>::pointer;
+    using const_pointer   = typename sfl::dtl::allocator_traits<allocator_type>::const_pointer;
+
+    static constexpr size_type node_capacity = btree_node_capacity<Value>::value;
+
+private:
+
+    static constexpr size_type min_count = node_capacity / 2 - 1;
+
+    using void_pointer = typename sfl::dtl::allocator_traits<allocator_type>::void_pointer;
+
+    using node_type = btree_node<value_type, void_pointer, node_capacity>;
+
+    using internal_node_type = btree_internal_node<value_type, void_pointer, node_capacity>;
+
+    using node_allocator_type = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<node_type>;
+
+    using internal_node_allocator_type = typename btree_internal_node_allocator<allocator_type, internal_node_type>::type;
+
+    using node_pointer = typename node_type::node_pointer;
+
+    using internal_node_pointer = typename internal_node_type::internal_node_pointer;
+
+public:
+
+    class iterator
+    {
+        #ifdef SFL_TEST_BTREE
+        template <int>
+        friend void ::test_btree();
+        #endif
+
+        friend class btree;
+
+    public:
+
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = Value;
+        using pointer           = Value*;
+        using reference         = Value&;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+    private:
+
+        node_pointer node_;
+
+        size_type pos_;
+
+    private:
+
+        explicit iterator(node_pointer x, size_type pos) noexcept
+            : node_(x)
+            , pos_(pos)
+        {}
+
+    public:
+
+        // Default constructor
+        iterator() noexcept
+            : node_(nullptr)
+            , pos_(0)
+        {}
+
+        // Copy constructor
+        iterator(const iterator& other) noexcept
+            : node_(other.node_)
+            , pos_(other.pos_)
+        {}
+
+        // Copy assignment operator
+        iterator& operator=(const iterator& other) noexcept
+        {
+            node_ = other.node_;
+            pos_ = other.pos_;
+            return *this;
+        }
+
+        SFL_NODISCARD
+        reference operator*() const noexcept
+        {
+            return node_->values_[pos_];
+        }
+
+        SFL_NODISCARD
+        pointer operator->() const noexcept
+        {
+            return node_->values_ + pos_;
+        }
+
+        iterator& operator++() noexcept
+        {
+            btree::increment(node_, pos_);
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            btree::increment(node_, pos_);
+            return temp;
+        }
+
+        iterator& operator--() noexcept
+        {
+            btree::decrement(node_, pos_);
+            return *this;
+        }
+
+        iterator operator--(int) noexcept
+        {
+            auto temp = *this;
+            btree::decrement(node_, pos_);
+            return temp;
+        }
+
+        SFL_NODISCARD
+        friend bool operator==(const iterator& x, const iterator& y) noexcept
+        {
+            return x.node_ == y.node_ && x.pos_ == y.pos_;
+        }
+
+        SFL_NODISCARD
+        friend bool operator!=(const iterator& x, const iterator& y) noexcept
+        {
+            return !(x == y);
+        }
+    };
+
+    class const_iterator
+    {
+        #ifdef SFL_TEST_BTREE
+        template <int>
+        friend void ::test_btree();
+        #endif
+
+        friend class btree;
+
+    public:
+
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = Value;
+        using pointer           = const Value*;
+        using reference         = const Value&;
+        using iterator_category = std::bidirectional_iterator_tag;
+
+    private:
+
+        node_pointer node_;
+
+        size_type pos_;
+
+    private:
+
+        explicit const_iterator(node_pointer x, size_type pos) noexcept
+            : node_(x)
+            , pos_(pos)
+        {}
+
+    public:
+
+        // Default constructor
+        const_iterator() noexcept
+            : node_(nullptr)
+            , pos_(0)
+        {}
+
+        // Copy constructor
+        const_iterator(const const_iterator& other) noexcept
+            : node_(other.node_)
+            , pos_(other.pos_)
+        {}
+
+        // Converting constructor (from iterator to const_iterator)
+        const_iterator(const iterator& other) noexcept
+            : node_(other.node_)
+            , pos_(other.pos_)
+        {}
+
+        // Copy assignment operator
+        const_iterator& operator=(const const_iterator& other) noexcept
+        {
+            node_ = other.node_;
+            pos_ = other.pos_;
+            return *this;
+        }
+
+        SFL_NODISCARD
+        reference operator*() const noexcept
+        {
+            return node_->values_[pos_];
+        }
+
+        SFL_NODISCARD
+        pointer operator->() const noexcept
+        {
+            return node_->values_ + pos_;
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            btree::increment(node_, pos_);
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            btree::increment(node_, pos_);
+            return temp;
+        }
+
+        const_iterator& operator--() noexcept
+        {
+            btree::decrement(node_, pos_);
+            return *this;
+        }
+
+        const_iterator operator--(int) noexcept
+        {
+            auto temp = *this;
+            btree::decrement(node_, pos_);
+            return temp;
+        }
+
+        SFL_NODISCARD
+        friend bool operator==(const const_iterator& x, const const_iterator& y) noexcept
+        {
+            return x.node_ == y.node_ && x.pos_ == y.pos_;
+        }
+
+        SFL_NODISCARD
+        friend bool operator!=(const const_iterator& x, const const_iterator& y) noexcept
+        {
+            return !(x == y);
+        }
+    };
+
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+private:
+
+    class data
+        : public key_compare
+        , public node_allocator_type
+        , public internal_node_allocator_type
+    {
+    public:
+
+        node_pointer root_;
+
+        // Leaf that holds the smallest value.
+        node_pointer leftmost_;
+
+        // Leaf that holds the largest value. Past-the-end iterator points
+        // to the position after the last value in this node.
+        node_pointer rightmost_;
+
+        size_type size_;
+
+        void reset() noexcept
+        {
+            root_ = nullptr;
+            leftmost_ = nullptr;
+            rightmost_ = nullptr;
+            size_ = 0;
+        }
+
+    public:
+
+        data()
+            : key_compare()
+            , node_allocator_type()
+            , internal_node_allocator_type()
+        {
+            reset();
+        }
+
+        data(const key_compare& comp)
+            : key_compare(comp)
+            , node_allocator_type()
+            , internal_node_allocator_type()
+        {
+            reset();
+        }
+
+        template <typename Alloc>
+        data(const Alloc& alloc)
+            : key_compare()
+            , node_allocator_type(alloc)
+            , internal_node_allocator_type(alloc)
+        {
+            reset();
+        }
+
+        template <typename Alloc>
+        data(const key_compare& comp, const Alloc& alloc)
+            : key_compare(comp)
+            , node_allocator_type(alloc)
+            , internal_node_allocator_type(alloc)
+        {
+            reset();
+        }
+
+        data(const data& other)
+            : key_compare(other.ref_to_key_compare())
+            , node_allocator_type(sfl::dtl::allocator_traits<node_allocator_type>::select_on_container_copy_construction(other.ref_to_node_alloc()))
+            , internal_node_allocator_type(sfl::dtl::allocator_traits<internal_node_allocator_type>::select_on_container_copy_construction(other.ref_to_internal_node_alloc()))
+        {
+            reset();
+        }
+
+        template <typename Alloc>
+        data(const data& other, const Alloc& alloc)
+            : key_compare(other.ref_to_key_compare())
+            , node_allocator_type(alloc)
+            , internal_node_allocator_type(alloc)
+        {
+            reset();
+        }
+
+        data(data&& other)
+            : key_compare(std::move(other.ref_to_key_compare()))
+            , node_allocator_type(std::move(other.ref_to_node_alloc()))
+            , internal_node_allocator_type(std::move(other.ref_to_internal_node_alloc()))
+        {
+            reset();
+        }
+
+        template <typename Alloc>
+        data(data&& other, const Alloc& alloc)
+            : key_compare(std::move(other.ref_to_key_compare()))
+            , node_allocator_type(alloc)
+            , internal_node_allocator_type(alloc)
+        {
+            reset();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        key_compare& ref_to_key_compare()
+        {
+            return *this;
+        }
+
+        const key_compare& ref_to_key_compare() const
+        {
+            return *this;
+        }
+
+        node_allocator_type& ref_to_node_alloc()
+        {
+            return *this;
+        }
+
+        const node_allocator_type& ref_to_node_alloc() const
+        {
+            return *this;
+        }
+
+        internal_node_allocator_type& ref_to_internal_node_alloc()
+        {
+            return *this;
+        }
+
+        const internal_node_allocator_type& ref_to_internal_node_alloc() const
+        {
+            return *this;
+        }
+    };
+
+    mutable data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    btree()
+    {}
+
+    btree(const KeyCompare& comp)
+        : data_(comp)
+    {}
+
+    template <typename Alloc>
+    btree(const Alloc& alloc)
+        : data_(alloc)
+    {}
+
+    template <typename Alloc>
+    btree(const KeyCompare& comp, const Alloc& alloc)
+        : data_(comp, alloc)
+    {}
+
+    btree(const btree& other)
+        : data_(other.data_)
+    {
+        initialize_copy(other);
+    }
+
+    template <typename Alloc>
+    btree(const btree& other, const Alloc& alloc)
+        : data_(other.data_, alloc)
+    {
+        initialize_copy(other);
+    }
+
+    btree(btree&& other)
+        : data_(std::move(other.data_))
+    {
+        initialize_move(other);
+    }
+
+    template <typename Alloc>
+    btree(btree&& other, const Alloc& alloc)
+        : data_(std::move(other.data_), alloc)
+    {
+        initialize_move(other);
+    }
+
+    ~btree()
+    {
+        if (data_.root_ != nullptr)
+        {
+            clear(data_.root_);
+        }
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    // This is deleted. Use `assign_copy` instead.
+    btree& operator=(const btree& other) = delete;
+
+    // This is deleted. Use `assign_move` instead.
+    btree& operator=(btree&& other) = delete;
+
+    void assign_copy(const btree& other)
+    {
+        assign_copy_impl(other);
+    }
+
+    void assign_move(btree& other)
+    {
+        assign_move_impl(other);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign_range_unique(InputIt first, InputIt last)
+    {
+        clear();
+
+        while (first != last)
+        {
+            insert_hint_unique(cend(), *first);
+            ++first;
+        }
+    }
+
+    //
+    // ---- KEY COMPARE -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_compare& ref_to_key_compare() noexcept
+    {
+        return data_.ref_to_key_compare();
+    }
+
+    SFL_NODISCARD
+    const key_compare& ref_to_key_compare() const noexcept
+    {
+        return data_.ref_to_key_compare();
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    node_allocator_type& ref_to_node_alloc() noexcept
+    {
+        return data_.ref_to_node_alloc();
+    }
+
+    SFL_NODISCARD
+    const node_allocator_type& ref_to_node_alloc() const noexcept
+    {
+        return data_.ref_to_node_alloc();
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return iterator(data_.leftmost_, 0);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.leftmost_, 0);
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(data_.leftmost_, 0);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return iterator(data_.rightmost_, end_pos());
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return const_iterator(data_.rightmost_, end_pos());
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(data_.rightmost_, end_pos());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return sfl::dtl::allocator_traits<node_allocator_type>::max_size(data_.ref_to_node_alloc());
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear()
+    {
+        if (data_.root_ != nullptr)
+        {
+            clear(data_.root_);
+        }
+
+        data_.reset();
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace_unique(Args&&... args)
+    {
+        sfl::dtl::optional_value<value_type> temp;
+
+        sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), temp.ptr(), std::forward<Args>(args)...);
+
+        SFL_TRY
+        {
+            auto res = insert_unique(std::move(temp.ref()));
+            sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), temp.ptr());
+            return res;
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), temp.ptr());
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename... Args>
+    iterator emplace_hint_unique(const_iterator hint, Args&&... args)
+    {
+        sfl::dtl::optional_value<value_type> temp;
+
+        sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), temp.ptr(), std::forward<Args>(args)...);
+
+        SFL_TRY
+        {
+            auto res = insert_hint_unique(hint, std::move(temp.ref()));
+            sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), temp.ptr());
+            return res;
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), temp.ptr());
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_unique(V&& value)
+    {
+        const auto res = locate_unique(KeyOfValue()(value));
+
+        if (res.status)
+        {
+            return std::make_pair(emplace_at(res.node, res.pos, std::forward<V>(value)), true);
+        }
+        else
+        {
+            return std::make_pair(iterator(res.node, res.pos), false);
+        }
+    }
+
+    template <typename V>
+    iterator insert_hint_unique(const_iterator hint, V&& value)
+    {
+        const auto res = locate_hint_unique(hint, KeyOfValue()(value));
+
+        if (res.status)
+        {
+            return emplace_at(res.node, res.pos, std::forward<V>(value));
+        }
+        else
+        {
+            return iterator(res.node, res.pos);
+        }
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign(K&& k, M&& obj)
+    {
+        const auto res = locate_unique(k);
+
+        if (res.status)
+        {
+            iterator it = emplace_at
+            (
+                res.node,
+                res.pos,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(k)),
+                std::forward_as_tuple(std::forward<M>(obj))
+            );
+            return std::make_pair(it, true);
+        }
+        else
+        {
+            iterator it(res.node, res.pos);
+            it->second = std::forward<M>(obj);
+            return std::make_pair(it, false);
+        }
+    }
+
+    template <typename K, typename M>
+    iterator insert_or_assign_hint(const_iterator hint, K&& k, M&& obj)
+    {
+        const auto res = locate_hint_unique(hint, k);
+
+        if (res.status)
+        {
+            return emplace_at
+            (
+                res.node,
+                res.pos,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(k)),
+                std::forward_as_tuple(std::forward<M>(obj))
+            );
+        }
+        else
+        {
+            iterator it(res.node, res.pos);
+            it->second = std::forward<M>(obj);
+            return it;
+        }
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& k, Args&&... args)
+    {
+        const auto res = locate_unique(k);
+
+        if (res.status)
+        {
+            iterator it = emplace_at
+            (
+                res.node,
+                res.pos,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(k)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+            return std::make_pair(it, true);
+        }
+        else
+        {
+            return std::make_pair(iterator(res.node, res.pos), false);
+        }
+    }
+
+    template <typename K, typename... Args>
+    iterator try_emplace_hint(const_iterator hint, K&& k, Args&&... args)
+    {
+        const auto res = locate_hint_unique(hint, k);
+
+        if (res.status)
+        {
+            return emplace_at
+            (
+                res.node,
+                res.pos,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(k)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+        }
+        else
+        {
+            return iterator(res.node, res.pos);
+        }
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(pos.node_ != nullptr && pos.pos_ < pos.node_->count_);
+
+        node_pointer x = pos.node_;
+        size_type p = pos.pos_;
+
+        bool erased_from_internal = false;
+
+        if (x->leaf_)
+        {
+            destroy_value(x->values_ + p);
+            relocate_values(x->values_ + p + 1, x->values_ + x->count_, x->values_ + p);
+            --x->count_;
+        }
+        else
+        {
+            // Replace value with its predecessor, which is the largest value
+            // in the left subtree, and remove predecessor from its leaf.
+            node_pointer y = child(x, p);
+
+            while (!y->leaf_)
+            {
+                y = child(y, y->count_);
+            }
+
+            destroy_value(x->values_ + p);
+            relocate_values(y->values_ + y->count_ - 1, y->values_ + y->count_, x->values_ + p);
+            --y->count_;
+
+            x = y;
+            p = y->count_;
+
+            erased_from_internal = true;
+        }
+
+        --data_.size_;
+
+        if (data_.size_ == 0)
+        {
+            deallocate_node(data_.root_);
+            data_.reset();
+            return end();
+        }
+
+        rebalance_after_erase(x, p);
+
+        if (p == x->count_)
+        {
+            climb_to_next(x, p);
+        }
+
+        iterator it(x, p);
+
+        if (erased_from_internal)
+        {
+            ++it;
+        }
+
+        return it;
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        if (first == cbegin() && last == cend())
+        {
+            clear();
+            return end();
+        }
+
+        // Erasure invalidates all iterators, including `last`.
+        auto n = std::distance(first, last);
+
+        iterator it(first.node_, first.pos_);
+
+        while (n > 0)
+        {
+            it = erase(it);
+            --n;
+        }
+
+        return it;
+    }
+
+    template <typename K>
+    size_type erase_key_unique(const K& k)
+    {
+        auto it = find(k);
+
+        if (it != end())
+        {
+            erase(it);
+            return 1;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+
+    void swap(btree& other)
+    {
+        swap_impl(other);
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator lower_bound(const K& k)
+    {
+        node_pointer x;
+        size_type p;
+        lower_bound_aux(k, x, p);
+        return iterator(x, p);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator lower_bound(const K& k) const
+    {
+        node_pointer x;
+        size_type p;
+        lower_bound_aux(k, x, p);
+        return const_iterator(x, p);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator upper_bound(const K& k)
+    {
+        node_pointer x;
+        size_type p;
+        upper_bound_aux(k, x, p);
+        return iterator(x, p);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator upper_bound(const K& k) const
+    {
+        node_pointer x;
+        size_type p;
+        upper_bound_aux(k, x, p);
+        return const_iterator(x, p);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const K& k)
+    {
+        return std::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const K& k) const
+    {
+        return std::make_pair(lower_bound(k), upper_bound(k));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator find(const K& k)
+    {
+        node_pointer x;
+        size_type p;
+        find_aux(k, x, p);
+        return iterator(x, p);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator find(const K& k) const
+    {
+        node_pointer x;
+        size_type p;
+        find_aux(k, x, p);
+        return const_iterator(x, p);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    size_type count_unique(const K& k) const
+    {
+        return find(k) != end();
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    bool contains(const K& k) const
+    {
+        return find(k) != end();
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    SFL_NODISCARD
+    size_type end_pos() const noexcept
+    {
+        return data_.rightmost_ != nullptr ? data_.rightmost_->count_ : 0;
+    }
+
+    SFL_NODISCARD
+    static node_pointer& child(node_pointer x, size_type i) noexcept
+    {
+        SFL_ASSERT(!x->leaf_);
+        return static_cast<internal_node_pointer>(x)->children_[i];
+    }
+
+    SFL_NODISCARD
+    static const Key& key_of(node_pointer x, size_type i) noexcept
+    {
+        return KeyOfValue()(x->values_[i]);
+    }
+
+    void set_child(node_pointer parent, size_type i, node_pointer x) noexcept
+    {
+        child(parent, i) = x;
+        x->parent_ = parent;
+        x->position_ = static_cast<unsigned char>(i);
+    }
+
+    // Moves from position after the last value of a node to the next value
+    // in ancestors. Stays at past-the-end position if there is no next value.
+    static void climb_to_next(node_pointer& node, size_type& pos) noexcept
+    {
+        node_pointer x = node;
+        size_type p = pos;
+
+        while (p == x->count_ && x->parent_ != nullptr)
+        {
+            p = x->position_;
+            x = x->parent_;
+        }
+
+        if (p < x->count_)
+        {
+            node = x;
+            pos = p;
+        }
+    }
+
+    static void increment(node_pointer& node, size_type& pos) noexcept
+    {
+        SFL_ASSERT(node != nullptr);
+
+        if (node->leaf_)
+        {
+            ++pos;
+
+            if (pos == node->count_)
+            {
+                climb_to_next(node, pos);
+            }
+        }
+        else
+        {
+            node = child(node, pos + 1);
+
+            while (!node->leaf_)
+            {
+                node = child(node, 0);
+            }
+
+            pos = 0;
+        }
+    }
+
+    static void decrement(node_pointer& node, size_type& pos) noexcept
+    {
+        SFL_ASSERT(node != nullptr);
+
+        if (node->leaf_)
+        {
+            if (pos > 0)
+            {
+                --pos;
+            }
+            else
+            {
+                node_pointer x = node;
+                size_type p = 0;
+
+                while (p == 0 && x->parent_ != nullptr)
+                {
+                    p = x->position_;
+                    x = x->parent_;
+                }
+
+                SFL_ASSERT(p > 0);
+
+                node = x;
+                pos = p - 1;
+            }
+        }
+        else
+        {
+            node = child(node, pos);
+
+            while (!node->leaf_)
+            {
+                node = child(node, node->count_);
+            }
+
+            pos = node->count_ - 1;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Position of the first value in node that is not less than `k`.
+    template <typename K>
+    size_type lower_bound_in_node(node_pointer x, const K& k) const
+    {
+        size_type first = 0;
+        size_type count = x->count_;
+
+        while (count > 0)
+        {
+            const size_type step = count / 2;
+
+            if (data_.ref_to_key_compare()(key_of(x, first + step), k))
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    // Position of the first value in node that is greater than `k`.
+    template <typename K>
+    size_type upper_bound_in_node(node_pointer x, const K& k) const
+    {
+        size_type first = 0;
+        size_type count = x->count_;
+
+        while (count > 0)
+        {
+            const size_type step = count / 2;
+
+            if (!data_.ref_to_key_compare()(k, key_of(x, first + step)))
+            {
+                first += step + 1;
+                count -= step + 1;
+            }
+            else
+            {
+                count = step;
+            }
+        }
+
+        return first;
+    }
+
+    template <typename K>
+    void lower_bound_aux(const K& k, node_pointer& node, size_type& pos) const
+    {
+        if (data_.root_ == nullptr)
+        {
+            node = nullptr;
+            pos = 0;
+            return;
+        }
+
+        node_pointer x = data_.root_;
+
+        while (true)
+        {
+            const size_type p = lower_bound_in_node(x, k);
+
+            if (x->leaf_)
+            {
+                node = x;
+                pos = p;
+                break;
+            }
+
+            x = child(x, p);
+        }
+
+        if (pos == node->count_)
+        {
+            climb_to_next(node, pos);
+        }
+    }
+
+    template <typename K>
+    void upper_bound_aux(const K& k, node_pointer& node, size_type& pos) const
+    {
+        if (data_.root_ == nullptr)
+        {
+            node = nullptr;
+            pos = 0;
+            return;
+        }
+
+        node_pointer x = data_.root_;
+
+        while (true)
+        {
+            const size_type p = upper_bound_in_node(x, k);
+
+            if (x->leaf_)
+            {
+                node = x;
+                pos = p;
+                break;
+            }
+
+            x = child(x, p);
+        }
+
+        if (pos == node->count_)
+        {
+            climb_to_next(node, pos);
+        }
+    }
+
+    template <typename K>
+    void find_aux(const K& k, node_pointer& node, size_type& pos) const
+    {
+        node_pointer x = data_.root_;
+
+        while (x != nullptr)
+        {
+            const size_type p = lower_bound_in_node(x, k);
+
+            if (p < x->count_ && !data_.ref_to_key_compare()(k, key_of(x, p)))
+            {
+                node = x;
+                pos = p;
+                return;
+            }
+
+            if (x->leaf_)
+            {
+                break;
+            }
+
+            x = child(x, p);
+        }
+
+        node = data_.rightmost_;
+        pos = end_pos();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    struct position_for_insert_unique
+    {
+        node_pointer node;
+        size_type pos;
+        bool status;
+    };
+
+    // If tree contains value with key equivalent to `k` then returns position
+    // of that value and `status` is false. Otherwise returns position in leaf
+    // where new value should be inserted and `status` is true.
+    template <typename K>
+    position_for_insert_unique locate_unique(const K& k) const
+    {
+        node_pointer x = data_.root_;
+
+        if (x == nullptr)
+        {
+            return position_for_insert_unique{nullptr, 0, true};
+        }
+
+        while (true)
+        {
+            const size_type p = lower_bound_in_node(x, k);
+
+            if (p < x->count_ && !data_.ref_to_key_compare()(k, key_of(x, p)))
+            {
+                return position_for_insert_unique{x, p, false};
+            }
+
+            if (x->leaf_)
+            {
+                return position_for_insert_unique{x, p, true};
+            }
+
+            x = child(x, p);
+        }
+    }
+
+    template <typename K>
+    position_for_insert_unique locate_hint_unique(const_iterator hint, const K& k) const
+    {
+        if (data_.root_ == nullptr)
+        {
+            return position_for_insert_unique{nullptr, 0, true};
+        }
+
+        // Insert before hint if `prev(hint) < k < hint`.
+        if (hint == cend() || data_.ref_to_key_compare()(k, KeyOfValue()(*hint)))
+        {
+            if (hint == cbegin())
+            {
+                return position_for_insert_unique{data_.leftmost_, 0, true};
+            }
+
+            const_iterator prev = hint;
+            --prev;
+
+            if (data_.ref_to_key_compare()(KeyOfValue()(*prev), k))
+            {
+                if (hint.node_->leaf_)
+                {
+                    return position_for_insert_unique{hint.node_, hint.pos_, true};
+                }
+                else
+                {
+                    // Predecessor of a value in internal node is in leaf.
+                    return position_for_insert_unique{prev.node_, prev.pos_ + 1, true};
+                }
+            }
+        }
+        else if (!data_.ref_to_key_compare()(KeyOfValue()(*hint), k))
+        {
+            return position_for_insert_unique{hint.node_, hint.pos_, false};
+        }
+
+        return locate_unique(k);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Inserts new value at given position in leaf. Splits full nodes on the
+    // way. Returns iterator to the inserted value.
+    template <typename... Args>
+    iterator emplace_at(node_pointer x, size_type p, Args&&... args)
+    {
+        if (x == nullptr)
+        {
+            SFL_ASSERT(data_.root_ == nullptr);
+            x = allocate_leaf();
+            data_.root_ = x;
+            data_.leftmost_ = x;
+            data_.rightmost_ = x;
+            p = 0;
+        }
+
+        SFL_ASSERT(x->leaf_);
+
+        if (x->count_ == node_capacity)
+        {
+            node_pointer y = split(x);
+
+            if (p > node_capacity / 2)
+            {
+                x = y;
+                p -= node_capacity / 2 + 1;
+            }
+        }
+
+        relocate_values(x->values_ + p, x->values_ + x->count_, x->values_ + p + 1);
+
+        SFL_TRY
+        {
+            sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), x->values_ + p, std::forward<Args>(args)...);
+        }
+        SFL_CATCH (...)
+        {
+            relocate_values(x->values_ + p + 1, x->values_ + x->count_ + 1, x->values_ + p);
+
+            if (data_.size_ == 0)
+            {
+                deallocate_node(x);
+                data_.reset();
+            }
+
+            SFL_RETHROW;
+        }
+
+        ++x->count_;
+        ++data_.size_;
+
+        return iterator(x, p);
+    }
+
+    // Splits full node into two nodes and moves the middle value into parent.
+    // Splits parent first if it is full. Returns new right sibling.
+    node_pointer split(node_pointer x)
+    {
+        SFL_ASSERT(x->count_ == node_capacity);
+
+        if (x->parent_ != nullptr && x->parent_->count_ == node_capacity)
+        {
+            split(x->parent_);
+        }
+
+        node_pointer y = x->leaf_ ? allocate_leaf() : allocate_internal();
+
+        if (x->parent_ == nullptr)
+        {
+            node_pointer root;
+
+            SFL_TRY
+            {
+                root = allocate_internal();
+            }
+            SFL_CATCH (...)
+            {
+                deallocate_node(y);
+                SFL_RETHROW;
+            }
+
+            set_child(root, 0, x);
+            data_.root_ = root;
+        }
+
+        const size_type mid = node_capacity / 2;
+
+        node_pointer parent = x->parent_;
+        const size_type pp = x->position_;
+
+        // Values (mid, capacity) go to the new node.
+        relocate_values(x->values_ + mid + 1, x->values_ + node_capacity, y->values_);
+        y->count_ = static_cast<unsigned char>(node_capacity - mid - 1);
+
+        if (!x->leaf_)
+        {
+            for (size_type i = mid + 1; i <= node_capacity; ++i)
+            {
+                set_child(y, i - mid - 1, child(x, i));
+            }
+        }
+
+        // Middle value goes to parent.
+        relocate_values(parent->values_ + pp, parent->values_ + parent->count_, parent->values_ + pp + 1);
+        relocate_values(x->values_ + mid, x->values_ + mid + 1, parent->values_ + pp);
+
+        for (size_type i = parent->count_; i > pp; --i)
+        {
+            set_child(parent, i + 1, child(parent, i));
+        }
+
+        set_child(parent, pp + 1, y);
+
+        ++parent->count_;
+        x->count_ = static_cast<unsigned char>(mid);
+
+        if (data_.rightmost_ == x)
+        {
+            data_.rightmost_ = y;
+        }
+
+        return y;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Restores minimum number of values in nodes after erasure from leaf
+    // `x`. Position `p` in `x` is updated if values are moved.
+    void rebalance_after_erase(node_pointer& x, size_type& p) noexcept
+    {
+        node_pointer n = x;
+        bool first = true;
+
+        while (n->parent_ != nullptr && n->count_ < min_count)
+        {
+            node_pointer parent = n->parent_;
+            const size_type i = n->position_;
+
+            if (i > 0)
+            {
+                node_pointer left = child(parent, i - 1);
+
+                if (left->count_ > min_count)
+                {
+                    const size_type k = (left->count_ - n->count_) / 2;
+                    rotate_right(parent, i - 1, k);
+                    if (first)
+                    {
+                        p += k;
+                    }
+                    break;
+                }
+
+                const size_type left_count = left->count_;
+                merge(parent, i - 1);
+                if (first)
+                {
+                    x = left;
+                    p += left_count + 1;
+                }
+            }
+            else
+            {
+                node_pointer right = child(parent, 1);
+
+                if (right->count_ > min_count)
+                {
+                    const size_type k = (right->count_ - n->count_) / 2;
+                    rotate_left(parent, 0, k);
+                    break;
+                }
+
+                merge(parent, 0);
+            }
+
+            n = parent;
+            first = false;
+        }
+
+        node_pointer root = data_.root_;
+
+        if (root->count_ == 0 && !root->leaf_)
+        {
+            data_.root_ = child(root, 0);
+            data_.root_->parent_ = nullptr;
+            data_.root_->position_ = 0;
+            deallocate_node(root);
+        }
+    }
+
+    // Moves `k` values from child `i` to child `i + 1` through parent.
+    void rotate_right(node_pointer parent, size_type i, size_type k) noexcept
+    {
+        node_pointer left = child(parent, i);
+        node_pointer right = child(parent, i + 1);
+
+        SFL_ASSERT(k > 0 && k < left->count_);
+
+        relocate_values(right->values_, right->values_ + right->count_, right->values_ + k);
+        relocate_values(parent->values_ + i, parent->values_ + i + 1, right->values_ + k - 1);
+        relocate_values(left->values_ + left->count_ - k + 1, left->values_ + left->count_, right->values_);
+        relocate_values(left->values_ + left->count_ - k, left->values_ + left->count_ - k + 1, parent->values_ + i);
+
+        if (!left->leaf_)
+        {
+            for (size_type j = right->count_ + 1; j > 0; --j)
+            {
+                set_child(right, j - 1 + k, child(right, j - 1));
+            }
+
+            for (size_type j = 0; j < k; ++j)
+            {
+                set_child(right, j, child(left, left->count_ - k + 1 + j));
+            }
+        }
+
+        left->count_ = static_cast<unsigned char>(left->count_ - k);
+        right->count_ = static_cast<unsigned char>(right->count_ + k);
+    }
+
+    // Moves `k` values from child `i + 1` to child `i` through parent.
+    void rotate_left(node_pointer parent, size_type i, size_type k) noexcept
+    {
+        node_pointer left = child(parent, i);
+        node_pointer right = child(parent, i + 1);
+
+        SFL_ASSERT(k > 0 && k < right->count_);
+
+        relocate_values(parent->values_ + i, parent->values_ + i + 1, left->values_ + left->count_);
+        relocate_values(right->values_, right->values_ + k - 1, left->values_ + left->count_ + 1);
+        relocate_values(right->values_ + k - 1, right->values_ + k, parent->values_ + i);
+        relocate_values(right->values_ + k, right->values_ + right->count_, right->values_);
+
+        if (!left->leaf_)
+        {
+            for (size_type j = 0; j < k; ++j)
+            {
+                set_child(left, left->count_ + 1 + j, child(right, j));
+            }
+
+            for (size_type j = k; j <= right->count_; ++j)
+            {
+                set_child(right, j - k, child(right, j));
+            }
+        }
+
+        left->count_ = static_cast<unsigned char>(left->count_ + k);
+        right->count_ = static_cast<unsigned char>(right->count_ - k);
+    }
+
+    // Merges child `i + 1` and separator `i` into child `i`.
+    void merge(node_pointer parent, size_type i) noexcept
+    {
+        node_pointer left = child(parent, i);
+        node_pointer right = child(parent, i + 1);
+
+        SFL_ASSERT(left->count_ + right->count_ + 1u <= node_capacity);
+
+        relocate_values(parent->values_ + i, parent->values_ + i + 1, left->values_ + left->count_);
+        relocate_values(right->values_, right->values_ + right->count_, left->values_ + left->count_ + 1);
+
+        if (!left->leaf_)
+        {
+            for (size_type j = 0; j <= right->count_; ++j)
+            {
+                set_child(left, left->count_ + 1 + j, child(right, j));
+            }
+        }
+
+        left->count_ = static_cast<unsigned char>(left->count_ + 1 + right->count_);
+
+        relocate_values(parent->values_ + i + 1, parent->values_ + parent->count_, parent->values_ + i);
+
+        for (size_type j = i + 2; j <= parent->count_; ++j)
+        {
+            set_child(parent, j - 1, child(parent, j));
+        }
+
+        --parent->count_;
+
+        if (data_.rightmost_ == right)
+        {
+            data_.rightmost_ = left;
+        }
+
+        right->count_ = 0;
+        deallocate_node(right);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Moves values from [first, last) to uninitialized storage starting at
+    // `d_first` and destroys source values. Ranges can overlap.
+    void relocate_values(value_type* first, value_type* last, value_type* d_first) noexcept
+    {
+        relocate_values
+        (
+            first,
+            last,
+            d_first,
+            sfl::dtl::is_trivially_relocatable_a<allocator_type>()
+        );
+    }
+
+    void relocate_values(value_type* first, value_type* last, value_type* d_first, std::true_type) noexcept
+    {
+        if (first != last)
+        {
+            std::memmove
+            (
+                static_cast<void*>(d_first),
+                static_cast<const void*>(first),
+                (last - first) * sizeof(value_type)
+            );
+        }
+    }
+
+    void relocate_values(value_type* first, value_type* last, value_type* d_first, std::false_type) noexcept
+    {
+        if (d_first <= first)
+        {
+            while (first != last)
+            {
+                sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), d_first, std::move(*first));
+                sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), first);
+                ++first;
+                ++d_first;
+            }
+        }
+        else
+        {
+            value_type* d_last = d_first + (last - first);
+
+            while (first != last)
+            {
+                --last;
+                --d_last;
+                sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), d_last, std::move(*last));
+                sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), last);
+            }
+        }
+    }
+
+    void destroy_value(value_type* p) noexcept
+    {
+        sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), p);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    node_pointer allocate_leaf()
+    {
+        node_pointer p = sfl::dtl::allocator_traits<node_allocator_type>::allocate
+        (
+            data_.ref_to_node_alloc(),
+            1
+        );
+
+        sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), p);
+
+        return p;
+    }
+
+    node_pointer allocate_internal()
+    {
+        internal_node_pointer p = sfl::dtl::allocator_traits<internal_node_allocator_type>::allocate
+        (
+            data_.ref_to_internal_node_alloc(),
+            1
+        );
+
+        sfl::dtl::construct_at_a(data_.ref_to_internal_node_alloc(), p);
+
+        return p;
+    }
+
+    // Deallocates node. Values must be destroyed before.
+    void deallocate_node(node_pointer x) noexcept
+    {
+        if (x->leaf_)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_node_alloc(), x);
+
+            sfl::dtl::allocator_traits<node_allocator_type>::deallocate
+            (
+                data_.ref_to_node_alloc(),
+                x,
+                1
+            );
+        }
+        else
+        {
+            internal_node_pointer y = static_cast<internal_node_pointer>(x);
+
+            sfl::dtl::destroy_at_a(data_.ref_to_internal_node_alloc(), y);
+
+            sfl::dtl::allocator_traits<internal_node_allocator_type>::deallocate
+            (
+                data_.ref_to_internal_node_alloc(),
+                y,
+                1
+            );
+        }
+    }
+
+    // Destroys all values in subtree and deallocates its nodes.
+    void clear(node_pointer x) noexcept
+    {
+        if (!x->leaf_)
+        {
+            for (size_type i = 0; i <= x->count_; ++i)
+            {
+                clear(child(x, i));
+            }
+        }
+
+        for (size_type i = 0; i < x->count_; ++i)
+        {
+            destroy_value(x->values_ + i);
+        }
+
+        deallocate_node(x);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void construct_value_from(value_type* p, value_type& src, std::true_type /*move*/)
+    {
+        sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), p, std::move(src));
+    }
+
+    void construct_value_from(value_type* p, value_type& src, std::false_type /*move*/)
+    {
+        sfl::dtl::construct_at_a(data_.ref_to_node_alloc(), p, const_cast<const value_type&>(src));
+    }
+
+    // Creates copy of subtree with the same shape. Values are moved if
+    // `Move` is true, otherwise they are copied.
+    template <bool Move>
+    node_pointer clone(node_pointer src)
+    {
+        node_pointer x = src->leaf_ ? allocate_leaf() : allocate_internal();
+
+        size_type n_children = 0;
+
+        SFL_TRY
+        {
+            while (x->count_ < src->count_)
+            {
+                construct_value_from
+                (
+                    x->values_ + x->count_,
+                    src->values_[x->count_],
+                    std::integral_constant<bool, Move>()
+                );
+
+                ++x->count_;
+            }
+
+            if (!x->leaf_)
+            {
+                while (n_children <= size_type(src->count_))
+                {
+                    set_child(x, n_children, clone<Move>(child(src, n_children)));
+                    ++n_children;
+                }
+            }
+        }
+        SFL_CATCH (...)
+        {
+            for (size_type i = 0; i < n_children; ++i)
+            {
+                clear(child(x, i));
+            }
+
+            for (size_type i = 0; i < x->count_; ++i)
+            {
+                destroy_value(x->values_ + i);
+            }
+
+            deallocate_node(x);
+
+            SFL_RETHROW;
+        }
+
+        return x;
+    }
+
+    template <bool Move>
+    void clone_from(const btree& other)
+    {
+        SFL_ASSERT(data_.root_ == nullptr);
+
+        if (other.data_.root_ != nullptr)
+        {
+            node_pointer root = clone<Move>(other.data_.root_);
+
+            node_pointer leftmost = root;
+
+            while (!leftmost->leaf_)
+            {
+                leftmost = child(leftmost, 0);
+            }
+
+            node_pointer rightmost = root;
+
+            while (!rightmost->leaf_)
+            {
+                rightmost = child(rightmost, rightmost->count_);
+            }
+
+            data_.root_ = root;
+            data_.leftmost_ = leftmost;
+            data_.rightmost_ = rightmost;
+            data_.size_ = other.data_.size_;
+        }
+    }
+
+    // Moves all values from other tree to this tree one-by-one. Other tree
+    // keeps moved-from values.
+    void move_elements_from(btree& other)
+    {
+        SFL_ASSERT(data_.root_ == nullptr);
+        clone_from<true>(other);
+    }
+
+    void steal_data_from(btree& other) noexcept
+    {
+        data_.root_ = other.data_.root_;
+        data_.leftmost_ = other.data_.leftmost_;
+        data_.rightmost_ = other.data_.rightmost_;
+        data_.size_ = other.data_.size_;
+        other.data_.reset();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void initialize_copy(const btree& other)
+    {
+        clone_from<false>(other);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void initialize_move(btree& other)
+    {
+        initialize_move
+        (
+            other,
+            typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable()
+        );
+    }
+
+    void initialize_move(btree& other, std::true_type)
+    {
+        move_elements_from(other);
+    }
+
+    void initialize_move(btree& other, std::false_type)
+    {
+        initialize_move
+        (
+            other,
+            std::false_type(),
+            typename sfl::dtl::allocator_traits<node_allocator_type>::is_always_equal()
+        );
+    }
+
+    void initialize_move(btree& other, std::false_type, std::true_type)
+    {
+        steal_data_from(other);
+    }
+
+    void initialize_move(btree& other, std::false_type, std::false_type)
+    {
+        if (data_.ref_to_node_alloc() == other.data_.ref_to_node_alloc())
+        {
+            initialize_move(other, std::false_type(), std::true_type());
+        }
+        else
+        {
+            initialize_move(other, std::true_type());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void assign_copy_impl(const btree& other)
+    {
+        if (this != &other)
+        {
+            // Copy function. May throw exception. No effects if throw.
+            data_.ref_to_key_compare() = other.data_.ref_to_key_compare();
+
+            // Drop values (noexcept)
+            clear();
+
+            // Copy allocators (noexcept)
+            if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_copy_assignment::value)
+            {
+                data_.ref_to_node_alloc() = other.data_.ref_to_node_alloc();
+                data_.ref_to_internal_node_alloc() = other.data_.ref_to_internal_node_alloc();
+            }
+
+            // Copy nodes. May throw exception.
+            clone_from<false>(other);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void assign_move_impl(btree& other)
+    {
+        assign_move_impl
+        (
+            other,
+            typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable()
+        );
+    }
+
+    void assign_move_impl(btree& other, std::true_type)
+    {
+        // Move function. May throw exception. No effects if throw.
+        data_.ref_to_key_compare() = std::move(other.data_.ref_to_key_compare());
+
+        // Drop values (noexcept)
+        clear();
+
+        // Move allocators (noexcept)
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_move_assignment::value)
+        {
+            data_.ref_to_node_alloc() = std::move(other.data_.ref_to_node_alloc());
+            data_.ref_to_internal_node_alloc() = std::move(other.data_.ref_to_internal_node_alloc());
+        }
+
+        // Move values one-by-one. May throw exception.
+        move_elements_from(other);
+    }
+
+    void assign_move_impl(btree& other, std::false_type)
+    {
+        assign_move_impl
+        (
+            other,
+            std::false_type(),
+            typename sfl::dtl::disjunction
+            <
+                typename sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_move_assignment,
+                typename sfl::dtl::allocator_traits<node_allocator_type>::is_always_equal
+            >()
+        );
+    }
+
+    void assign_move_impl(btree& other, std::false_type, std::true_type)
+    {
+        // Move function. May throw exception. No effects if throw.
+        data_.ref_to_key_compare() = std::move(other.data_.ref_to_key_compare());
+
+        // Drop values (noexcept)
+        clear();
+
+        // Move allocators (noexcept)
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_move_assignment::value)
+        {
+            data_.ref_to_node_alloc() = std::move(other.data_.ref_to_node_alloc());
+            data_.ref_to_internal_node_alloc() = std::move(other.data_.ref_to_internal_node_alloc());
+        }
+
+        // Steal data (noexcept)
+        steal_data_from(other);
+    }
+
+    void assign_move_impl(btree& other, std::false_type, std::false_type)
+    {
+        if (data_.ref_to_node_alloc() == other.data_.ref_to_node_alloc())
+        {
+            assign_move_impl(other, std::false_type(), std::true_type());
+        }
+        else
+        {
+            assign_move_impl(other, std::true_type());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void swap_impl(btree& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        swap_impl
+        (
+            other,
+            typename sfl::dtl::allocator_traits<node_allocator_type>::is_partially_propagable()
+        );
+    }
+
+    void swap_impl(btree& other, std::true_type)
+    {
+        using std::swap;
+
+        // Swap functions. May throw exception. No effects if thrown.
+        swap(data_.ref_to_key_compare(), other.data_.ref_to_key_compare());
+
+        // Nodes can be stored in internal storage of allocators, so values
+        // are moved one-by-one through temporary tree. May throw exception.
+        btree temp(data_.ref_to_node_alloc());
+
+        temp.move_elements_from(*this);
+        this->clear();
+
+        // Take allocator of other tree while this tree is empty (noexcept)
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_swap::value)
+        {
+            data_.ref_to_node_alloc() = other.data_.ref_to_node_alloc();
+            data_.ref_to_internal_node_alloc() = other.data_.ref_to_internal_node_alloc();
+        }
+
+        this->move_elements_from(other);
+        other.clear();
+
+        // Give allocator of this tree to other tree, now empty (noexcept)
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_swap::value)
+        {
+            other.data_.ref_to_node_alloc() = temp.data_.ref_to_node_alloc();
+            other.data_.ref_to_internal_node_alloc() = temp.data_.ref_to_internal_node_alloc();
+        }
+
+        other.move_elements_from(temp);
+    }
+
+    void swap_impl(btree& other, std::false_type)
+    {
+        swap_impl
+        (
+            other,
+            std::false_type(),
+            typename sfl::dtl::disjunction
+            <
+                typename sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_swap,
+                typename sfl::dtl::allocator_traits<node_allocator_type>::is_always_equal
+            >()
+        );
+    }
+
+    void swap_impl(btree& other, std::false_type, std::true_type)
+    {
+        using std::swap;
+
+        // Swap functions. May throw exception. No effects if thrown.
+        swap(data_.ref_to_key_compare(), other.data_.ref_to_key_compare());
+
+        // Swap allocators (noexcept)
+        if (sfl::dtl::allocator_traits<node_allocator_type>::propagate_on_container_swap::value)
+        {
+            swap(data_.ref_to_node_alloc(), other.data_.ref_to_node_alloc());
+            swap(data_.ref_to_internal_node_alloc(), other.data_.ref_to_internal_node_alloc());
+        }
+
+        // Swap data (noexcept)
+        swap(data_.root_, other.data_.root_);
+        swap(data_.leftmost_, other.data_.leftmost_);
+        swap(data_.rightmost_, other.data_.rightmost_);
+        swap(data_.size_, other.data_.size_);
+    }
+
+    void swap_impl(btree& other, std::false_type, std::false_type)
+    {
+        if (data_.ref_to_node_alloc() == other.data_.ref_to_node_alloc())
+        {
+            swap_impl(other, std::false_type(), std::true_type());
+        }
+        else
+        {
+            swap_impl(other, std::true_type());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Checks structure of the tree. Returns depth of subtree or zero on error.
+    size_type verify(node_pointer x, node_pointer parent, size_type position, const Key* lo, const Key* hi, size_type& count) const
+    {
+        if (x->parent_ != parent || x->position_ != position)
+        {
+            return 0;
+        }
+
+        if (parent != nullptr && x->count_ < min_count)
+        {
+            return 0;
+        }
+
+        if (x->count_ == 0 || x->count_ > node_capacity)
+        {
+            return 0;
+        }
+
+        for (size_type i = 0; i < x->count_; ++i)
+        {
+            if (i > 0 && !data_.ref_to_key_compare()(key_of(x, i - 1), key_of(x, i)))
+            {
+                return 0;
+            }
+
+            if (lo != nullptr && !data_.ref_to_key_compare()(*lo, key_of(x, i)))
+            {
+                return 0;
+            }
+
+            if (hi != nullptr && !data_.ref_to_key_compare()(key_of(x, i), *hi))
+            {
+                return 0;
+            }
+        }
+
+        count += x->count_;
+
+        if (x->leaf_)
+        {
+            return 1;
+        }
+
+        size_type depth = 0;
+
+        for (size_type i = 0; i <= x->count_; ++i)
+        {
+            const Key* l = i == 0 ? lo : std::addressof(key_of(x, i - 1));
+            const Key* h = i == x->count_ ? hi : std::addressof(key_of(x, i));
+
+            const size_type d = verify(child(x, i), x, i, l, h, count);
+
+            if (d == 0 || (depth != 0 && d != depth))
+            {
+                return 0;
+            }
+
+            depth = d;
+        }
+
+        return depth + 1;
+    }
+
+    bool verify() const
+    {
+        if (data_.root_ == nullptr)
+        {
+            return data_.size_ == 0
+                && data_.leftmost_ == nullptr
+                && data_.rightmost_ == nullptr
+                && begin() == end();
+        }
+
+        size_type count = 0;
+
+        if (verify(data_.root_, nullptr, 0, nullptr, nullptr, count) == 0)
+        {
+            return false;
+        }
+
+        node_pointer leftmost = data_.root_;
+
+        while (!leftmost->leaf_)
+        {
+            leftmost = child(leftmost, 0);
+        }
+
+        node_pointer rightmost = data_.root_;
+
+        while (!rightmost->leaf_)
+        {
+            rightmost = child(rightmost, rightmost->count_);
+        }
+
+        return count == data_.size_
+            && leftmost == data_.leftmost_
+            && rightmost == data_.rightmost_
+            && size_type(std::distance(begin(), end())) == data_.size_;
+    }
+};
+
+template <typename Key, typename Value, typename KeyOfValue, typename KeyCompare, typename Allocator>
+constexpr typename btree<Key, Value, KeyOfValue, KeyCompare, Allocator>::size_type
+    btree<Key, Value, KeyOfValue, KeyCompare, Allocator>::node_capacity;
+
+template <typename Key, typename Value, typename KeyOfValue, typename KeyCompare, typename Allocator>
+constexpr typename btree<Key, Value, KeyOfValue, KeyCompare, Allocator>::size_type
+    btree<Key, Value, KeyOfValue, KeyCompare, Allocator>::min_count;
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// NON-MEMBER FUNCTIONS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+SFL_NODISCARD
+bool operator==
+(
+    const btree<TP1, TP2, TP3, TP4, TP5>& x,
+    const btree<TP1, TP2, TP3, TP4, TP5>& y
+)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+SFL_NODISCARD
+bool operator!=
+(
+    const btree<TP1, TP2, TP3, TP4, TP5>& x,
+    const btree<TP1, TP2, TP3, TP4, TP5>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+SFL_NODISCARD
+bool operator<
+(
+    const btree<TP1, TP2, TP3, TP4, TP5>& x,
+    const btree<TP1, TP2, TP3, TP4, TP5>& y
+)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+SFL_NODISCARD
+bool operator>
+(
+    const btree<TP1, TP2, TP3, TP4, TP5>& x,
+    const btree<TP1, TP2, TP3, TP4, TP5>& y
+)
+{
+    return y < x;
+}
+
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+SFL_NODISCARD
+bool operator<=
+(
+    const btree<TP1, TP2, TP3, TP4, TP5>& x,
+    const btree<TP1, TP2, TP3, TP4, TP5>& y
+)
+{
+    return !(y < x);
+}
+
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+SFL_NODISCARD
+bool operator>=
+(
+    const btree<TP1, TP2, TP3, TP4, TP5>& x,
+    const btree<TP1, TP2, TP3, TP4, TP5>& y
+)
+{
+    return !(x < y);
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_BTREE_HPP_INCLUDED
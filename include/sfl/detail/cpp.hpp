@@ -57,4 +57,19 @@
     #define SFL_RETHROW  throw
 #endif
 
+#if !defined(SFL_NO_SIMD) && \
+    (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    #define SFL_SSE2
+#endif
+
+#if !defined(SFL_NO_SIMD) && defined(__AVX2__)
+    #define SFL_AVX2
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    #define SFL_PREFETCH(p) __builtin_prefetch(p)
+#else
+    #define SFL_PREFETCH(p) static_cast<void>(p)
+#endif
+
 #endif // SFL_DETAIL_CPP_HPP_INCLUDED
@@ -0,0 +1,2461 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_FLAT_HASH_TABLE_HPP_INCLUDED
+#define SFL_DETAIL_FLAT_HASH_TABLE_HPP_INCLUDED
+
+#include <sfl/detail/bit/bit_width.hpp>
+#include <sfl/detail/bit/countl_zero.hpp>
+#include <sfl/detail/bit/countr_zero.hpp>
+#include <sfl/detail/memory/allocate.hpp>
+#include <sfl/detail/memory/construct_at_a.hpp>
+#include <sfl/detail/memory/deallocate.hpp>
+#include <sfl/detail/memory/destroy_at_a.hpp>
+#include <sfl/detail/memory/to_address.hpp>
+#include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/type_traits/is_input_iterator.hpp>
+#include <sfl/detail/utility/ignore_unused.hpp>
+#include <sfl/detail/utility/optional_value.hpp>
+#include <sfl/detail/allocator_traits.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/hash_table.hpp>
+
+#include <algorithm>        // max, min
+#include <cstddef>          // size_t, ptrdiff_t
+#include <cstdint>          // uint8_t, uint16_t, uint32_t, uint64_t
+#include <cstring>          // memcpy, memset
+#include <initializer_list> // initializer_list
+#include <iterator>         // forward_iterator_tag
+#include <limits>           // numeric_limits
+#include <tuple>            // forward_as_tuple
+#include <type_traits>      // is_xxxxx, true_type, false_type
+#include <utility>          // forward, move, move_if_noexcept, pair, piecewise_construct
+
+#ifdef SFL_SSE2
+#include <emmintrin.h>      // _mm_xxxxx
+#endif
+
+#ifdef SFL_TEST_FLAT_HASH_TABLE
+template <int>
+void test_flat_hash_table();
+#endif
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// CONTROL BYTES
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Every slot has one control byte. A full slot stores the lowest 7 bits of
+// the hash value (tag) in its control byte. Special values have the most
+// significant bit set, so one signed comparison distinguishes them from tags.
+//
+// The control array holds `capacity + 1 + (group_width - 1)` bytes. The byte
+// at index `capacity` is the sentinel that stops iteration. The bytes after
+// the sentinel are clones of the first `group_width - 1` control bytes, so a
+// group can be loaded from any position without wrapping around.
+
+using flat_hash_table_ctrl_t = signed char;
+
+constexpr flat_hash_table_ctrl_t flat_hash_table_ctrl_empty    = -128; // 0b10000000
+constexpr flat_hash_table_ctrl_t flat_hash_table_ctrl_deleted  = -2;   // 0b11111110
+constexpr flat_hash_table_ctrl_t flat_hash_table_ctrl_sentinel = -1;   // 0b11111111
+
+inline bool flat_hash_table_is_full(flat_hash_table_ctrl_t c) noexcept
+{
+    return c >= 0;
+}
+
+inline bool flat_hash_table_is_empty_or_deleted(flat_hash_table_ctrl_t c) noexcept
+{
+    return c < flat_hash_table_ctrl_sentinel;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// BITMASK
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Result of a group match. Each of `SignificantBits` positions is
+// represented by `1 << Shift` bits of the mask.
+template <typename T, int SignificantBits, int Shift>
+class flat_hash_table_bitmask
+{
+private:
+
+    T mask_;
+
+public:
+
+    explicit flat_hash_table_bitmask(T mask) noexcept
+        : mask_(mask)
+    {}
+
+    explicit operator bool() const noexcept
+    {
+        return mask_ != 0;
+    }
+
+    SFL_NODISCARD
+    int lowest_bit_set() const noexcept
+    {
+        return sfl::dtl::countr_zero(mask_) >> Shift;
+    }
+
+    SFL_NODISCARD
+    int trailing_zeros() const noexcept
+    {
+        return sfl::dtl::countr_zero(mask_) >> Shift;
+    }
+
+    SFL_NODISCARD
+    int leading_zeros() const noexcept
+    {
+        return sfl::dtl::countl_zero
+        (
+            static_cast<T>(mask_ << (std::numeric_limits<T>::digits - (SignificantBits << Shift)))
+        ) >> Shift;
+    }
+
+    void clear_lowest_bit() noexcept
+    {
+        mask_ &= static_cast<T>(mask_ - 1);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// GROUP
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef SFL_SSE2
+
+// Sixteen control bytes compared at once using SSE2 instructions.
+class flat_hash_table_group
+{
+private:
+
+    __m128i ctrl_;
+
+public:
+
+    static constexpr std::size_t width = 16;
+
+    using bitmask = sfl::dtl::flat_hash_table_bitmask<std::uint16_t, 16, 0>;
+
+    explicit flat_hash_table_group(const flat_hash_table_ctrl_t* pos) noexcept
+        : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pos)))
+    {}
+
+    // Returns positions of full slots whose tag is equal to `h2`.
+    SFL_NODISCARD
+    bitmask match(std::uint8_t h2) const noexcept
+    {
+        return bitmask
+        (
+            static_cast<std::uint16_t>
+            (
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(h2)), ctrl_))
+            )
+        );
+    }
+
+    SFL_NODISCARD
+    bitmask match_empty() const noexcept
+    {
+        return bitmask
+        (
+            static_cast<std::uint16_t>
+            (
+                _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(flat_hash_table_ctrl_empty)), ctrl_))
+            )
+        );
+    }
+
+    SFL_NODISCARD
+    bitmask match_empty_or_deleted() const noexcept
+    {
+        return bitmask
+        (
+            static_cast<std::uint16_t>
+            (
+                _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(flat_hash_table_ctrl_sentinel)), ctrl_))
+            )
+        );
+    }
+
+    SFL_NODISCARD
+    std::size_t count_leading_empty_or_deleted() const noexcept
+    {
+        return sfl::dtl::countr_zero
+        (
+            static_cast<std::uint32_t>
+            (
+                _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(flat_hash_table_ctrl_sentinel)), ctrl_)) + 1
+            )
+        );
+    }
+};
+
+#else // SFL_SSE2
+
+// Eight control bytes compared at once using 64-bit arithmetic.
+// Used if SSE2 is not available.
+class flat_hash_table_group
+{
+private:
+
+    std::uint64_t ctrl_;
+
+    static constexpr std::uint64_t lsbs = 0x0101010101010101ULL;
+    static constexpr std::uint64_t msbs = 0x8080808080808080ULL;
+
+    static std::uint64_t load(const flat_hash_table_ctrl_t* pos) noexcept
+    {
+        // Little-endian load. Compilers turn this into a single instruction.
+        std::uint64_t result = 0;
+        for (int i = 0; i < 8; ++i)
+        {
+            result |= std::uint64_t(static_cast<unsigned char>(pos[i])) << (8 * i);
+        }
+        return result;
+    }
+
+public:
+
+    static constexpr std::size_t width = 8;
+
+    using bitmask = sfl::dtl::flat_hash_table_bitmask<std::uint64_t, 8, 3>;
+
+    explicit flat_hash_table_group(const flat_hash_table_ctrl_t* pos) noexcept
+        : ctrl_(load(pos))
+    {}
+
+    // Returns positions of full slots whose tag is equal to `h2`.
+    // It may return false positives (always full slots), that is fine
+    // because the keys are compared anyway.
+    SFL_NODISCARD
+    bitmask match(std::uint8_t h2) const noexcept
+    {
+        const std::uint64_t x = ctrl_ ^ (lsbs * h2);
+        return bitmask((x - lsbs) & ~x & msbs);
+    }
+
+    SFL_NODISCARD
+    bitmask match_empty() const noexcept
+    {
+        return bitmask((ctrl_ & ~(ctrl_ << 6)) & msbs);
+    }
+
+    SFL_NODISCARD
+    bitmask match_empty_or_deleted() const noexcept
+    {
+        return bitmask((ctrl_ & ~(ctrl_ << 7)) & msbs);
+    }
+
+    SFL_NODISCARD
+    std::size_t count_leading_empty_or_deleted() const noexcept
+    {
+        constexpr std::uint64_t gaps = 0x00FEFEFEFEFEFEFEULL;
+        return (sfl::dtl::countr_zero(((~ctrl_ & (ctrl_ >> 7)) | gaps) + 1) + 7) >> 3;
+    }
+};
+
+#endif // SFL_SSE2
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// CAPACITY
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Capacity (number of slots) is zero or `2^k - 1`.
+
+// Returns maximal number of elements that can be stored in table with
+// the given capacity (7/8 of slots).
+constexpr std::size_t flat_hash_table_max_load(std::size_t capacity) noexcept
+{
+    return (capacity == 7 && flat_hash_table_group::width == 8)
+        ? 6
+        : capacity - capacity / 8;
+}
+
+// Returns the smallest capacity that can store `n` elements.
+constexpr std::size_t flat_hash_table_capacity_for(std::size_t n, std::size_t capacity = 1) noexcept
+{
+    return n == 0
+        ? 0
+        : flat_hash_table_max_load(capacity) >= n
+            ? capacity
+            : flat_hash_table_capacity_for(n, capacity * 2 + 1);
+}
+
+// Returns the number of control bytes in table with the given capacity.
+constexpr std::size_t flat_hash_table_ctrl_count(std::size_t capacity) noexcept
+{
+    return capacity == 0 ? 0 : capacity + flat_hash_table_group::width;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// CAPACITY POLICIES
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Table grows without limit. It never shrinks below `MinCapacity`.
+template <std::size_t MinCapacity>
+class flat_hash_table_dynamic_capacity_policy
+{
+    static_assert
+    (
+        MinCapacity == sfl::dtl::flat_hash_table_capacity_for(sfl::dtl::flat_hash_table_max_load(MinCapacity)),
+        "MinCapacity must be zero or 2^k - 1."
+    );
+
+public:
+
+    using is_static = std::false_type;
+
+    static constexpr std::size_t initial_capacity() noexcept
+    {
+        return MinCapacity;
+    }
+
+    static std::size_t next_capacity(std::size_t capacity) noexcept
+    {
+        return std::max<std::size_t>(MinCapacity, capacity * 2 + 1);
+    }
+
+    static std::size_t normalize_capacity(std::size_t capacity) noexcept
+    {
+        if (capacity <= MinCapacity)
+        {
+            return MinCapacity;
+        }
+
+        return (std::size_t(1) << sfl::dtl::bit_width(capacity)) - 1;
+    }
+};
+
+// Table has fixed capacity and it can store up to `MaxSize` elements.
+template <std::size_t MaxSize>
+class flat_hash_table_static_capacity_policy
+{
+    static_assert(MaxSize > 0, "MaxSize must be greater than zero.");
+
+public:
+
+    using is_static = std::true_type;
+
+    static constexpr std::size_t initial_capacity() noexcept
+    {
+        return sfl::dtl::flat_hash_table_capacity_for(MaxSize);
+    }
+
+    static std::size_t next_capacity(std::size_t /*capacity*/) noexcept
+    {
+        return initial_capacity();
+    }
+
+    static std::size_t normalize_capacity(std::size_t /*capacity*/) noexcept
+    {
+        return initial_capacity();
+    }
+
+    static constexpr std::size_t max_size() noexcept
+    {
+        return MaxSize;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// HASH MIXING
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Many standard hash functions are identity functions for integers.
+// Probing uses high bits and tags use low bits of the hash value, so
+// all bits of the hash value must depend on all bits of the key.
+
+template <std::size_t SizeOfSizeT>
+struct flat_hash_table_mix_impl
+{
+    static std::size_t calculate(std::size_t h) noexcept
+    {
+        h ^= h >> 16;
+        h *= 0x85EBCA6BUL;
+        h ^= h >> 13;
+        return h;
+    }
+};
+
+template <>
+struct flat_hash_table_mix_impl<8>
+{
+    static std::size_t calculate(std::size_t h) noexcept
+    {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 33;
+        return h;
+    }
+};
+
+inline std::size_t flat_hash_table_mix(std::size_t h) noexcept
+{
+    return sfl::dtl::flat_hash_table_mix_impl<sizeof(std::size_t)>::calculate(h);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// PROBE SEQUENCE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Triangular probing over groups. It visits every group exactly once
+// because capacity + 1 is power of two.
+class flat_hash_table_probe_seq
+{
+private:
+
+    std::size_t mask_;
+    std::size_t offset_;
+    std::size_t index_;
+
+public:
+
+    flat_hash_table_probe_seq(std::size_t hash, std::size_t mask) noexcept
+        : mask_(mask)
+        , offset_(hash & mask)
+        , index_(0)
+    {}
+
+    SFL_NODISCARD
+    std::size_t offset() const noexcept
+    {
+        return offset_;
+    }
+
+    SFL_NODISCARD
+    std::size_t offset(std::size_t i) const noexcept
+    {
+        return (offset_ + i) & mask_;
+    }
+
+    SFL_NODISCARD
+    std::size_t index() const noexcept
+    {
+        return index_;
+    }
+
+    void next() noexcept
+    {
+        index_ += flat_hash_table_group::width;
+        offset_ += index_;
+        offset_ &= mask_;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// ALLOCATOR HOLDER
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Slot allocator and control allocator are the same type if value_type is
+// the same type as control byte. This class makes them distinct base classes.
+template <typename Allocator, int Index>
+class flat_hash_table_allocator_holder : public Allocator
+{
+public:
+
+    flat_hash_table_allocator_holder() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    {}
+
+    template <typename Alloc>
+    explicit flat_hash_table_allocator_holder(Alloc&& alloc) noexcept
+        : Allocator(std::forward<Alloc>(alloc))
+    {}
+
+    Allocator& get() noexcept
+    {
+        return *this;
+    }
+
+    const Allocator& get() const noexcept
+    {
+        return *this;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// FLAT HASH TABLE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Open addressing hash table with unique keys (Swiss table). Values are
+// stored inline in slot array. Control array holds one byte per slot.
+// Lookup compares tags of a whole group of slots at once and compares keys
+// only for slots with matching tags.
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           typename KeyHash,
+           typename KeyEqual,
+           typename SlotAllocator,
+           typename CtrlAllocator,
+           typename CapacityPolicy >
+class flat_hash_table
+{
+    #ifdef SFL_TEST_FLAT_HASH_TABLE
+    template <int>
+    friend void ::test_flat_hash_table();
+    #endif
+
+public:
+
+    using key_type = Key;
+
+    using value_type = Value;
+
+    using size_type = std::size_t;
+
+    using difference_type = std::ptrdiff_t;
+
+    using key_hash = KeyHash;
+
+    using key_equal = KeyEqual;
+
+private:
+
+    using functions = sfl::dtl::hash_table_functions<key_hash, key_equal>;
+
+    using ctrl_t = sfl::dtl::flat_hash_table_ctrl_t;
+
+    using group = sfl::dtl::flat_hash_table_group;
+
+    using probe_seq = sfl::dtl::flat_hash_table_probe_seq;
+
+    using slot_allocator_type = typename sfl::dtl::allocator_traits<SlotAllocator>::template rebind_alloc<value_type>;
+
+    using ctrl_allocator_type = typename sfl::dtl::allocator_traits<CtrlAllocator>::template rebind_alloc<ctrl_t>;
+
+    using slot_pointer = typename sfl::dtl::allocator_traits<slot_allocator_type>::pointer;
+
+    using ctrl_pointer = typename sfl::dtl::allocator_traits<ctrl_allocator_type>::pointer;
+
+    using capacity_policy = CapacityPolicy;
+
+public:
+
+    class iterator
+    {
+        #ifdef SFL_TEST_FLAT_HASH_TABLE
+        template <int>
+        friend void ::test_flat_hash_table();
+        #endif
+
+        friend class flat_hash_table;
+
+    public:
+
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = Value;
+        using pointer           = Value*;
+        using reference         = Value&;
+        using iterator_category = std::forward_iterator_tag;
+
+    private:
+
+        const ctrl_t* ctrl_;
+
+        Value* slot_;
+
+    private:
+
+        explicit iterator(const ctrl_t* ctrl, Value* slot) noexcept
+            : ctrl_(ctrl)
+            , slot_(slot)
+        {}
+
+        void skip_empty_or_deleted() noexcept
+        {
+            while (sfl::dtl::flat_hash_table_is_empty_or_deleted(*ctrl_))
+            {
+                const std::size_t shift = group(ctrl_).count_leading_empty_or_deleted();
+                ctrl_ += shift;
+                slot_ += shift;
+            }
+        }
+
+    public:
+
+        // Default constructor
+        iterator() noexcept
+        {}
+
+        // Copy constructor
+        iterator(const iterator& other) noexcept
+            : ctrl_(other.ctrl_)
+            , slot_(other.slot_)
+        {}
+
+        // Copy assignment operator
+        iterator& operator=(const iterator& other) noexcept
+        {
+            ctrl_ = other.ctrl_;
+            slot_ = other.slot_;
+            return *this;
+        }
+
+        SFL_NODISCARD
+        reference operator*() const noexcept
+        {
+            return *slot_;
+        }
+
+        SFL_NODISCARD
+        pointer operator->() const noexcept
+        {
+            return slot_;
+        }
+
+        iterator& operator++() noexcept
+        {
+            ++ctrl_;
+            ++slot_;
+            skip_empty_or_deleted();
+            return *this;
+        }
+
+        iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        SFL_NODISCARD
+        friend bool operator==(const iterator& x, const iterator& y) noexcept
+        {
+            return x.ctrl_ == y.ctrl_;
+        }
+
+        SFL_NODISCARD
+        friend bool operator!=(const iterator& x, const iterator& y) noexcept
+        {
+            return !(x == y);
+        }
+    };
+
+    class const_iterator
+    {
+        #ifdef SFL_TEST_FLAT_HASH_TABLE
+        template <int>
+        friend void ::test_flat_hash_table();
+        #endif
+
+        friend class flat_hash_table;
+
+    public:
+
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = Value;
+        using pointer           = const Value*;
+        using reference         = const Value&;
+        using iterator_category = std::forward_iterator_tag;
+
+    private:
+
+        const ctrl_t* ctrl_;
+
+        Value* slot_;
+
+    private:
+
+        explicit const_iterator(const ctrl_t* ctrl, Value* slot) noexcept
+            : ctrl_(ctrl)
+            , slot_(slot)
+        {}
+
+        void skip_empty_or_deleted() noexcept
+        {
+            while (sfl::dtl::flat_hash_table_is_empty_or_deleted(*ctrl_))
+            {
+                const std::size_t shift = group(ctrl_).count_leading_empty_or_deleted();
+                ctrl_ += shift;
+                slot_ += shift;
+            }
+        }
+
+    public:
+
+        // Default constructor
+        const_iterator() noexcept
+        {}
+
+        // Copy constructor
+        const_iterator(const const_iterator& other) noexcept
+            : ctrl_(other.ctrl_)
+            , slot_(other.slot_)
+        {}
+
+        // Converting constructor (from iterator to const_iterator)
+        const_iterator(const iterator& other) noexcept
+            : ctrl_(other.ctrl_)
+            , slot_(other.slot_)
+        {}
+
+        // Copy assignment operator
+        const_iterator& operator=(const const_iterator& other) noexcept
+        {
+            ctrl_ = other.ctrl_;
+            slot_ = other.slot_;
+            return *this;
+        }
+
+        SFL_NODISCARD
+        reference operator*() const noexcept
+        {
+            return *slot_;
+        }
+
+        SFL_NODISCARD
+        pointer operator->() const noexcept
+        {
+            return slot_;
+        }
+
+        const_iterator& operator++() noexcept
+        {
+            ++ctrl_;
+            ++slot_;
+            skip_empty_or_deleted();
+            return *this;
+        }
+
+        const_iterator operator++(int) noexcept
+        {
+            auto temp = *this;
+            ++*this;
+            return temp;
+        }
+
+        SFL_NODISCARD
+        friend bool operator==(const const_iterator& x, const const_iterator& y) noexcept
+        {
+            return x.ctrl_ == y.ctrl_;
+        }
+
+        SFL_NODISCARD
+        friend bool operator!=(const const_iterator& x, const const_iterator& y) noexcept
+        {
+            return !(x == y);
+        }
+    };
+
+private:
+
+    using slot_allocator_holder = sfl::dtl::flat_hash_table_allocator_holder<slot_allocator_type, 0>;
+
+    using ctrl_allocator_holder = sfl::dtl::flat_hash_table_allocator_holder<ctrl_allocator_type, 1>;
+
+    class data
+        : private functions
+        , private slot_allocator_holder
+        , private ctrl_allocator_holder
+    {
+    public:
+
+        // Control array
+        ctrl_pointer ctrl_;
+
+        // Slot array
+        slot_pointer slots_;
+
+        // Number of slots. Zero or 2^k - 1.
+        std::size_t capacity_;
+
+        // Number of elements
+        std::size_t size_;
+
+        // Number of elements that can be inserted before rehashing.
+        // Deleted slots are not reusable until rehashing.
+        std::size_t growth_left_;
+
+    public:
+
+        data()
+            : ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        template <typename Alloc>
+        data(const Alloc& alloc)
+            : slot_allocator_holder(alloc)
+            , ctrl_allocator_holder(alloc)
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        data(const key_hash& hash)
+            : functions(hash)
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        template <typename Alloc>
+        data(const key_hash& hash, const Alloc& alloc)
+            : functions(hash)
+            , slot_allocator_holder(alloc)
+            , ctrl_allocator_holder(alloc)
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        data(const key_hash& hash, const key_equal& equal)
+            : functions(hash, equal)
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        template <typename Alloc>
+        data(const key_hash& hash, const key_equal& equal, const Alloc& alloc)
+            : functions(hash, equal)
+            , slot_allocator_holder(alloc)
+            , ctrl_allocator_holder(alloc)
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        data(const data& other)
+            : functions(other.ref_to_key_hash(), other.ref_to_key_equal())
+            , slot_allocator_holder(sfl::dtl::allocator_traits<slot_allocator_type>::select_on_container_copy_construction(other.ref_to_slot_alloc()))
+            , ctrl_allocator_holder(sfl::dtl::allocator_traits<ctrl_allocator_type>::select_on_container_copy_construction(other.ref_to_ctrl_alloc()))
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        template <typename Alloc>
+        data(const data& other, const Alloc& alloc)
+            : functions(other.ref_to_key_hash(), other.ref_to_key_equal())
+            , slot_allocator_holder(alloc)
+            , ctrl_allocator_holder(alloc)
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        data(data&& other)
+            : functions(std::move(other.ref_to_key_hash()), std::move(other.ref_to_key_equal()))
+            , slot_allocator_holder(std::move(other.ref_to_slot_alloc()))
+            , ctrl_allocator_holder(std::move(other.ref_to_ctrl_alloc()))
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        template <typename Alloc>
+        data(data&& other, const Alloc& alloc)
+            : functions(std::move(other.ref_to_key_hash()), std::move(other.ref_to_key_equal()))
+            , slot_allocator_holder(alloc)
+            , ctrl_allocator_holder(alloc)
+            , ctrl_(nullptr)
+            , slots_(nullptr)
+            , capacity_(0)
+            , size_(0)
+            , growth_left_(0)
+        {}
+
+        ~data()
+        {}
+
+        ///////////////////////////////////////////////////////////////////////
+
+        key_hash& ref_to_key_hash()
+        {
+            return static_cast<functions*>(this)->ref_to_key_hash();
+        }
+
+        const key_hash& ref_to_key_hash() const
+        {
+            return static_cast<const functions*>(this)->ref_to_key_hash();
+        }
+
+        key_equal& ref_to_key_equal()
+        {
+            return static_cast<functions*>(this)->ref_to_key_equal();
+        }
+
+        const key_equal& ref_to_key_equal() const
+        {
+            return static_cast<const functions*>(this)->ref_to_key_equal();
+        }
+
+        slot_allocator_type& ref_to_slot_alloc()
+        {
+            return static_cast<slot_allocator_holder*>(this)->get();
+        }
+
+        const slot_allocator_type& ref_to_slot_alloc() const
+        {
+            return static_cast<const slot_allocator_holder*>(this)->get();
+        }
+
+        ctrl_allocator_type& ref_to_ctrl_alloc()
+        {
+            return static_cast<ctrl_allocator_holder*>(this)->get();
+        }
+
+        const ctrl_allocator_type& ref_to_ctrl_alloc() const
+        {
+            return static_cast<const ctrl_allocator_holder*>(this)->get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        ctrl_t* ctrl() const noexcept
+        {
+            return sfl::dtl::to_address(ctrl_);
+        }
+
+        value_type* slots() const noexcept
+        {
+            return sfl::dtl::to_address(slots_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        void assign_copy_functions(const data& other)
+        {
+            functions::assign_copy(other);
+        }
+
+        void assign_move_functions(data& other)
+        {
+            functions::assign_move(other);
+        }
+
+        void swap_functions(data& other)
+        {
+            functions::swap(other);
+        }
+    };
+
+    mutable data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    flat_hash_table()
+        : data_()
+    {
+        initialize_empty(0);
+    }
+
+    template <typename Alloc>
+    flat_hash_table(size_type initial_capacity, const Alloc& alloc)
+        : data_(alloc)
+    {
+        initialize_empty(initial_capacity);
+    }
+
+    flat_hash_table(size_type initial_capacity)
+        : data_()
+    {
+        initialize_empty(initial_capacity);
+    }
+
+    flat_hash_table(size_type initial_capacity, const key_hash& hash)
+        : data_(hash)
+    {
+        initialize_empty(initial_capacity);
+    }
+
+    template <typename Alloc>
+    flat_hash_table(size_type initial_capacity, const key_hash& hash, const Alloc& alloc)
+        : data_(hash, alloc)
+    {
+        initialize_empty(initial_capacity);
+    }
+
+    flat_hash_table(size_type initial_capacity, const key_hash& hash, const key_equal& equal)
+        : data_(hash, equal)
+    {
+        initialize_empty(initial_capacity);
+    }
+
+    template <typename Alloc>
+    flat_hash_table(size_type initial_capacity, const key_hash& hash, const key_equal& equal, const Alloc& alloc)
+        : data_(hash, equal, alloc)
+    {
+        initialize_empty(initial_capacity);
+    }
+
+    flat_hash_table(const flat_hash_table& other)
+        : data_(other.data_)
+    {
+        initialize_copy(other);
+    }
+
+    template <typename Alloc>
+    flat_hash_table(const flat_hash_table& other, const Alloc& alloc)
+        : data_(other.data_, alloc)
+    {
+        initialize_copy(other);
+    }
+
+    flat_hash_table(flat_hash_table&& other)
+        : data_(std::move(other.data_))
+    {
+        initialize_move(other);
+    }
+
+    template <typename Alloc>
+    flat_hash_table(flat_hash_table&& other, const Alloc& alloc)
+        : data_(std::move(other.data_), alloc)
+    {
+        initialize_move(other);
+    }
+
+    ~flat_hash_table()
+    {
+        destroy_elements();
+        drop_table();
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    // This is deleted. Use `assign_copy` instead.
+    flat_hash_table& operator=(const flat_hash_table& other) = delete;
+
+    // This is deleted. Use `assign_move` instead.
+    flat_hash_table& operator=(flat_hash_table&& other) = delete;
+
+    void assign_copy(const flat_hash_table& other)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            data_.assign_copy_functions(other.data_);
+
+            if
+            (
+                sfl::dtl::allocator_traits<slot_allocator_type>::propagate_on_container_copy_assignment::value
+                &&
+                data_.ref_to_slot_alloc() != other.data_.ref_to_slot_alloc()
+            )
+            {
+                // Storage must be released by allocator that made it.
+                drop_table();
+                data_.ref_to_slot_alloc() = other.data_.ref_to_slot_alloc();
+                data_.ref_to_ctrl_alloc() = other.data_.ref_to_ctrl_alloc();
+            }
+            else if (sfl::dtl::allocator_traits<slot_allocator_type>::propagate_on_container_copy_assignment::value)
+            {
+                data_.ref_to_slot_alloc() = other.data_.ref_to_slot_alloc();
+                data_.ref_to_ctrl_alloc() = other.data_.ref_to_ctrl_alloc();
+            }
+
+            if (data_.capacity_ != other.data_.capacity_)
+            {
+                drop_table();
+                make_table(other.data_.capacity_);
+            }
+
+            copy_elements(other);
+        }
+    }
+
+    void assign_move(flat_hash_table& other)
+    {
+        if (this != &other)
+        {
+            clear();
+
+            data_.assign_move_functions(other.data_);
+
+            if (sfl::dtl::allocator_traits<slot_allocator_type>::propagate_on_container_move_assignment::value)
+            {
+                if (data_.ref_to_slot_alloc() != other.data_.ref_to_slot_alloc())
+                {
+                    // Storage must be released by allocator that made it.
+                    drop_table();
+                }
+
+                data_.ref_to_slot_alloc() = std::move(other.data_.ref_to_slot_alloc());
+                data_.ref_to_ctrl_alloc() = std::move(other.data_.ref_to_ctrl_alloc());
+            }
+
+            steal_or_move_elements(other);
+        }
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign_range_unique(InputIt first, InputIt last)
+    {
+        clear();
+
+        while (first != last)
+        {
+            insert_unique(*first);
+            ++first;
+        }
+    }
+
+    //
+    // ---- KEY HASH ----------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_hash& ref_to_key_hash() noexcept
+    {
+        return data_.ref_to_key_hash();
+    }
+
+    SFL_NODISCARD
+    const key_hash& ref_to_key_hash() const noexcept
+    {
+        return data_.ref_to_key_hash();
+    }
+
+    //
+    // ---- KEY EQUAL ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_equal& ref_to_key_equal() noexcept
+    {
+        return data_.ref_to_key_equal();
+    }
+
+    SFL_NODISCARD
+    const key_equal& ref_to_key_equal() const noexcept
+    {
+        return data_.ref_to_key_equal();
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    slot_allocator_type& ref_to_slot_alloc() noexcept
+    {
+        return data_.ref_to_slot_alloc();
+    }
+
+    SFL_NODISCARD
+    const slot_allocator_type& ref_to_slot_alloc() const noexcept
+    {
+        return data_.ref_to_slot_alloc();
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        if (data_.size_ == 0)
+        {
+            return end();
+        }
+
+        iterator it(data_.ctrl(), data_.slots());
+        it.skip_empty_or_deleted();
+        return it;
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        if (data_.size_ == 0)
+        {
+            return end();
+        }
+
+        const_iterator it(data_.ctrl(), data_.slots());
+        it.skip_empty_or_deleted();
+        return it;
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return iterator_at(data_.capacity_);
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return const_iterator_at(data_.capacity_);
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return max_size_impl(typename capacity_policy::is_static());
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        return sfl::dtl::flat_hash_table_max_load(data_.capacity_);
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        destroy_elements();
+        reset_ctrl();
+        data_.size_ = 0;
+        data_.growth_left_ = sfl::dtl::flat_hash_table_max_load(data_.capacity_);
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace_unique(Args&&... args)
+    {
+        // Key is not known until value is constructed.
+        sfl::dtl::optional_value<value_type> temp;
+
+        sfl::dtl::construct_at_a
+        (
+            data_.ref_to_slot_alloc(),
+            temp.ptr(),
+            std::forward<Args>(args)...
+        );
+
+        SFL_TRY
+        {
+            auto res = insert_unique(std::move(temp.ref()));
+            sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), temp.ptr());
+            return res;
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), temp.ptr());
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename... Args>
+    iterator emplace_hint_unique(const_iterator hint, Args&&... args)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return emplace_unique(std::forward<Args>(args)...).first;
+    }
+
+    template <typename V>
+    std::pair<iterator, bool> insert_unique(V&& value)
+    {
+        const auto& k = KeyOfValue()(value);
+        const std::size_t hash = hash_of(k);
+        const std::size_t i = find_index(k, hash);
+
+        if (i != data_.capacity_)
+        {
+            return std::make_pair(iterator_at(i), false);
+        }
+
+        return std::make_pair(emplace_at(hash, std::forward<V>(value)), true);
+    }
+
+    template <typename V>
+    iterator insert_hint_unique(const_iterator hint, V&& value)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return insert_unique(std::forward<V>(value)).first;
+    }
+
+    template <typename K, typename M>
+    std::pair<iterator, bool> insert_or_assign(K&& k, M&& obj)
+    {
+        const std::size_t hash = hash_of(k);
+        const std::size_t i = find_index(k, hash);
+
+        if (i != data_.capacity_)
+        {
+            iterator it = iterator_at(i);
+            it->second = std::forward<M>(obj);
+            return std::make_pair(it, false);
+        }
+
+        return std::make_pair
+        (
+            emplace_at
+            (
+                hash,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(k)),
+                std::forward_as_tuple(std::forward<M>(obj))
+            ),
+            true
+        );
+    }
+
+    template <typename K, typename M>
+    iterator insert_or_assign_hint(const_iterator hint, K&& k, M&& obj)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return insert_or_assign(std::forward<K>(k), std::forward<M>(obj)).first;
+    }
+
+    template <typename K, typename... Args>
+    std::pair<iterator, bool> try_emplace(K&& k, Args&&... args)
+    {
+        const std::size_t hash = hash_of(k);
+        const std::size_t i = find_index(k, hash);
+
+        if (i != data_.capacity_)
+        {
+            return std::make_pair(iterator_at(i), false);
+        }
+
+        return std::make_pair
+        (
+            emplace_at
+            (
+                hash,
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<K>(k)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            ),
+            true
+        );
+    }
+
+    template <typename K, typename... Args>
+    iterator try_emplace_hint(const_iterator hint, K&& k, Args&&... args)
+    {
+        sfl::dtl::ignore_unused(hint);
+        return try_emplace(std::forward<K>(k), std::forward<Args>(args)...).first;
+    }
+
+    iterator erase_unique(const_iterator pos)
+    {
+        iterator next(pos.ctrl_, pos.slot_);
+        ++next;
+        erase_at(static_cast<std::size_t>(pos.ctrl_ - data_.ctrl()));
+        return next;
+    }
+
+    iterator erase_unique(const_iterator first, const_iterator last)
+    {
+        while (first != last)
+        {
+            first = erase_unique(first);
+        }
+        return iterator(first.ctrl_, first.slot_);
+    }
+
+    template <typename K>
+    size_type erase_key_unique(const K& k)
+    {
+        const std::size_t i = find_index(k, hash_of(k));
+
+        if (i != data_.capacity_)
+        {
+            erase_at(i);
+            return 1;
+        }
+
+        return 0;
+    }
+
+    void swap(flat_hash_table& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        if
+        (
+            !is_storage_unpropagable()
+            &&
+            !other.is_storage_unpropagable()
+            &&
+            (
+                sfl::dtl::allocator_traits<slot_allocator_type>::propagate_on_container_swap::value
+                ||
+                data_.ref_to_slot_alloc() == other.data_.ref_to_slot_alloc()
+            )
+        )
+        {
+            using std::swap;
+
+            // Swap functions. May throw exception. No effects if thrown.
+            data_.swap_functions(other.data_);
+
+            // Swap allocators (noexcept)
+            if (sfl::dtl::allocator_traits<slot_allocator_type>::propagate_on_container_swap::value)
+            {
+                swap(data_.ref_to_slot_alloc(), other.data_.ref_to_slot_alloc());
+                swap(data_.ref_to_ctrl_alloc(), other.data_.ref_to_ctrl_alloc());
+            }
+
+            // Swap storage (noexcept)
+            swap(data_.ctrl_, other.data_.ctrl_);
+            swap(data_.slots_, other.data_.slots_);
+            swap(data_.capacity_, other.data_.capacity_);
+            swap(data_.size_, other.data_.size_);
+            swap(data_.growth_left_, other.data_.growth_left_);
+        }
+        else
+        {
+            swap_elements(other);
+        }
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    template <typename K>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const K& k)
+    {
+        iterator it = find(k);
+
+        if (it == end())
+        {
+            return std::make_pair(it, it);
+        }
+
+        iterator next = it;
+        ++next;
+        return std::make_pair(it, next);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const K& k) const
+    {
+        const_iterator it = find(k);
+
+        if (it == end())
+        {
+            return std::make_pair(it, it);
+        }
+
+        const_iterator next = it;
+        ++next;
+        return std::make_pair(it, next);
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    iterator find(const K& k)
+    {
+        return iterator_at(find_index(k, hash_of(k)));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    const_iterator find(const K& k) const
+    {
+        return const_iterator_at(find_index(k, hash_of(k)));
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    size_type count_unique(const K& k) const
+    {
+        return contains(k) ? 1 : 0;
+    }
+
+    template <typename K>
+    SFL_NODISCARD
+    bool contains(const K& k) const
+    {
+        return find_index(k, hash_of(k)) != data_.capacity_;
+    }
+
+    //
+    // ---- HASH POLICY -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    size_type bucket_count() const noexcept
+    {
+        return data_.capacity_;
+    }
+
+    SFL_NODISCARD
+    float load_factor() const noexcept
+    {
+        return data_.capacity_ == 0
+            ? 0.0f
+            : static_cast<float>(data_.size_) / static_cast<float>(data_.capacity_);
+    }
+
+    SFL_NODISCARD
+    float max_load_factor() const noexcept
+    {
+        return 0.875f;
+    }
+
+    void rehash(size_type count)
+    {
+        const std::size_t new_capacity = capacity_policy::normalize_capacity
+        (
+            std::max<std::size_t>
+            (
+                count,
+                sfl::dtl::flat_hash_table_capacity_for(data_.size_)
+            )
+        );
+
+        if (new_capacity != data_.capacity_)
+        {
+            resize(new_capacity);
+        }
+    }
+
+    void reserve(size_type count)
+    {
+        if (count > data_.size_ + data_.growth_left_)
+        {
+            const std::size_t new_capacity = capacity_policy::normalize_capacity
+            (
+                sfl::dtl::flat_hash_table_capacity_for(count)
+            );
+
+            if (new_capacity != data_.capacity_)
+            {
+                resize(new_capacity);
+            }
+        }
+    }
+
+private:
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    SFL_NODISCARD
+    size_type max_size_impl(std::true_type) const noexcept
+    {
+        return capacity_policy::max_size();
+    }
+
+    SFL_NODISCARD
+    size_type max_size_impl(std::false_type) const noexcept
+    {
+        const std::size_t n = std::min<std::size_t>
+        ({
+            sfl::dtl::allocator_traits<slot_allocator_type>::max_size(data_.ref_to_slot_alloc()),
+            sfl::dtl::allocator_traits<ctrl_allocator_type>::max_size(data_.ref_to_ctrl_alloc()) - group::width,
+            std::size_t(std::numeric_limits<difference_type>::max()) / sizeof(value_type)
+        });
+
+        // The largest capacity 2^k - 1 not greater than n.
+        return sfl::dtl::flat_hash_table_max_load((std::size_t(1) << (sfl::dtl::bit_width(n) - 1)) - 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    SFL_NODISCARD
+    iterator iterator_at(std::size_t i) const noexcept
+    {
+        return iterator(data_.ctrl() + i, data_.slots() + i);
+    }
+
+    SFL_NODISCARD
+    const_iterator const_iterator_at(std::size_t i) const noexcept
+    {
+        return const_iterator(data_.ctrl() + i, data_.slots() + i);
+    }
+
+    SFL_NODISCARD
+    bool is_storage_unpropagable() const noexcept
+    {
+        return data_.capacity_ != 0 &&
+        (
+            sfl::dtl::allocator_traits<slot_allocator_type>::is_storage_unpropagable
+            (
+                data_.ref_to_slot_alloc(),
+                data_.slots_
+            )
+            ||
+            sfl::dtl::allocator_traits<ctrl_allocator_type>::is_storage_unpropagable
+            (
+                data_.ref_to_ctrl_alloc(),
+                data_.ctrl_
+            )
+        );
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    template <typename K>
+    SFL_NODISCARD
+    std::size_t hash_of(const K& k) const
+    {
+        return sfl::dtl::flat_hash_table_mix(data_.ref_to_key_hash()(k));
+    }
+
+    SFL_NODISCARD
+    static std::size_t h1(std::size_t hash) noexcept
+    {
+        return hash >> 7;
+    }
+
+    SFL_NODISCARD
+    static std::uint8_t h2(std::size_t hash) noexcept
+    {
+        return static_cast<std::uint8_t>(hash & 0x7F);
+    }
+
+    // Sets control byte and its clone (if any).
+    static void set_ctrl(ctrl_t* ctrl, std::size_t capacity, std::size_t i, ctrl_t h) noexcept
+    {
+        SFL_ASSERT(i < capacity);
+        ctrl[i] = h;
+        // Index of clone is equal to `i` if there is no clone.
+        ctrl[((i - (group::width - 1)) & capacity) + ((group::width - 1) & capacity)] = h;
+    }
+
+    // Returns index of the first empty or deleted slot in probe sequence.
+    SFL_NODISCARD
+    static std::size_t find_first_non_full(const ctrl_t* ctrl, std::size_t capacity, std::size_t hash) noexcept
+    {
+        probe_seq seq(h1(hash), capacity);
+
+        while (true)
+        {
+            const auto mask = group(ctrl + seq.offset()).match_empty_or_deleted();
+
+            if (mask)
+            {
+                return seq.offset(mask.lowest_bit_set());
+            }
+
+            seq.next();
+            SFL_ASSERT(seq.index() <= capacity && "Full table.");
+        }
+    }
+
+    // Returns index of slot with the given key or capacity if not found.
+    template <typename K>
+    SFL_NODISCARD
+    std::size_t find_index(const K& k, std::size_t hash) const
+    {
+        if (data_.capacity_ == 0)
+        {
+            return 0;
+        }
+
+        const ctrl_t* ctrl = data_.ctrl();
+        const value_type* slots = data_.slots();
+
+        probe_seq seq(h1(hash), data_.capacity_);
+
+        while (true)
+        {
+            const group g(ctrl + seq.offset());
+
+            for (auto mask = g.match(h2(hash)); mask; mask.clear_lowest_bit())
+            {
+                const std::size_t i = seq.offset(mask.lowest_bit_set());
+
+                if (data_.ref_to_key_equal()(KeyOfValue()(slots[i]), k))
+                {
+                    return i;
+                }
+            }
+
+            if (g.match_empty())
+            {
+                return data_.capacity_;
+            }
+
+            seq.next();
+            SFL_ASSERT(seq.index() <= data_.capacity_ && "Full table.");
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Constructs a new element. Key must not exist in table.
+    // If an exception is thrown, element is not inserted. Table may be
+    // rehashed.
+    template <typename... Args>
+    iterator emplace_at(std::size_t hash, Args&&... args)
+    {
+        if (data_.growth_left_ == 0)
+        {
+            make_room();
+        }
+
+        const std::size_t i = find_first_non_full(data_.ctrl(), data_.capacity_, hash);
+
+        sfl::dtl::construct_at_a
+        (
+            data_.ref_to_slot_alloc(),
+            data_.slots_ + i,
+            std::forward<Args>(args)...
+        );
+
+        if (data_.ctrl()[i] == sfl::dtl::flat_hash_table_ctrl_empty)
+        {
+            --data_.growth_left_;
+        }
+
+        set_ctrl(data_.ctrl(), data_.capacity_, i, static_cast<ctrl_t>(h2(hash)));
+        ++data_.size_;
+
+        return iterator_at(i);
+    }
+
+    void erase_at(std::size_t i) noexcept
+    {
+        SFL_ASSERT(i < data_.capacity_);
+        SFL_ASSERT(sfl::dtl::flat_hash_table_is_full(data_.ctrl()[i]));
+
+        sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), data_.slots_ + i);
+        --data_.size_;
+
+        ctrl_t* ctrl = data_.ctrl();
+
+        // If there was never a full group around this slot, no probe sequence
+        // ever passed over it. Slot can be marked as empty instead of deleted.
+        // Tables smaller than one group are always searched in one step.
+        const std::size_t index_before = (i - group::width) & data_.capacity_;
+        const auto empty_after = group(ctrl + i).match_empty();
+        const auto empty_before = group(ctrl + index_before).match_empty();
+
+        const bool was_never_full = data_.capacity_ < group::width ||
+        (
+            empty_before && empty_after &&
+            std::size_t(empty_after.trailing_zeros() + empty_before.leading_zeros()) < group::width
+        );
+
+        if (was_never_full)
+        {
+            set_ctrl(ctrl, data_.capacity_, i, sfl::dtl::flat_hash_table_ctrl_empty);
+            ++data_.growth_left_;
+        }
+        else
+        {
+            set_ctrl(ctrl, data_.capacity_, i, sfl::dtl::flat_hash_table_ctrl_deleted);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void make_table(std::size_t capacity)
+    {
+        SFL_ASSERT(data_.capacity_ == 0);
+        SFL_ASSERT(data_.size_ == 0);
+
+        if (capacity == 0)
+        {
+            return;
+        }
+
+        const ctrl_pointer ctrl = sfl::dtl::allocate
+        (
+            data_.ref_to_ctrl_alloc(),
+            sfl::dtl::flat_hash_table_ctrl_count(capacity)
+        );
+
+        SFL_TRY
+        {
+            data_.slots_ = sfl::dtl::allocate(data_.ref_to_slot_alloc(), capacity);
+        }
+        SFL_CATCH (...)
+        {
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_ctrl_alloc(),
+                ctrl,
+                sfl::dtl::flat_hash_table_ctrl_count(capacity)
+            );
+
+            SFL_RETHROW;
+        }
+
+        data_.ctrl_ = ctrl;
+        data_.capacity_ = capacity;
+        data_.growth_left_ = sfl::dtl::flat_hash_table_max_load(capacity);
+
+        reset_ctrl();
+    }
+
+    void drop_table() noexcept
+    {
+        SFL_ASSERT(data_.size_ == 0);
+
+        if (data_.capacity_ != 0)
+        {
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_slot_alloc(),
+                data_.slots_,
+                data_.capacity_
+            );
+
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_ctrl_alloc(),
+                data_.ctrl_,
+                sfl::dtl::flat_hash_table_ctrl_count(data_.capacity_)
+            );
+        }
+
+        data_.ctrl_ = nullptr;
+        data_.slots_ = nullptr;
+        data_.capacity_ = 0;
+        data_.growth_left_ = 0;
+    }
+
+    void reset_ctrl() noexcept
+    {
+        if (data_.capacity_ != 0)
+        {
+            std::memset
+            (
+                data_.ctrl(),
+                sfl::dtl::flat_hash_table_ctrl_empty,
+                sfl::dtl::flat_hash_table_ctrl_count(data_.capacity_)
+            );
+
+            data_.ctrl()[data_.capacity_] = sfl::dtl::flat_hash_table_ctrl_sentinel;
+        }
+    }
+
+    void destroy_elements() noexcept
+    {
+        if (data_.size_ != 0)
+        {
+            const ctrl_t* ctrl = data_.ctrl();
+
+            for (std::size_t i = 0; i != data_.capacity_; ++i)
+            {
+                if (sfl::dtl::flat_hash_table_is_full(ctrl[i]))
+                {
+                    sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), data_.slots_ + i);
+                }
+            }
+
+            data_.size_ = 0;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void make_room()
+    {
+        make_room_impl(typename capacity_policy::is_static());
+    }
+
+    void make_room_impl(std::true_type)
+    {
+        SFL_ASSERT(data_.size_ < capacity_policy::max_size());
+        drop_deleted_without_resize();
+    }
+
+    void make_room_impl(std::false_type)
+    {
+        // Reuse deleted slots if table is not too full (25/32 of capacity).
+        if
+        (
+            data_.capacity_ > group::width &&
+            data_.size_ * 32 <= data_.capacity_ * 25
+        )
+        {
+            drop_deleted_without_resize();
+        }
+        else
+        {
+            resize(capacity_policy::next_capacity(data_.capacity_));
+        }
+    }
+
+    // Moves all elements into a new table. Strong exception guarantee if
+    // move constructor of value_type is noexcept or value_type is copyable.
+    void resize(std::size_t new_capacity)
+    {
+        SFL_ASSERT(new_capacity >= sfl::dtl::flat_hash_table_capacity_for(data_.size_));
+
+        // Detach old table. New table is made by the same allocators.
+        const ctrl_pointer old_ctrl = data_.ctrl_;
+        const slot_pointer old_slots = data_.slots_;
+        const std::size_t old_capacity = data_.capacity_;
+        const std::size_t old_size = data_.size_;
+        const std::size_t old_growth_left = data_.growth_left_;
+
+        const auto restore_old_table = [&]()
+        {
+            data_.ctrl_ = old_ctrl;
+            data_.slots_ = old_slots;
+            data_.capacity_ = old_capacity;
+            data_.size_ = old_size;
+            data_.growth_left_ = old_growth_left;
+        };
+
+        data_.ctrl_ = nullptr;
+        data_.slots_ = nullptr;
+        data_.capacity_ = 0;
+        data_.size_ = 0;
+        data_.growth_left_ = 0;
+
+        SFL_TRY
+        {
+            make_table(new_capacity);
+        }
+        SFL_CATCH (...)
+        {
+            restore_old_table();
+            SFL_RETHROW;
+        }
+
+        SFL_TRY
+        {
+            const ctrl_t* ctrl = sfl::dtl::to_address(old_ctrl);
+            value_type* slots = sfl::dtl::to_address(old_slots);
+
+            for (std::size_t i = 0; i != old_capacity; ++i)
+            {
+                if (sfl::dtl::flat_hash_table_is_full(ctrl[i]))
+                {
+                    const std::size_t hash = hash_of(KeyOfValue()(slots[i]));
+                    const std::size_t j = find_first_non_full(data_.ctrl(), data_.capacity_, hash);
+
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_slot_alloc(),
+                        data_.slots_ + j,
+                        std::move_if_noexcept(slots[i])
+                    );
+
+                    set_ctrl(data_.ctrl(), data_.capacity_, j, static_cast<ctrl_t>(h2(hash)));
+                    ++data_.size_;
+                }
+            }
+        }
+        SFL_CATCH (...)
+        {
+            destroy_elements();
+            drop_table();
+            restore_old_table();
+            SFL_RETHROW;
+        }
+
+        data_.growth_left_ = sfl::dtl::flat_hash_table_max_load(data_.capacity_) - data_.size_;
+
+        // Destroy old elements and release old table.
+        const ctrl_t* ctrl = sfl::dtl::to_address(old_ctrl);
+
+        for (std::size_t i = 0; i != old_capacity; ++i)
+        {
+            if (sfl::dtl::flat_hash_table_is_full(ctrl[i]))
+            {
+                sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), old_slots + i);
+            }
+        }
+
+        if (old_capacity != 0)
+        {
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_slot_alloc(),
+                old_slots,
+                old_capacity
+            );
+
+            sfl::dtl::deallocate
+            (
+                data_.ref_to_ctrl_alloc(),
+                old_ctrl,
+                sfl::dtl::flat_hash_table_ctrl_count(old_capacity)
+            );
+        }
+    }
+
+    // Rehashes elements in place. It removes all deleted slots.
+    // Basic exception guarantee: if hash function or move constructor
+    // throws an exception, elements that are not yet placed are destroyed.
+    void drop_deleted_without_resize()
+    {
+        ctrl_t* ctrl = data_.ctrl();
+        value_type* slots = data_.slots();
+        const std::size_t capacity = data_.capacity_;
+
+        // Convert deleted to empty and full to deleted. Deleted slots are
+        // elements that are not yet placed.
+        for (std::size_t i = 0; i != capacity; ++i)
+        {
+            ctrl[i] = sfl::dtl::flat_hash_table_is_full(ctrl[i])
+                ? sfl::dtl::flat_hash_table_ctrl_deleted
+                : sfl::dtl::flat_hash_table_ctrl_empty;
+        }
+        std::memset
+        (
+            ctrl + capacity + 1,
+            sfl::dtl::flat_hash_table_ctrl_empty,
+            group::width - 1
+        );
+        std::memcpy
+        (
+            ctrl + capacity + 1,
+            ctrl,
+            std::min<std::size_t>(capacity, group::width - 1)
+        );
+
+        sfl::dtl::optional_value<value_type> temp;
+        bool temp_constructed = false;
+
+        SFL_TRY
+        {
+            for (std::size_t i = 0; i != capacity; ++i)
+            {
+                if (ctrl[i] != sfl::dtl::flat_hash_table_ctrl_deleted)
+                {
+                    continue;
+                }
+
+                const std::size_t hash = hash_of(KeyOfValue()(slots[i])); // may throw
+                const std::size_t new_i = find_first_non_full(ctrl, capacity, hash);
+                const std::size_t probe_offset = probe_seq(h1(hash), capacity).offset();
+
+                const auto probe_index = [&](std::size_t pos)
+                {
+                    return ((pos - probe_offset) & capacity) / group::width;
+                };
+
+                // Element is already in the best group.
+                if (probe_index(new_i) == probe_index(i))
+                {
+                    set_ctrl(ctrl, capacity, i, static_cast<ctrl_t>(h2(hash)));
+                    continue;
+                }
+
+                if (ctrl[new_i] == sfl::dtl::flat_hash_table_ctrl_empty)
+                {
+                    // Move element to empty slot.
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_slot_alloc(),
+                        data_.slots_ + new_i,
+                        std::move(slots[i])
+                    ); // may throw
+                    set_ctrl(ctrl, capacity, new_i, static_cast<ctrl_t>(h2(hash)));
+                    sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), data_.slots_ + i);
+                    set_ctrl(ctrl, capacity, i, sfl::dtl::flat_hash_table_ctrl_empty);
+                }
+                else
+                {
+                    SFL_ASSERT(ctrl[new_i] == sfl::dtl::flat_hash_table_ctrl_deleted);
+
+                    // Swap with element that is not yet placed and process
+                    // slot `i` again.
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_slot_alloc(),
+                        temp.ptr(),
+                        std::move(slots[i])
+                    ); // may throw
+                    temp_constructed = true;
+                    sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), data_.slots_ + i);
+                    set_ctrl(ctrl, capacity, i, sfl::dtl::flat_hash_table_ctrl_empty);
+
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_slot_alloc(),
+                        data_.slots_ + i,
+                        std::move(slots[new_i])
+                    ); // may throw
+                    set_ctrl(ctrl, capacity, i, sfl::dtl::flat_hash_table_ctrl_deleted);
+                    sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), data_.slots_ + new_i);
+                    set_ctrl(ctrl, capacity, new_i, sfl::dtl::flat_hash_table_ctrl_empty);
+
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_slot_alloc(),
+                        data_.slots_ + new_i,
+                        std::move(temp.ref())
+                    ); // may throw
+                    set_ctrl(ctrl, capacity, new_i, static_cast<ctrl_t>(h2(hash)));
+                    sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), temp.ptr());
+                    temp_constructed = false;
+
+                    --i;
+                }
+            }
+        }
+        SFL_CATCH (...)
+        {
+            if (temp_constructed)
+            {
+                sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), temp.ptr());
+                --data_.size_;
+            }
+
+            for (std::size_t i = 0; i != capacity; ++i)
+            {
+                if (ctrl[i] == sfl::dtl::flat_hash_table_ctrl_deleted)
+                {
+                    sfl::dtl::destroy_at_a(data_.ref_to_slot_alloc(), data_.slots_ + i);
+                    set_ctrl(ctrl, capacity, i, sfl::dtl::flat_hash_table_ctrl_empty);
+                    --data_.size_;
+                }
+            }
+
+            data_.growth_left_ = sfl::dtl::flat_hash_table_max_load(capacity) - data_.size_;
+
+            SFL_RETHROW;
+        }
+
+        data_.growth_left_ = sfl::dtl::flat_hash_table_max_load(capacity) - data_.size_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Copies elements from other table with the same capacity. Elements are
+    // placed in the same slots, so no hashing is needed.
+    void copy_elements(const flat_hash_table& other)
+    {
+        SFL_ASSERT(data_.capacity_ == other.data_.capacity_);
+        SFL_ASSERT(data_.size_ == 0);
+
+        if (other.data_.size_ == 0)
+        {
+            return;
+        }
+
+        const ctrl_t* other_ctrl = other.data_.ctrl();
+        const value_type* other_slots = other.data_.slots();
+        ctrl_t* ctrl = data_.ctrl();
+
+        for (std::size_t i = 0; i != data_.capacity_; ++i)
+        {
+            if (sfl::dtl::flat_hash_table_is_full(other_ctrl[i]))
+            {
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_slot_alloc(),
+                    data_.slots_ + i,
+                    other_slots[i]
+                ); // may throw
+                set_ctrl(ctrl, data_.capacity_, i, other_ctrl[i]);
+                ++data_.size_;
+            }
+        }
+
+        // Copy deleted slots too, so growth left is the same.
+        std::memcpy(ctrl, other_ctrl, sfl::dtl::flat_hash_table_ctrl_count(data_.capacity_));
+        data_.growth_left_ = other.data_.growth_left_;
+    }
+
+    // Moves elements from other table with the same capacity.
+    // Moved-from elements remain in other table.
+    void move_elements(flat_hash_table& other)
+    {
+        SFL_ASSERT(data_.capacity_ == other.data_.capacity_);
+        SFL_ASSERT(data_.size_ == 0);
+
+        if (other.data_.size_ != 0)
+        {
+            const ctrl_t* other_ctrl = other.data_.ctrl();
+            value_type* other_slots = other.data_.slots();
+            ctrl_t* ctrl = data_.ctrl();
+
+            for (std::size_t i = 0; i != data_.capacity_; ++i)
+            {
+                if (sfl::dtl::flat_hash_table_is_full(other_ctrl[i]))
+                {
+                    sfl::dtl::construct_at_a
+                    (
+                        data_.ref_to_slot_alloc(),
+                        data_.slots_ + i,
+                        std::move(other_slots[i])
+                    ); // may throw
+                    set_ctrl(ctrl, data_.capacity_, i, other_ctrl[i]);
+                    ++data_.size_;
+                }
+            }
+
+            std::memcpy(ctrl, other_ctrl, sfl::dtl::flat_hash_table_ctrl_count(data_.capacity_));
+            data_.growth_left_ = other.data_.growth_left_;
+        }
+    }
+
+    // Takes storage from other table if possible, otherwise moves elements
+    // one-by-one. Allocators must be already set. This table must be empty.
+    void steal_or_move_elements(flat_hash_table& other)
+    {
+        SFL_ASSERT(data_.size_ == 0);
+
+        if
+        (
+            !other.is_storage_unpropagable()
+            &&
+            data_.ref_to_slot_alloc() == other.data_.ref_to_slot_alloc()
+        )
+        {
+            drop_table();
+
+            data_.ctrl_ = other.data_.ctrl_;
+            data_.slots_ = other.data_.slots_;
+            data_.capacity_ = other.data_.capacity_;
+            data_.size_ = other.data_.size_;
+            data_.growth_left_ = other.data_.growth_left_;
+
+            other.data_.ctrl_ = nullptr;
+            other.data_.slots_ = nullptr;
+            other.data_.capacity_ = 0;
+            other.data_.size_ = 0;
+            other.data_.growth_left_ = 0;
+        }
+        else
+        {
+            if (data_.capacity_ != other.data_.capacity_)
+            {
+                drop_table();
+                make_table(other.data_.capacity_);
+            }
+
+            move_elements(other);
+        }
+    }
+
+    // Used if storage of one table cannot be given to the other table.
+    // Basic exception guarantee.
+    void swap_elements(flat_hash_table& other)
+    {
+        // Swap functions. May throw exception. No effects if thrown.
+        data_.swap_functions(other.data_);
+
+        // Move elements to temporary tables that use equal allocators.
+        flat_hash_table temp_this(0, data_.ref_to_slot_alloc());
+        temp_this.steal_or_move_elements(*this);
+        this->clear();
+
+        flat_hash_table temp_other(0, other.data_.ref_to_slot_alloc());
+        temp_other.steal_or_move_elements(other);
+        other.clear();
+
+        // Swap allocators (noexcept)
+        if (sfl::dtl::allocator_traits<slot_allocator_type>::propagate_on_container_swap::value)
+        {
+            using std::swap;
+
+            this->drop_table();
+            other.drop_table();
+
+            swap(this->data_.ref_to_slot_alloc(), other.data_.ref_to_slot_alloc());
+            swap(this->data_.ref_to_ctrl_alloc(), other.data_.ref_to_ctrl_alloc());
+        }
+
+        // Move elements back. May throw exception.
+        this->steal_or_move_elements(temp_other);
+        other.steal_or_move_elements(temp_this);
+
+        // Moved-from elements are destroyed by destructors of temporary tables.
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    void initialize_empty(size_type initial_capacity)
+    {
+        make_table
+        (
+            capacity_policy::normalize_capacity
+            (
+                std::max<std::size_t>
+                (
+                    capacity_policy::initial_capacity(),
+                    initial_capacity
+                )
+            )
+        );
+    }
+
+    void initialize_copy(const flat_hash_table& other)
+    {
+        make_table(other.data_.capacity_);
+
+        SFL_TRY
+        {
+            copy_elements(other);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_elements();
+            drop_table();
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_move(flat_hash_table& other)
+    {
+        if
+        (
+            !other.is_storage_unpropagable()
+            &&
+            data_.ref_to_slot_alloc() == other.data_.ref_to_slot_alloc()
+        )
+        {
+            steal_or_move_elements(other);
+        }
+        else
+        {
+            make_table(other.data_.capacity_);
+
+            SFL_TRY
+            {
+                move_elements(other);
+            }
+            SFL_CATCH (...)
+            {
+                destroy_elements();
+                drop_table();
+                SFL_RETHROW;
+            }
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// NON-MEMBER FUNCTIONS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Keys are unique, so every element is looked up in the other table
+// instead of using `std::is_permutation`. Linear complexity on average.
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6, typename TP7, typename TP8>
+SFL_NODISCARD
+bool operator==
+(
+    const flat_hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8>& x,
+    const flat_hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8>& y
+)
+{
+    if (x.size() != y.size())
+    {
+        return false;
+    }
+
+    for (auto it = x.begin(); it != x.end(); ++it)
+    {
+        auto jt = y.find(TP3()(*it));
+
+        if (jt == y.end() || !(*it == *jt))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6, typename TP7, typename TP8>
+SFL_NODISCARD
+bool operator!=
+(
+    const flat_hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8>& x,
+    const flat_hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8>& y
+)
+{
+    return !(x == y);
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_FLAT_HASH_TABLE_HPP_INCLUDED
@@ -41,7 +41,7 @@ struct first
 
     template <typename Pair>
     SFL_NODISCARD
-    const typename Pair::first_type& operator()(const Pair& p) const noexcept
+    constexpr const typename Pair::first_type& operator()(const Pair& p) const noexcept
     {
         return p.first;
     }
@@ -41,7 +41,7 @@ struct identity
 
     template <typename T>
     SFL_NODISCARD
-    const T& operator()(const T& t) const noexcept
+    constexpr const T& operator()(const T& t) const noexcept
     {
         return t;
     }
@@ -0,0 +1,130 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+#ifndef SFL_DETAIL_GROWTH_POLICY_HPP_INCLUDED
+#define SFL_DETAIL_GROWTH_POLICY_HPP_INCLUDED
+
+#include <algorithm> // max
+#include <cstddef>   // size_t
+#include <limits>    // numeric_limits
+
+namespace sfl
+{
+
+//
+// Growth policies determine new capacity of vector-like containers when
+// storage must grow.
+//
+// Member function `new_capacity<T>(capacity, min_capacity, max_size)` returns
+// new capacity that is greater than or equal to `min_capacity` and less than
+// or equal to `max_size`. Precondition: `min_capacity <= max_size`.
+//
+
+//
+// Capacity grows by factor 1.5.
+//
+struct growth_factor_1_5
+{
+    template <typename T, typename SizeType>
+    static SizeType new_capacity(SizeType capacity, SizeType min_capacity, SizeType max_size) noexcept
+    {
+        if (max_size - capacity < capacity / 2)
+        {
+            return max_size;
+        }
+        else
+        {
+            return std::max(min_capacity, SizeType(capacity + capacity / 2));
+        }
+    }
+};
+
+//
+// Capacity grows by factor 2.
+//
+struct growth_factor_2
+{
+    template <typename T, typename SizeType>
+    static SizeType new_capacity(SizeType capacity, SizeType min_capacity, SizeType max_size) noexcept
+    {
+        if (max_size - capacity < capacity)
+        {
+            return max_size;
+        }
+        else
+        {
+            return std::max(min_capacity, SizeType(capacity + capacity));
+        }
+    }
+};
+
+//
+// Capacity grows according to `GrowthPolicy`. If the resulting storage is
+// at least `PageSize` bytes, capacity is rounded up so that the storage size
+// is a multiple of `PageSize` bytes.
+//
+template <std::size_t PageSize, typename GrowthPolicy = sfl::growth_factor_1_5>
+struct page_rounded_growth
+{
+    static_assert(PageSize > 0, "PageSize must be greater than zero.");
+
+    template <typename T, typename SizeType>
+    static SizeType new_capacity(SizeType capacity, SizeType min_capacity, SizeType max_size) noexcept
+    {
+        const SizeType new_cap =
+            GrowthPolicy::template new_capacity<T>(capacity, min_capacity, max_size);
+
+        if (new_cap > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            return new_cap;
+        }
+
+        const std::size_t bytes = std::size_t(new_cap) * sizeof(T);
+
+        if (bytes < PageSize || bytes > std::numeric_limits<std::size_t>::max() - (PageSize - 1))
+        {
+            return new_cap;
+        }
+
+        const std::size_t rounded_bytes = (bytes + (PageSize - 1)) / PageSize * PageSize;
+
+        const std::size_t rounded_cap = rounded_bytes / sizeof(T);
+
+        if (rounded_cap > std::size_t(max_size))
+        {
+            return max_size;
+        }
+
+        return SizeType(rounded_cap);
+    }
+};
+
+//
+// Page-rounded growth for 4 KiB pages.
+//
+using page_rounded_growth_4k = sfl::page_rounded_growth<4096>;
+
+//
+// Page-rounded growth for 2 MiB (huge) pages.
+//
+using page_rounded_growth_2m = sfl::page_rounded_growth<2097152>;
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_GROWTH_POLICY_HPP_INCLUDED
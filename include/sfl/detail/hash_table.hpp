@@ -43,6 +43,7 @@
 #include <sfl/detail/utility/scope_guard.hpp>
 #include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
+#include <sfl/detail/node_handle.hpp>
 
 #include <algorithm>    // max, min
 #include <cmath>        // ceil, floor
@@ -97,8 +98,46 @@ struct hash_table_base_node
     {}
 };
 
-template <typename Value, typename VoidPointer>
-struct hash_table_node : hash_table_base_node<VoidPointer>
+template <bool StoreHash>
+struct hash_table_node_hash
+{
+    void set_hash(std::size_t /*hash*/) noexcept
+    {}
+
+    std::size_t get_hash() const noexcept
+    {
+        return 0; // Hash is not stored. This value is never used.
+    }
+
+    bool hash_equals(std::size_t /*hash*/) const noexcept
+    {
+        return true;
+    }
+};
+
+template <>
+struct hash_table_node_hash<true>
+{
+    std::size_t hash_;
+
+    void set_hash(std::size_t hash) noexcept
+    {
+        hash_ = hash;
+    }
+
+    std::size_t get_hash() const noexcept
+    {
+        return hash_;
+    }
+
+    bool hash_equals(std::size_t hash) const noexcept
+    {
+        return hash_ == hash;
+    }
+};
+
+template <typename Value, typename VoidPointer, bool StoreHash = false>
+struct hash_table_node : hash_table_base_node<VoidPointer>, hash_table_node_hash<StoreHash>
 {
     using typename hash_table_base_node<VoidPointer>::base_node_pointer;
 
@@ -157,6 +196,35 @@ struct hash_table_bucket
     BaseNodePointer next_;
 };
 
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// INCREMENTAL REHASHING STATE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename BucketPointer, typename BaseNodePointer, typename BucketCountPolicy, bool IncrementalRehash>
+struct hash_table_rehash_state
+{};
+
+template <typename BucketPointer, typename BaseNodePointer, typename BucketCountPolicy>
+struct hash_table_rehash_state<BucketPointer, BaseNodePointer, BucketCountPolicy, true>
+{
+    // Bucket array that is being rehashed. Null if rehashing is not in progress.
+    BucketPointer old_buckets_;
+
+    // Last migrated node, or list head if no node has been migrated yet.
+    // Nodes after this one still belong to the old bucket array.
+    BaseNodePointer rehash_cursor_;
+
+    // Bucket count of the old bucket array.
+    BucketCountPolicy old_bucket_count_policy_;
+
+    hash_table_rehash_state()
+        : old_buckets_(nullptr)
+        , rehash_cursor_(nullptr)
+    {}
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 // FUNCTIONS
@@ -966,7 +1034,9 @@ template < typename Key,
            typename NodeAllocator,
            typename BucketAllocator,
            typename BucketCountPolicy,
-           typename MaxLoadPolicy >
+           typename MaxLoadPolicy,
+           bool StoreHash,
+           bool IncrementalRehash >
 class hash_table
 {
     #ifdef SFL_TEST_HASH_TABLE
@@ -974,6 +1044,9 @@ class hash_table
     friend void ::test_hash_table();
     #endif
 
+    template <typename, typename, typename, typename, typename, typename, typename, typename, typename, bool, bool>
+    friend class hash_table;
+
 public:
 
     using key_type = Key;
@@ -998,7 +1071,7 @@ private:
 
     using base_node_pointer = typename base_node_type::base_node_pointer;
 
-    using node_type = sfl::dtl::hash_table_node<value_type, node_allocator_void_pointer>;
+    using node_type = sfl::dtl::hash_table_node<value_type, node_allocator_void_pointer, StoreHash>;
 
     using node_pointer = typename node_type::node_pointer;
 
@@ -1014,8 +1087,21 @@ private:
 
     using max_load_policy = MaxLoadPolicy;
 
+    using store_hash = std::integral_constant<bool, StoreHash>;
+
+    using incremental_rehash = std::integral_constant<bool, IncrementalRehash>;
+
+    using rehash_state = sfl::dtl::hash_table_rehash_state<bucket_pointer, base_node_pointer, bucket_count_policy, IncrementalRehash>;
+
+    // Maximal number of old buckets migrated by one insertion while
+    // incremental rehashing is in progress.
+    static constexpr std::size_t rehash_step = 4;
+
 public:
 
+    // Type of node owned by node handles.
+    using node_handle_node_type = node_type;
+
     class iterator
     {
         #ifdef SFL_TEST_HASH_TABLE
@@ -1392,6 +1478,7 @@ private:
         , private bucket_allocator_type
         , private bucket_count_policy
         , private max_load_policy
+        , public rehash_state
     {
     private:
 
@@ -1592,6 +1679,23 @@ private:
 
         ///////////////////////////////////////////////////////////////////////
 
+        void save_old_bucket_count()
+        {
+            this->old_bucket_count_policy_ = static_cast<const bucket_count_policy&>(*this);
+        }
+
+        std::size_t get_old_bucket_count() const
+        {
+            return this->old_bucket_count_policy_.get_bucket_count();
+        }
+
+        std::size_t calculate_old_bucket_index_for_hash(std::size_t hash) const
+        {
+            return this->old_bucket_count_policy_.calculate_bucket_index_for_hash(hash);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
         void assign_copy_functions(const data& other)
         {
             functions::assign_copy(other);
@@ -1708,6 +1812,7 @@ public:
             x = y;
         }
 
+        drop_old_buckets(incremental_rehash());
         drop_buckets(data_.buckets_, data_.get_bucket_count());
     }
 
@@ -1724,12 +1829,15 @@ public:
     template <typename EqualOrUniqueTag>
     void assign_copy(const hash_table& other, EqualOrUniqueTag equal_or_unique_tag)
     {
+        complete_rehash();
         assign_copy_impl(other, equal_or_unique_tag);
     }
 
     template <typename EqualOrUniqueTag>
     void assign_move(hash_table& other, EqualOrUniqueTag equal_or_unique_tag)
     {
+        complete_rehash();
+        other.complete_rehash();
         assign_move_impl(other, equal_or_unique_tag);
     }
 
@@ -1882,6 +1990,8 @@ public:
             x = y;
         }
 
+        drop_old_buckets(incremental_rehash());
+
         for (bucket_pointer x = data_.buckets_, end = x + data_.get_bucket_count(); x != end; ++x)
         {
             x->next_ = nullptr;
@@ -1897,8 +2007,8 @@ public:
         make_node_functor make_node(*this);
         node_pointer x = make_node(std::forward<Args>(args)...);
         auto guard = sfl::dtl::make_scope_guard([&](){ drop_node(x); });
-        auto res = find_node(key_of(x)); // may throw
-        insert_node_equal(x, res.bucket_index, res.pos);
+        auto res = find_node_for_insert(key_of(x)); // may throw
+        insert_node_equal(x, res.hash, res.bucket_index, res.pos);
         guard.dismiss();
         ++data_.size_;
         resize_buckets_and_rehash_if_overloaded();
@@ -1911,14 +2021,14 @@ public:
         make_node_functor make_node(*this);
         node_pointer x = make_node(std::forward<Args>(args)...);
         auto guard = sfl::dtl::make_scope_guard([&](){ drop_node(x); });
-        auto res = find_node(key_of(x)); // may throw
+        auto res = find_node_for_insert(key_of(x)); // may throw
         if (res.pos != nullptr)
         {
             return std::make_pair(iterator(res.pos), false);
         }
         else
         {
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             guard.dismiss();
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
@@ -1933,7 +2043,7 @@ public:
         node_pointer x = make_node(std::forward<Args>(args)...);
         auto guard = sfl::dtl::make_scope_guard([&](){ drop_node(x); });
         auto res = find_node_hint(hint, key_of(x)); // may throw
-        insert_node_equal(x, res.bucket_index, res.pos);
+        insert_node_equal(x, res.hash, res.bucket_index, res.pos);
         guard.dismiss();
         ++data_.size_;
         resize_buckets_and_rehash_if_overloaded();
@@ -1953,7 +2063,7 @@ public:
         }
         else
         {
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             guard.dismiss();
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
@@ -1966,9 +2076,9 @@ private:
     template <typename V, typename MakeNodeFunctor>
     iterator insert_equal(V&& value, MakeNodeFunctor& make_node)
     {
-        auto res = find_node(KeyOfValue()(value));
+        auto res = find_node_for_insert(KeyOfValue()(value));
         node_pointer x = make_node(std::forward<V>(value));
-        insert_node_equal(x, res.bucket_index, res.pos);
+        insert_node_equal(x, res.hash, res.bucket_index, res.pos);
         ++data_.size_;
         resize_buckets_and_rehash_if_overloaded();
         return iterator(x);
@@ -1977,7 +2087,7 @@ private:
     template <typename V, typename MakeNodeFunctor>
     std::pair<iterator, bool> insert_unique(V&& value, MakeNodeFunctor& make_node)
     {
-        auto res = find_node(KeyOfValue()(value));
+        auto res = find_node_for_insert(KeyOfValue()(value));
         if (res.pos != nullptr)
         {
             return std::make_pair(iterator(res.pos), false);
@@ -1985,7 +2095,7 @@ private:
         else
         {
             node_pointer x = make_node(std::forward<V>(value));
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
             return std::make_pair(iterator(x), true);
@@ -2014,7 +2124,7 @@ public:
         auto res = find_node_hint(hint, KeyOfValue()(value));
         make_node_functor make_node(*this);
         node_pointer x = make_node(std::forward<V>(value));
-        insert_node_equal(x, res.bucket_index, res.pos);
+        insert_node_equal(x, res.hash, res.bucket_index, res.pos);
         ++data_.size_;
         resize_buckets_and_rehash_if_overloaded();
         return iterator(x);
@@ -2032,7 +2142,7 @@ public:
         {
             make_node_functor make_node(*this);
             node_pointer x = make_node(std::forward<V>(value));
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
             return iterator(x);
@@ -2042,7 +2152,7 @@ public:
     template <typename K, typename M>
     std::pair<iterator, bool> insert_or_assign(K&& k, M&& obj)
     {
-        auto res = find_node(k);
+        auto res = find_node_for_insert(k);
         if (res.pos != nullptr)
         {
             iterator it(res.pos);
@@ -2058,7 +2168,7 @@ public:
                 std::forward_as_tuple(std::forward<K>(k)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
             return std::make_pair(iterator(x), true);
@@ -2084,7 +2194,7 @@ public:
                 std::forward_as_tuple(std::forward<K>(k)),
                 std::forward_as_tuple(std::forward<M>(obj))
             );
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
             return iterator(x);
@@ -2094,7 +2204,7 @@ public:
     template <typename K, typename... Args>
     std::pair<iterator, bool> try_emplace(K&& k, Args&&... args)
     {
-        auto res = find_node(k);
+        auto res = find_node_for_insert(k);
         if (res.pos != nullptr)
         {
             return std::make_pair(iterator(res.pos), false);
@@ -2108,7 +2218,7 @@ public:
                 std::forward_as_tuple(std::forward<K>(k)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
             return std::make_pair(iterator(x), true);
@@ -2132,7 +2242,7 @@ public:
                 std::forward_as_tuple(std::forward<K>(k)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
             );
-            insert_node_unique(x, res.bucket_index);
+            insert_node_unique(x, res.hash, res.bucket_index);
             ++data_.size_;
             resize_buckets_and_rehash_if_overloaded();
             return iterator(x);
@@ -2185,6 +2295,23 @@ public:
     template <typename K>
     size_type erase_key_unique(const K& k)
     {
+        if (is_rehashing())
+        {
+            base_node_pointer x = find_node(k).pos;
+
+            if (x != nullptr)
+            {
+                remove_node_unique(x);
+                drop_node(static_cast<node_pointer>(x));
+                --data_.size_;
+                return 1;
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
         base_node_pointer prev = find_node_before(k).pos;
 
         if (prev != nullptr)
@@ -2203,9 +2330,199 @@ public:
 
     void swap(hash_table& other)
     {
+        complete_rehash();
+        other.complete_rehash();
         swap_impl(other);
     }
 
+    template <typename NodeHandle>
+    NodeHandle extract_equal(const_iterator pos)
+    {
+        remove_node_equal(pos.node_);
+        --data_.size_;
+        return sfl::dtl::node_handle_access::make<NodeHandle>(static_cast<node_pointer>(pos.node_), data_.ref_to_node_alloc());
+    }
+
+    template <typename NodeHandle>
+    NodeHandle extract_unique(const_iterator pos)
+    {
+        remove_node_unique(pos.node_);
+        --data_.size_;
+        return sfl::dtl::node_handle_access::make<NodeHandle>(static_cast<node_pointer>(pos.node_), data_.ref_to_node_alloc());
+    }
+
+    template <typename NodeHandle, typename K>
+    NodeHandle extract_key_equal(const K& k)
+    {
+        base_node_pointer x = find_node(k).pos;
+        return x != nullptr ? extract_equal<NodeHandle>(const_iterator(x)) : NodeHandle();
+    }
+
+    template <typename NodeHandle, typename K>
+    NodeHandle extract_key_unique(const K& k)
+    {
+        base_node_pointer x = find_node(k).pos;
+        return x != nullptr ? extract_unique<NodeHandle>(const_iterator(x)) : NodeHandle();
+    }
+
+    template <typename NodeHandle>
+    iterator insert_node_handle_equal(NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = find_node_for_insert(key_of(sfl::dtl::node_handle_access::node(nh))); // may throw
+        node_pointer x = sfl::dtl::node_handle_access::release(nh);
+        insert_node_equal(x, res.hash, res.bucket_index, res.pos);
+        ++data_.size_;
+        resize_buckets_and_rehash_if_overloaded();
+        return iterator(x);
+    }
+
+    template <typename InsertReturnType, typename NodeHandle>
+    InsertReturnType insert_node_handle_unique(NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return InsertReturnType{end(), false, NodeHandle()};
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = find_node_for_insert(key_of(sfl::dtl::node_handle_access::node(nh))); // may throw
+        if (res.pos != nullptr)
+        {
+            return InsertReturnType{iterator(res.pos), false, std::move(nh)};
+        }
+        else
+        {
+            node_pointer x = sfl::dtl::node_handle_access::release(nh);
+            insert_node_unique(x, res.hash, res.bucket_index);
+            ++data_.size_;
+            resize_buckets_and_rehash_if_overloaded();
+            return InsertReturnType{iterator(x), true, NodeHandle()};
+        }
+    }
+
+    template <typename NodeHandle>
+    iterator insert_node_handle_hint_equal(const_iterator hint, NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = find_node_hint(hint, key_of(sfl::dtl::node_handle_access::node(nh))); // may throw
+        node_pointer x = sfl::dtl::node_handle_access::release(nh);
+        insert_node_equal(x, res.hash, res.bucket_index, res.pos);
+        ++data_.size_;
+        resize_buckets_and_rehash_if_overloaded();
+        return iterator(x);
+    }
+
+    template <typename NodeHandle>
+    iterator insert_node_handle_hint_unique(const_iterator hint, NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = find_node_hint(hint, key_of(sfl::dtl::node_handle_access::node(nh))); // may throw
+        if (res.pos != nullptr)
+        {
+            return iterator(res.pos);
+        }
+        else
+        {
+            node_pointer x = sfl::dtl::node_handle_access::release(nh);
+            insert_node_unique(x, res.hash, res.bucket_index);
+            ++data_.size_;
+            resize_buckets_and_rehash_if_overloaded();
+            return iterator(x);
+        }
+    }
+
+    // Moves all nodes from `other` to this table. Nodes are relinked, not
+    // reallocated. Allocators must compare equal.
+    template <typename HashTable>
+    void merge_equal(HashTable& other)
+    {
+        static_assert
+        (
+            std::is_same<typename HashTable::node_handle_node_type, node_type>::value,
+            "Node types must be same."
+        );
+
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        SFL_ASSERT(data_.ref_to_node_alloc() == other.data_.ref_to_node_alloc());
+
+        base_node_pointer x = other.data_.head()->next_;
+
+        while (x != nullptr)
+        {
+            auto res = find_node_for_insert(key_of(x)); // may throw
+            base_node_pointer y = other.remove_node_equal(x);
+            --other.data_.size_;
+            insert_node_equal(static_cast<node_pointer>(x), res.hash, res.bucket_index, res.pos);
+            ++data_.size_;
+            resize_buckets_and_rehash_if_overloaded();
+            x = y;
+        }
+    }
+
+    // Moves nodes from `other` to this table if this table does not contain
+    // element with equivalent key. Nodes are relinked, not reallocated.
+    // Allocators must compare equal.
+    template <typename HashTable>
+    void merge_unique(HashTable& other)
+    {
+        static_assert
+        (
+            std::is_same<typename HashTable::node_handle_node_type, node_type>::value,
+            "Node types must be same."
+        );
+
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        SFL_ASSERT(data_.ref_to_node_alloc() == other.data_.ref_to_node_alloc());
+
+        base_node_pointer x = other.data_.head()->next_;
+
+        while (x != nullptr)
+        {
+            auto res = find_node_for_insert(key_of(x)); // may throw
+            if (res.pos == nullptr)
+            {
+                base_node_pointer y = other.remove_node_equal(x);
+                --other.data_.size_;
+                insert_node_unique(static_cast<node_pointer>(x), res.hash, res.bucket_index);
+                ++data_.size_;
+                resize_buckets_and_rehash_if_overloaded();
+                x = y;
+            }
+            else
+            {
+                x = x->next_;
+            }
+        }
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -2292,6 +2609,24 @@ public:
         return find_node(k).pos != nullptr;
     }
 
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return find_batch_aux(first, last, out, [](base_node_pointer x) { return iterator(x); });
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return find_batch_aux(first, last, out, [](base_node_pointer x) { return const_iterator(x); });
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return find_batch_aux(first, last, out, [](base_node_pointer x) { return x != nullptr; });
+    }
+
     //
     // ---- BUCKET INTERFACE --------------------------------------------------
     //
@@ -2300,6 +2635,7 @@ public:
     local_iterator begin(size_type n)
     {
         SFL_ASSERT(n < bucket_count());
+        complete_rehash();
         bucket_pointer bucket = data_.buckets_ + n;
         return bucket->next_ != nullptr
                 ? local_iterator(bucket->next_->next_, n)
@@ -2309,6 +2645,12 @@ public:
     SFL_NODISCARD
     const_local_iterator begin(size_type n) const
     {
+        static_assert
+        (
+            !IncrementalRehash,
+            "Const bucket interface is not available with incremental rehashing."
+        );
+
         SFL_ASSERT(n < bucket_count());
         bucket_pointer bucket = data_.buckets_ + n;
         return bucket->next_ != nullptr
@@ -2319,6 +2661,12 @@ public:
     SFL_NODISCARD
     const_local_iterator cbegin(size_type n) const
     {
+        static_assert
+        (
+            !IncrementalRehash,
+            "Const bucket interface is not available with incremental rehashing."
+        );
+
         SFL_ASSERT(n < bucket_count());
         bucket_pointer bucket = data_.buckets_ + n;
         return bucket->next_ != nullptr
@@ -2366,9 +2714,22 @@ public:
         );
     }
 
+    SFL_NODISCARD
+    size_type bucket_size(size_type n)
+    {
+        SFL_ASSERT(n < bucket_count());
+        return std::distance(begin(n), end(n));
+    }
+
     SFL_NODISCARD
     size_type bucket_size(size_type n) const
     {
+        static_assert
+        (
+            !IncrementalRehash,
+            "Const bucket interface is not available with incremental rehashing."
+        );
+
         SFL_ASSERT(n < bucket_count());
         return std::distance(begin(n), end(n));
     }
@@ -2407,6 +2768,8 @@ public:
 
     void rehash(size_type count)
     {
+        complete_rehash();
+
         const std::size_t new_bucket_count = data_.calculate_new_bucket_count
         (
             std::max<std::size_t>
@@ -2590,6 +2953,8 @@ private:
             : table_(table)
             , x_(table.data_.head()->next_)
         {
+            table_.drop_old_buckets(incremental_rehash());
+
             for (bucket_pointer x = table_.data_.buckets_, end = x + table_.data_.get_bucket_count(); x != end; ++x)
             {
                 x->next_ = nullptr;
@@ -2677,89 +3042,216 @@ private:
 
     ///////////////////////////////////////////////////////////////////////////
 
+    // Returns hash of the key of node `x`. If hash is stored in node then
+    // hasher is not invoked.
+    std::size_t hash_of(node_pointer x, std::true_type) const noexcept
+    {
+        return x->get_hash();
+    }
+
+    std::size_t hash_of(node_pointer x, std::false_type) const
+    {
+        return data_.ref_to_key_hash()(key_of(x));
+    }
+
+    // Returns hash of the key of node `x` that was just constructed from
+    // the value of node `src` that belongs to the table whose hasher is
+    // equivalent to the hasher of this table.
+    std::size_t hash_of_copy(node_pointer /*x*/, node_pointer src, std::true_type) const noexcept
+    {
+        return src->get_hash();
+    }
+
+    std::size_t hash_of_copy(node_pointer x, node_pointer /*src*/, std::false_type) const
+    {
+        return data_.ref_to_key_hash()(key_of(x));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
     struct find_node_result
     {
         base_node_pointer pos;
+        std::size_t       hash;
         std::size_t       bucket_index;
     };
 
     template <typename K>
     find_node_result find_node(const K& k) const
     {
-        const std::size_t hash = data_.ref_to_key_hash()(k);
+        return find_node(k, data_.ref_to_key_hash()(k));
+    }
 
+    template <typename K>
+    find_node_result find_node(const K& k, std::size_t hash) const
+    {
         const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
 
+        if (is_rehashing())
+        {
+            base_node_pointer x = find_node_in_old_buckets(k, hash, incremental_rehash());
+
+            if (x != nullptr)
+            {
+                return find_node_result{x, hash, bucket_index};
+            }
+        }
+
         bucket_pointer bucket = data_.buckets_ + bucket_index;
 
         if (bucket->next_ != nullptr)
         {
+            // Nodes that are not yet migrated do not belong to the current bucket array.
+            const base_node_pointer last = first_unmigrated_node();
+
             base_node_pointer x = bucket->next_->next_;
 
-            while (x != nullptr && bucket_index_of(x) == bucket_index)
+            while (x != last && bucket_index_of(x) == bucket_index)
             {
-                if (data_.ref_to_key_equal()(k, key_of(x)))
+                if (static_cast<node_pointer>(x)->hash_equals(hash) && data_.ref_to_key_equal()(k, key_of(x)))
                 {
-                    return find_node_result{x, bucket_index};
+                    return find_node_result{x, hash, bucket_index};
                 }
 
                 x = x->next_;
             }
         }
 
-        return find_node_result{nullptr, bucket_index};
+        return find_node_result{nullptr, hash, bucket_index};
+    }
+
+    // Like `find_node`, but it also migrates old bucket that can contain `k`
+    // if incremental rehashing is in progress. Returned node (if any) always
+    // belongs to the current bucket array.
+    template <typename K>
+    find_node_result find_node_for_insert(const K& k)
+    {
+        const std::size_t hash = data_.ref_to_key_hash()(k);
+        migrate_old_buckets(hash, incremental_rehash());
+        return find_node(k, hash);
     }
 
     template <typename K>
-    find_node_result find_node_hint(const_iterator hint, const K& k) const
+    find_node_result find_node_hint(const_iterator hint, const K& k)
     {
-        if (hint.node_ != nullptr && data_.ref_to_key_equal()(key_of(hint.node_), k))
+        if (hint.node_ != nullptr && !is_rehashing() && data_.ref_to_key_equal()(key_of(hint.node_), k))
         {
-            return find_node_result{hint.node_, bucket_index_of(hint.node_)};
+            return find_node_result{hint.node_, static_cast<node_pointer>(hint.node_)->get_hash(), bucket_index_of(hint.node_)};
         }
         else
         {
-            return find_node(k);
+            return find_node_for_insert(k);
         }
     }
 
-    template <typename K>
-    find_node_result find_node_before(const K& k) const
+    // Maximal number of keys that `find_batch_aux` processes at once.
+    static constexpr std::size_t batch_size = 16;
+
+    // Looks up keys in range [first, last) and writes `fn(pos)` to `out` for
+    // each key, where `pos` is the node found or nullptr. Keys are processed
+    // in batches of at most `batch_size` keys. For each batch all keys are
+    // hashed first, then buckets, nodes preceding first nodes in buckets and
+    // first nodes in buckets are prefetched in separate passes, and only then
+    // keys are compared. This way cache misses of different keys overlap
+    // instead of being serialized.
+    template <typename ForwardIt, typename OutputIt, typename Function>
+    OutputIt find_batch_aux(ForwardIt first, ForwardIt last, OutputIt out, Function fn) const
     {
-        const std::size_t hash = data_.ref_to_key_hash()(k);
+        std::size_t hashes[batch_size];
+        std::size_t bucket_indexes[batch_size];
 
-        const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
+        while (first != last)
+        {
+            const ForwardIt batch_first = first;
 
-        bucket_pointer bucket = data_.buckets_ + bucket_index;
+            std::size_t n = 0;
 
-        if (bucket->next_ != nullptr)
-        {
-            base_node_pointer prev = bucket->next_;
-            base_node_pointer x = prev->next_;
+            for (; first != last && n < batch_size; ++first, ++n)
+            {
+                hashes[n] = data_.ref_to_key_hash()(*first);
+                bucket_indexes[n] = data_.calculate_bucket_index_for_hash(hashes[n]);
+                SFL_PREFETCH(sfl::dtl::to_address(data_.buckets_ + bucket_indexes[n]));
+            }
 
-            while (x != nullptr && bucket_index_of(x) == bucket_index)
+            for (std::size_t i = 0; i < n; ++i)
             {
-                if (data_.ref_to_key_equal()(k, key_of(x)))
+                const base_node_pointer prev = data_.buckets_[bucket_indexes[i]].next_;
+
+                if (prev != nullptr)
                 {
-                    return find_node_result{prev, bucket_index};
+                    SFL_PREFETCH(sfl::dtl::to_address(prev));
                 }
-
-                prev = x;
-                x = prev->next_;
             }
-        }
 
-        return find_node_result{nullptr, bucket_index};
-    }
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const base_node_pointer prev = data_.buckets_[bucket_indexes[i]].next_;
+
+                if (prev != nullptr && prev->next_ != nullptr)
+                {
+                    SFL_PREFETCH(sfl::dtl::to_address(prev->next_));
+                }
+            }
+
+            ForwardIt it = batch_first;
+
+            for (std::size_t i = 0; i < n; ++i, ++it)
+            {
+                *out = fn(find_node(*it, hashes[i]).pos);
+                ++out;
+            }
+        }
+
+        return out;
+    }
+
+    template <typename K>
+    find_node_result find_node_before(const K& k) const
+    {
+        SFL_ASSERT(!is_rehashing());
+
+        const std::size_t hash = data_.ref_to_key_hash()(k);
+
+        const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
+
+        bucket_pointer bucket = data_.buckets_ + bucket_index;
+
+        if (bucket->next_ != nullptr)
+        {
+            base_node_pointer prev = bucket->next_;
+            base_node_pointer x = prev->next_;
+
+            while (x != nullptr && bucket_index_of(x) == bucket_index)
+            {
+                if (static_cast<node_pointer>(x)->hash_equals(hash) && data_.ref_to_key_equal()(k, key_of(x)))
+                {
+                    return find_node_result{prev, hash, bucket_index};
+                }
+
+                prev = x;
+                x = prev->next_;
+            }
+        }
+
+        return find_node_result{nullptr, hash, bucket_index};
+    }
 
     ///////////////////////////////////////////////////////////////////////////
 
-    void insert_node_equal(node_pointer x, std::size_t bucket_index, base_node_pointer pos)
+    void insert_node_equal(node_pointer x, std::size_t hash, std::size_t bucket_index, base_node_pointer pos)
     {
+        x->set_hash(hash);
+
         if (pos != nullptr)
         {
             x->set_bucket_index(bucket_index, std::false_type());
 
+            if (is_rehashing() && pos == rehash_cursor())
+            {
+                insert_nodes_after_rehash_cursor(x, x, incremental_rehash());
+                return;
+            }
+
             if (pos->next_ != nullptr && bucket_index_of(pos->next_) != bucket_index_of(pos))
             {
                 bucket_pointer other_bucket = data_.buckets_ + bucket_index_of(pos->next_);
@@ -2780,6 +3272,11 @@ private:
                 x->next_ = bucket->next_->next_;
                 bucket->next_->next_ = x;
             }
+            else if (is_rehashing())
+            {
+                bucket->next_ = rehash_cursor();
+                insert_nodes_after_rehash_cursor(x, x, incremental_rehash());
+            }
             else
             {
                 if (data_.head()->next_ != nullptr)
@@ -2795,8 +3292,10 @@ private:
         }
     }
 
-    void insert_node_unique(node_pointer x, std::size_t bucket_index)
+    void insert_node_unique(node_pointer x, std::size_t hash, std::size_t bucket_index)
     {
+        x->set_hash(hash);
+
         x->set_bucket_index(bucket_index, std::true_type());
 
         bucket_pointer bucket = data_.buckets_ + bucket_index;
@@ -2806,6 +3305,11 @@ private:
             x->next_ = bucket->next_->next_;
             bucket->next_->next_ = x;
         }
+        else if (is_rehashing())
+        {
+            bucket->next_ = rehash_cursor();
+            insert_nodes_after_rehash_cursor(x, x, incremental_rehash());
+        }
         else
         {
             if (data_.head()->next_ != nullptr)
@@ -2822,6 +3326,11 @@ private:
 
     base_node_pointer remove_node_equal(base_node_pointer x)
     {
+        if (is_rehashing())
+        {
+            return remove_node_while_rehashing(x, incremental_rehash());
+        }
+
         bucket_pointer bucket = data_.buckets_ + bucket_index_of(x);
 
         SFL_ASSERT(bucket->next_ != nullptr);
@@ -2863,6 +3372,11 @@ private:
 
     base_node_pointer remove_node_unique(base_node_pointer x)
     {
+        if (is_rehashing())
+        {
+            return remove_node_while_rehashing(x, incremental_rehash());
+        }
+
         bucket_pointer bucket = data_.buckets_ + bucket_index_of(x);
 
         SFL_ASSERT(bucket->next_ != nullptr);
@@ -2900,6 +3414,7 @@ private:
     base_node_pointer remove_node_unique(base_node_pointer prev, base_node_pointer x)
     {
         SFL_ASSERT(x == prev->next_);
+        SFL_ASSERT(!is_rehashing());
 
         bucket_pointer bucket = data_.buckets_ + bucket_index_of(x);
 
@@ -2948,11 +3463,22 @@ private:
 
             if (new_bucket_count != data_.get_bucket_count())
             {
-                resize_buckets_and_rehash(new_bucket_count);
+                resize_buckets_and_rehash(new_bucket_count, incremental_rehash());
             }
         }
     }
 
+    void resize_buckets_and_rehash(std::size_t new_bucket_count, std::false_type)
+    {
+        resize_buckets_and_rehash(new_bucket_count);
+    }
+
+    void resize_buckets_and_rehash(std::size_t new_bucket_count, std::true_type)
+    {
+        complete_rehash();
+        start_rehash(new_bucket_count);
+    }
+
     void resize_buckets_and_rehash(std::size_t new_bucket_count)
     {
         SFL_ASSERT(data_.check_bucket_count(new_bucket_count));
@@ -2977,7 +3503,7 @@ private:
             {
                 node_pointer x = static_cast<node_pointer>(prev->next_);
 
-                const std::size_t hash = data_.ref_to_key_hash()(key_of(x));
+                const std::size_t hash = hash_of(x, store_hash());
                 const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
 
                 x->set_bucket_index(bucket_index, std::true_type());
@@ -3028,6 +3554,358 @@ private:
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    //
+    // Incremental rehashing: while rehashing is in progress, the linked list
+    // consists of two parts. Nodes up to and including rehash cursor are
+    // migrated, they belong to the current bucket array. Nodes after rehash
+    // cursor still belong to the old bucket array. In both parts nodes from
+    // the same bucket are adjacent, and each non-empty bucket points to the
+    // node before the first node in that bucket.
+    //
+    // Each insertion migrates the old bucket that can contain the key being
+    // inserted and up to `rehash_step` other old buckets. Lookup and erase do
+    // not migrate nodes, so they neither modify the table in a const member
+    // function nor change the order of the remaining elements.
+    //
+
+    bool is_rehashing() const noexcept
+    {
+        return is_rehashing(incremental_rehash());
+    }
+
+    bool is_rehashing(std::false_type) const noexcept
+    {
+        return false;
+    }
+
+    bool is_rehashing(std::true_type) const noexcept
+    {
+        return data_.old_buckets_ != nullptr;
+    }
+
+    base_node_pointer rehash_cursor() const noexcept
+    {
+        return rehash_cursor(incremental_rehash());
+    }
+
+    base_node_pointer rehash_cursor(std::false_type) const noexcept
+    {
+        return nullptr;
+    }
+
+    base_node_pointer rehash_cursor(std::true_type) const noexcept
+    {
+        return data_.rehash_cursor_;
+    }
+
+    base_node_pointer first_unmigrated_node() const noexcept
+    {
+        return is_rehashing() ? rehash_cursor()->next_ : nullptr;
+    }
+
+    template <typename K>
+    base_node_pointer find_node_in_old_buckets(const K& k, std::size_t hash, std::false_type) const
+    {
+        sfl::dtl::ignore_unused(k, hash);
+        return nullptr;
+    }
+
+    template <typename K>
+    base_node_pointer find_node_in_old_buckets(const K& k, std::size_t hash, std::true_type) const
+    {
+        const std::size_t old_bucket_index = data_.calculate_old_bucket_index_for_hash(hash);
+
+        bucket_pointer old_bucket = data_.old_buckets_ + old_bucket_index;
+
+        if (old_bucket->next_ != nullptr)
+        {
+            base_node_pointer x = old_bucket->next_->next_;
+
+            while (x != nullptr && bucket_index_of(x) == old_bucket_index)
+            {
+                if (static_cast<node_pointer>(x)->hash_equals(hash) && data_.ref_to_key_equal()(k, key_of(x)))
+                {
+                    return x;
+                }
+
+                x = x->next_;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void start_rehash(std::size_t new_bucket_count)
+    {
+        SFL_ASSERT(!is_rehashing());
+
+        if (data_.size_ == 0)
+        {
+            resize_buckets_and_rehash(new_bucket_count);
+            return;
+        }
+
+        SFL_ASSERT(data_.check_bucket_count(new_bucket_count));
+        const auto res = make_buckets(new_bucket_count);
+        SFL_ASSERT(res.count == new_bucket_count);
+
+        for (bucket_pointer x = res.ptr, end = x + res.count; x != end; ++x)
+        {
+            x->next_ = nullptr;
+        }
+
+        data_.old_buckets_ = data_.buckets_;
+        data_.save_old_bucket_count();
+        data_.rehash_cursor_ = data_.head();
+
+        data_.buckets_ = res.ptr;
+        data_.set_bucket_count(res.count);
+    }
+
+    void complete_rehash()
+    {
+        complete_rehash(incremental_rehash());
+    }
+
+    void complete_rehash(std::false_type)
+    {}
+
+    void complete_rehash(std::true_type)
+    {
+        while (is_rehashing())
+        {
+            migrate_old_bucket(bucket_index_of(data_.rehash_cursor_->next_)); // may throw
+        }
+    }
+
+    void migrate_old_buckets(std::size_t hash, std::false_type)
+    {
+        sfl::dtl::ignore_unused(hash);
+    }
+
+    void migrate_old_buckets(std::size_t hash, std::true_type)
+    {
+        if (is_rehashing())
+        {
+            migrate_old_bucket(data_.calculate_old_bucket_index_for_hash(hash)); // may throw
+
+            for (std::size_t i = 0; i < rehash_step && is_rehashing(); ++i)
+            {
+                migrate_old_bucket(bucket_index_of(data_.rehash_cursor_->next_)); // may throw
+            }
+        }
+    }
+
+    // Moves all nodes from the given old bucket to the current bucket array,
+    // one group of equivalent keys at a time. If hasher throws exception, the
+    // table remains in valid state with some groups already migrated.
+    void migrate_old_bucket(std::size_t old_bucket_index)
+    {
+        bucket_pointer old_bucket = data_.old_buckets_ + old_bucket_index;
+
+        while (old_bucket->next_ != nullptr)
+        {
+            base_node_pointer prev = old_bucket->next_;
+            node_pointer first = static_cast<node_pointer>(prev->next_);
+
+            const std::size_t hash = hash_of(first, store_hash()); // may throw
+            const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
+
+            node_pointer last = first;
+
+            while (last->next_ != nullptr && !static_cast<node_pointer>(last->next_)->is_first_in_group())
+            {
+                last = static_cast<node_pointer>(last->next_);
+            }
+
+            // Unlink group from old bucket
+            base_node_pointer next = last->next_;
+
+            prev->next_ = next;
+
+            if (next == nullptr || bucket_index_of(next) != old_bucket_index)
+            {
+                if (next != nullptr)
+                {
+                    bucket_pointer next_old_bucket = data_.old_buckets_ + bucket_index_of(next);
+                    next_old_bucket->next_ = prev;
+                }
+
+                old_bucket->next_ = nullptr;
+            }
+
+            // Link group to new bucket
+            first->set_bucket_index(bucket_index, std::true_type());
+
+            for (node_pointer x = first; x != last; )
+            {
+                x = static_cast<node_pointer>(x->next_);
+                x->set_bucket_index(bucket_index, std::false_type());
+            }
+
+            bucket_pointer bucket = data_.buckets_ + bucket_index;
+
+            if (bucket->next_ != nullptr)
+            {
+                last->next_ = bucket->next_->next_;
+                bucket->next_->next_ = first;
+            }
+            else
+            {
+                bucket->next_ = data_.rehash_cursor_;
+                insert_nodes_after_rehash_cursor(first, last, std::true_type());
+            }
+        }
+
+        if (data_.rehash_cursor_->next_ == nullptr)
+        {
+            drop_old_buckets(std::true_type());
+        }
+    }
+
+    void insert_nodes_after_rehash_cursor(base_node_pointer first, base_node_pointer last, std::false_type)
+    {
+        SFL_ASSERT(false);
+        sfl::dtl::ignore_unused(first, last);
+    }
+
+    void insert_nodes_after_rehash_cursor(base_node_pointer first, base_node_pointer last, std::true_type)
+    {
+        base_node_pointer cursor = data_.rehash_cursor_;
+
+        last->next_ = cursor->next_;
+        cursor->next_ = first;
+
+        data_.rehash_cursor_ = last;
+
+        if (last->next_ != nullptr)
+        {
+            bucket_pointer next_old_bucket = data_.old_buckets_ + bucket_index_of(last->next_);
+            next_old_bucket->next_ = last;
+        }
+    }
+
+    base_node_pointer remove_node_while_rehashing(base_node_pointer x, std::false_type)
+    {
+        SFL_ASSERT(false);
+        sfl::dtl::ignore_unused(x);
+        return nullptr;
+    }
+
+    base_node_pointer remove_node_while_rehashing(base_node_pointer x, std::true_type)
+    {
+        const std::size_t bucket_index = bucket_index_of(x);
+
+        base_node_pointer next = x->next_;
+
+        // Is x in old bucket?
+        if (bucket_index < data_.get_old_bucket_count())
+        {
+            bucket_pointer old_bucket = data_.old_buckets_ + bucket_index;
+
+            if (old_bucket->next_ != nullptr)
+            {
+                base_node_pointer prev = old_bucket->next_;
+
+                while (prev->next_ != x && prev->next_ != nullptr && bucket_index_of(prev->next_) == bucket_index)
+                {
+                    prev = prev->next_;
+                }
+
+                if (prev->next_ == x)
+                {
+                    // Is x last in old bucket?
+                    if (next == nullptr || bucket_index_of(next) != bucket_index)
+                    {
+                        if (next != nullptr)
+                        {
+                            bucket_pointer next_old_bucket = data_.old_buckets_ + bucket_index_of(next);
+                            next_old_bucket->next_ = prev;
+                        }
+
+                        // Is x first in old bucket?
+                        if (old_bucket->next_->next_ == x)
+                        {
+                            old_bucket->next_ = nullptr;
+                        }
+                    }
+
+                    if (static_cast<node_pointer>(x)->is_first_in_group() && next != nullptr)
+                    {
+                        static_cast<node_pointer>(next)->set_first_in_group();
+                    }
+
+                    prev->next_ = next;
+
+                    if (data_.rehash_cursor_->next_ == nullptr)
+                    {
+                        drop_old_buckets(std::true_type());
+                    }
+
+                    return next;
+                }
+            }
+        }
+
+        // x is in current bucket array
+        bucket_pointer bucket = data_.buckets_ + bucket_index;
+
+        SFL_ASSERT(bucket->next_ != nullptr);
+
+        base_node_pointer prev = bucket->next_;
+
+        while (prev->next_ != x)
+        {
+            prev = prev->next_;
+        }
+
+        const bool is_cursor = x == data_.rehash_cursor_;
+
+        // Is x last in bucket?
+        if (is_cursor || next == nullptr || bucket_index_of(next) != bucket_index)
+        {
+            if (next != nullptr)
+            {
+                bucket_pointer next_bucket = (is_cursor ? data_.old_buckets_ : data_.buckets_) + bucket_index_of(next);
+                next_bucket->next_ = prev;
+            }
+
+            // Is x first in bucket?
+            if (bucket->next_->next_ == x)
+            {
+                bucket->next_ = nullptr;
+            }
+        }
+
+        if (static_cast<node_pointer>(x)->is_first_in_group() && next != nullptr && !is_cursor)
+        {
+            static_cast<node_pointer>(next)->set_first_in_group();
+        }
+
+        prev->next_ = next;
+
+        if (is_cursor)
+        {
+            data_.rehash_cursor_ = prev;
+        }
+
+        return next;
+    }
+
+    void drop_old_buckets(std::false_type) noexcept
+    {}
+
+    void drop_old_buckets(std::true_type) noexcept
+    {
+        if (is_rehashing())
+        {
+            drop_buckets(data_.old_buckets_, data_.get_old_bucket_count());
+            data_.old_buckets_ = nullptr;
+            data_.rehash_cursor_ = nullptr;
+        }
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 
     template <typename MakeNodeFunctor>
@@ -3036,16 +3914,16 @@ private:
         while (x != nullptr)
         {
             node_pointer n1 = make_node(static_cast<node_pointer>(x)->value_.ref());
-            const std::size_t hash = data_.ref_to_key_hash()(key_of(n1));
+            const std::size_t hash = hash_of_copy(n1, static_cast<node_pointer>(x), store_hash());
             const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
-            insert_node_unique(n1, bucket_index);
+            insert_node_unique(n1, hash, bucket_index);
             ++data_.size_;
             x = x->next_;
 
             while (x != nullptr && !static_cast<node_pointer>(x)->is_first_in_group())
             {
                 node_pointer n2 = make_node(static_cast<node_pointer>(x)->value_.ref());
-                insert_node_equal(n2, bucket_index, n1);
+                insert_node_equal(n2, hash, bucket_index, n1);
                 ++data_.size_;
                 n1 = n2;
                 x = x->next_;
@@ -3059,9 +3937,9 @@ private:
         while (x != nullptr)
         {
             node_pointer n1 = make_node(static_cast<node_pointer>(x)->value_.ref());
-            const std::size_t hash = data_.ref_to_key_hash()(key_of(n1));
+            const std::size_t hash = hash_of_copy(n1, static_cast<node_pointer>(x), store_hash());
             const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
-            insert_node_unique(n1, bucket_index);
+            insert_node_unique(n1, hash, bucket_index);
             ++data_.size_;
             x = x->next_;
         }
@@ -3073,16 +3951,16 @@ private:
         while (x != nullptr)
         {
             node_pointer n1 = make_node(std::move(static_cast<node_pointer>(x)->value_.ref()));
-            const std::size_t hash = data_.ref_to_key_hash()(key_of(n1));
+            const std::size_t hash = hash_of_copy(n1, static_cast<node_pointer>(x), store_hash());
             const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
-            insert_node_unique(n1, bucket_index);
+            insert_node_unique(n1, hash, bucket_index);
             ++data_.size_;
             x = x->next_;
 
             while (x != nullptr && !static_cast<node_pointer>(x)->is_first_in_group())
             {
                 node_pointer n2 = make_node(std::move(static_cast<node_pointer>(x)->value_.ref()));
-                insert_node_equal(n2, bucket_index, n1);
+                insert_node_equal(n2, hash, bucket_index, n1);
                 ++data_.size_;
                 n1 = n2;
                 x = x->next_;
@@ -3096,9 +3974,9 @@ private:
         while (x != nullptr)
         {
             node_pointer n1 = make_node(std::move(static_cast<node_pointer>(x)->value_.ref()));
-            const std::size_t hash = data_.ref_to_key_hash()(key_of(n1));
+            const std::size_t hash = hash_of_copy(n1, static_cast<node_pointer>(x), store_hash());
             const std::size_t bucket_index = data_.calculate_bucket_index_for_hash(hash);
-            insert_node_unique(n1, bucket_index);
+            insert_node_unique(n1, hash, bucket_index);
             ++data_.size_;
             x = x->next_;
         }
@@ -3152,6 +4030,8 @@ private:
     template <typename EqualOrUniqueTag>
     void initialize_move(hash_table& other, EqualOrUniqueTag equal_or_unique_tag)
     {
+        other.complete_rehash();
+
         // PRECONDITION
         static_assert
         (
@@ -3852,7 +4732,7 @@ private:
                     {
                         base_node_pointer next = old_this->next_;
                         const auto res = other.find_node(key_of(old_this)); // may throw
-                        other.insert_node_equal(static_cast<node_pointer>(old_this), res.bucket_index, res.pos);
+                        other.insert_node_equal(static_cast<node_pointer>(old_this), res.hash, res.bucket_index, res.pos);
                         ++other.data_.size_;
                         other.resize_buckets_and_rehash_if_overloaded();
                         old_this = next;
@@ -3887,7 +4767,7 @@ private:
                     {
                         base_node_pointer next = old_other->next_;
                         const auto res = this->find_node(key_of(old_other)); // may throw
-                        this->insert_node_equal(static_cast<node_pointer>(old_other), res.bucket_index, res.pos);
+                        this->insert_node_equal(static_cast<node_pointer>(old_other), res.hash, res.bucket_index, res.pos);
                         ++this->data_.size_;
                         this->resize_buckets_and_rehash_if_overloaded();
                         old_other = next;
@@ -4032,6 +4912,11 @@ private:
 
     bool verify() const
     {
+        if (is_rehashing())
+        {
+            return verify_while_rehashing(incremental_rehash());
+        }
+
         for (auto it = begin(); it != end(); ++it)
         {
             if (bucket_index_of(it.node_) != bucket(key_of(it.node_)))
@@ -4039,6 +4924,11 @@ private:
                 return false;
             }
 
+            if (store_hash::value && static_cast<node_pointer>(it.node_)->get_hash() != data_.ref_to_key_hash()(key_of(it.node_)))
+            {
+                return false;
+            }
+
             auto er = equal_range(key_of(it.node_));
 
             for (auto it2 = er.first; it2 != er.second; ++it2)
@@ -4072,6 +4962,76 @@ private:
 
         return true;
     }
+
+    bool verify_while_rehashing(std::false_type) const
+    {
+        return false;
+    }
+
+    bool verify_while_rehashing(std::true_type) const
+    {
+        const base_node_pointer cursor = data_.rehash_cursor_;
+
+        if (cursor->next_ == nullptr)
+        {
+            return false;
+        }
+
+        bool migrated = cursor != data_.head();
+
+        std::size_t count = 0;
+
+        for (base_node_pointer prev = data_.head(), x = prev->next_; x != nullptr; prev = x, x = x->next_)
+        {
+            const std::size_t hash = data_.ref_to_key_hash()(key_of(x));
+
+            const std::size_t bucket_index = migrated
+                ? data_.calculate_bucket_index_for_hash(hash)
+                : data_.calculate_old_bucket_index_for_hash(hash);
+
+            if (bucket_index_of(x) != bucket_index)
+            {
+                return false;
+            }
+
+            if (store_hash::value && static_cast<node_pointer>(x)->get_hash() != hash)
+            {
+                return false;
+            }
+
+            if (find_node(key_of(x)).pos == nullptr)
+            {
+                return false;
+            }
+
+            const bool is_first_in_bucket =
+                prev == data_.head() || prev == cursor || bucket_index_of(prev) != bucket_index;
+
+            bucket_pointer bucket = (migrated ? data_.buckets_ : data_.old_buckets_) + bucket_index;
+
+            if (is_first_in_bucket != (bucket->next_ == prev))
+            {
+                return false;
+            }
+
+            if (!static_cast<node_pointer>(x)->is_first_in_group())
+            {
+                if (is_first_in_bucket || !data_.ref_to_key_equal()(key_of(prev), key_of(x)))
+                {
+                    return false;
+                }
+            }
+
+            if (x == cursor)
+            {
+                migrated = false;
+            }
+
+            ++count;
+        }
+
+        return count == data_.size_;
+    }
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -4080,23 +5040,23 @@ private:
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6, typename TP7, typename TP8, typename TP9>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6, typename TP7, typename TP8, typename TP9, bool TP10, bool TP11>
 SFL_NODISCARD
 bool operator==
 (
-    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9>& x,
-    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9>& y
+    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9, TP10, TP11>& x,
+    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9, TP10, TP11>& y
 )
 {
     return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
 }
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6, typename TP7, typename TP8, typename TP9>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6, typename TP7, typename TP8, typename TP9, bool TP10, bool TP11>
 SFL_NODISCARD
 bool operator!=
 (
-    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9>& x,
-    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9>& y
+    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9, TP10, TP11>& x,
+    const hash_table<TP1, TP2, TP3, TP4, TP5, TP6, TP7, TP8, TP9, TP10, TP11>& y
 )
 {
     return !(x == y);
@@ -0,0 +1,420 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_LINEAR_FINGERPRINTS_HPP_INCLUDED
+#define SFL_DETAIL_LINEAR_FINGERPRINTS_HPP_INCLUDED
+
+#include <sfl/detail/algorithm/find_key.hpp>
+#include <sfl/detail/functional/identity.hpp>
+#include <sfl/detail/cpp.hpp>
+
+#include <algorithm>    // copy
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t
+#include <functional>   // equal_to
+#include <limits>       // numeric_limits
+#include <utility>      // move, swap
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// NO LINEAR FINGERPRINTS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Used by `unordered_associative_vector` if keys are not hashed. All
+// operations do nothing and lookup compares keys of all elements.
+class no_linear_fingerprints
+{
+public:
+
+    no_linear_fingerprints() noexcept
+    {}
+
+    template <typename Alloc>
+    explicit no_linear_fingerprints(const Alloc&) noexcept
+    {}
+
+    template <typename Alloc>
+    no_linear_fingerprints(const no_linear_fingerprints&, const Alloc&) noexcept
+    {}
+
+    template <typename K>
+    void push_back(const K&) noexcept
+    {}
+
+    void pop_back() noexcept
+    {}
+
+    template <typename K>
+    void replace(std::size_t, const K&) noexcept
+    {}
+
+    void erase(std::size_t, std::size_t) noexcept
+    {}
+
+    void erase_by_moving_last(std::size_t) noexcept
+    {}
+
+    void erase_by_moving_tail(std::size_t, std::size_t) noexcept
+    {}
+
+    void clear() noexcept
+    {}
+
+    void reserve(std::size_t) noexcept
+    {}
+
+    void shrink_to_fit() noexcept
+    {}
+
+    void swap(no_linear_fingerprints&) noexcept
+    {}
+
+    SFL_NODISCARD
+    bool valid() const noexcept
+    {
+        return true;
+    }
+
+    void invalidate() noexcept
+    {}
+
+    template <typename KeyOfValue, typename Value>
+    void refresh(const Value*, std::size_t, std::size_t) noexcept
+    {}
+
+    template <typename KeyOfValue, typename Value>
+    void rebuild(const Value*, std::size_t) noexcept
+    {}
+
+    // Returns index of the first element in [first, last) whose key is
+    // equal to `k`, or `last` if there is no such element.
+    template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+    std::size_t find(const Value* data, std::size_t first, std::size_t last, const K& k, const KeyEqual& equal) const
+    {
+        return std::size_t(sfl::dtl::find_key<KeyOfValue>(data + first, data + last, k, equal) - data);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// LINEAR FINGERPRINTS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Array of 8-bit fingerprints, parallel to the array of elements of
+// `unordered_associative_vector`. Fingerprint at index `i` is computed from
+// the hash value of the key of element at index `i`. Lookup scans
+// fingerprints (several at once using SIMD instructions if available) and
+// compares keys only if fingerprints are equal.
+//
+// If fingerprints cannot be recomputed after an exception, they are
+// invalidated: there are no fingerprints, all modifications do nothing, and
+// lookup compares keys of all elements. Fingerprints become valid again when
+// they are cleared or rebuilt.
+//
+// `Vector` is a vector of `std::uint8_t` with the same kind of storage as
+// the vector of elements (static, small or dynamic).
+template <typename Hash, typename Vector>
+class linear_fingerprints : private Hash
+{
+private:
+
+    Vector fingerprints_;
+
+    bool valid_;
+
+public:
+
+    linear_fingerprints()
+        : Hash()
+        , fingerprints_()
+        , valid_(true)
+    {}
+
+    template <typename Alloc>
+    explicit linear_fingerprints(const Alloc& alloc)
+        : Hash()
+        , fingerprints_(typename Vector::allocator_type(alloc))
+        , valid_(true)
+    {}
+
+    linear_fingerprints(const linear_fingerprints& other)
+        : Hash(other.ref_to_hash())
+        , fingerprints_(other.fingerprints_)
+        , valid_(other.valid_)
+    {}
+
+    template <typename Alloc>
+    linear_fingerprints(const linear_fingerprints& other, const Alloc& alloc)
+        : Hash(other.ref_to_hash())
+        , fingerprints_(other.fingerprints_, typename Vector::allocator_type(alloc))
+        , valid_(other.valid_)
+    {}
+
+    linear_fingerprints(linear_fingerprints&& other)
+        : Hash(std::move(other.ref_to_hash()))
+        , fingerprints_(std::move(other.fingerprints_))
+        , valid_(other.valid_)
+    {}
+
+    template <typename Alloc>
+    linear_fingerprints(linear_fingerprints&& other, const Alloc& alloc)
+        : Hash(std::move(other.ref_to_hash()))
+        , fingerprints_(std::move(other.fingerprints_), typename Vector::allocator_type(alloc))
+        , valid_(other.valid_)
+    {}
+
+    linear_fingerprints& operator=(const linear_fingerprints& other)
+    {
+        ref_to_hash() = other.ref_to_hash();
+        fingerprints_ = other.fingerprints_;
+        valid_ = other.valid_;
+        return *this;
+    }
+
+    linear_fingerprints& operator=(linear_fingerprints&& other)
+    {
+        ref_to_hash() = std::move(other.ref_to_hash());
+        fingerprints_ = std::move(other.fingerprints_);
+        valid_ = other.valid_;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    Hash& ref_to_hash() noexcept
+    {
+        return *this;
+    }
+
+    SFL_NODISCARD
+    const Hash& ref_to_hash() const noexcept
+    {
+        return *this;
+    }
+
+    SFL_NODISCARD
+    bool valid() const noexcept
+    {
+        return valid_;
+    }
+
+    // Drops all fingerprints. Lookup compares keys of all elements until
+    // fingerprints are cleared or rebuilt.
+    void invalidate() noexcept
+    {
+        fingerprints_.clear();
+        valid_ = false;
+    }
+
+    template <typename K>
+    void push_back(const K& k)
+    {
+        if (valid_)
+        {
+            fingerprints_.push_back(fingerprint(k));
+        }
+    }
+
+    void pop_back() noexcept
+    {
+        if (valid_)
+        {
+            fingerprints_.pop_back();
+        }
+    }
+
+    template <typename K>
+    void replace(std::size_t pos, const K& k)
+    {
+        if (valid_)
+        {
+            fingerprints_.data()[pos] = fingerprint(k);
+        }
+    }
+
+    // Removes fingerprints in [first, last) and shifts the following ones.
+    void erase(std::size_t first, std::size_t last) noexcept
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        fingerprints_.erase(fingerprints_.nth(first), fingerprints_.nth(last));
+    }
+
+    // Removes fingerprint at `pos` and moves the last fingerprint into its
+    // place.
+    void erase_by_moving_last(std::size_t pos) noexcept
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        fingerprints_.data()[pos] = fingerprints_.back();
+        fingerprints_.pop_back();
+    }
+
+    // Removes fingerprints in [first, last) and moves the same number of
+    // fingerprints from the end into their place. There must be at least
+    // `last - first` fingerprints after `last`.
+    void erase_by_moving_tail(std::size_t first, std::size_t last) noexcept
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        const std::size_t tail = fingerprints_.size() - (last - first);
+
+        std::copy
+        (
+            fingerprints_.data() + tail,
+            fingerprints_.data() + fingerprints_.size(),
+            fingerprints_.data() + first
+        );
+
+        fingerprints_.erase(fingerprints_.nth(tail), fingerprints_.end());
+    }
+
+    void clear() noexcept
+    {
+        fingerprints_.clear();
+        valid_ = true;
+    }
+
+    void reserve(std::size_t new_cap)
+    {
+        if (valid_)
+        {
+            fingerprints_.reserve(new_cap);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        fingerprints_.shrink_to_fit();
+    }
+
+    void swap(linear_fingerprints& other)
+    {
+        using std::swap;
+        swap(ref_to_hash(), other.ref_to_hash());
+        fingerprints_.swap(other.fingerprints_);
+        swap(valid_, other.valid_);
+    }
+
+    // Recomputes fingerprints in [first, last) from keys of elements.
+    template <typename KeyOfValue, typename Value>
+    void refresh(const Value* data, std::size_t first, std::size_t last)
+    {
+        for (; first != last; ++first)
+        {
+            replace(first, KeyOfValue()(data[first]));
+        }
+    }
+
+    // Recomputes all fingerprints from keys of `size` elements. On
+    // exception, fingerprints are invalidated.
+    template <typename KeyOfValue, typename Value>
+    void rebuild(const Value* data, std::size_t size)
+    {
+        clear();
+
+        SFL_TRY
+        {
+            fingerprints_.reserve(size);
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                push_back(KeyOfValue()(data[i]));
+            }
+        }
+        SFL_CATCH (...)
+        {
+            invalidate();
+            SFL_RETHROW;
+        }
+    }
+
+    // Returns index of the first element in [first, last) whose key is
+    // equal to `k`, or `last` if there is no such element.
+    template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+    std::size_t find(const Value* data, std::size_t first, std::size_t last, const K& k, const KeyEqual& equal) const
+    {
+        if (!valid_)
+        {
+            return std::size_t(sfl::dtl::find_key<KeyOfValue>(data + first, data + last, k, equal) - data);
+        }
+
+        const std::uint8_t fp = fingerprint(k);
+
+        const std::uint8_t* const fps = fingerprints_.data();
+
+        while (first != last)
+        {
+            first = std::size_t
+            (
+                sfl::dtl::find_key<sfl::dtl::identity>(fps + first, fps + last, fp, std::equal_to<std::uint8_t>()) - fps
+            );
+
+            if (first == last || equal(KeyOfValue()(data[first]), k))
+            {
+                break;
+            }
+
+            ++first;
+        }
+
+        return first;
+    }
+
+private:
+
+    // Folds all bits of the hash value into the lowest byte, so both hash
+    // functions that vary only the low bits (e.g. identity for integers)
+    // and hash functions that vary only the high bits give good fingerprints.
+    template <typename K>
+    std::uint8_t fingerprint(const K& k) const
+    {
+        std::size_t h = ref_to_hash()(k);
+
+        for (int shift = std::numeric_limits<std::size_t>::digits / 2; shift >= 8; shift /= 2)
+        {
+            h ^= h >> shift;
+        }
+
+        return static_cast<std::uint8_t>(h);
+    }
+};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_LINEAR_FINGERPRINTS_HPP_INCLUDED
@@ -0,0 +1,582 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_LINEAR_HASH_INDEX_HPP_INCLUDED
+#define SFL_DETAIL_LINEAR_HASH_INDEX_HPP_INCLUDED
+
+#include <sfl/detail/algorithm/find_key.hpp>
+#include <sfl/detail/functional/identity.hpp>
+#include <sfl/detail/cpp.hpp>
+
+#include <algorithm>    // copy, fill
+#include <cstddef>      // size_t
+#include <functional>   // equal_to
+#include <limits>       // numeric_limits
+#include <utility>      // move, swap
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// LINEAR HASH INDEX
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Used by `unordered_associative_vector` to switch from linear search to
+// hashed lookup when the number of elements grows past `Threshold`.
+//
+// Hash value of each element is kept in an array parallel to the array of
+// elements. While there are at most `Threshold` elements, lookup scans that
+// array and compares keys only if hash values are equal.
+//
+// When the number of elements exceeds `Threshold`, an open addressing hash
+// table with linear probing is built over the existing elements. Each slot
+// holds index of an element plus one (zero means empty slot). The table is
+// at most half full, so probe sequences stay short. Elements are never
+// moved because of the table. The table is destroyed when the number of
+// elements drops to `Threshold / 2` or less, so alternating insertions and
+// removals near the threshold do not rebuild it repeatedly.
+//
+// If hash values cannot be recomputed after an exception, the index is
+// invalidated: it holds nothing, all modifications do nothing, and lookup
+// compares keys of all elements. It becomes valid again when it is cleared
+// or rebuilt.
+//
+// `HashVector` is a vector of `std::size_t` with the same kind of storage as
+// the vector of elements. `SlotVector` is a vector of `std::size_t`.
+template <typename Hash, std::size_t Threshold, typename HashVector, typename SlotVector>
+class linear_hash_index : private Hash
+{
+private:
+
+    HashVector hashes_;
+
+    SlotVector slots_;
+
+    bool valid_;
+
+    static constexpr std::size_t min_slot_count = 16;
+
+public:
+
+    linear_hash_index()
+        : Hash()
+        , hashes_()
+        , slots_()
+        , valid_(true)
+    {}
+
+    template <typename Alloc>
+    explicit linear_hash_index(const Alloc& alloc)
+        : Hash()
+        , hashes_(typename HashVector::allocator_type(alloc))
+        , slots_(typename SlotVector::allocator_type(alloc))
+        , valid_(true)
+    {}
+
+    linear_hash_index(const linear_hash_index& other)
+        : Hash(other.ref_to_hash())
+        , hashes_(other.hashes_)
+        , slots_(other.slots_)
+        , valid_(other.valid_)
+    {}
+
+    template <typename Alloc>
+    linear_hash_index(const linear_hash_index& other, const Alloc& alloc)
+        : Hash(other.ref_to_hash())
+        , hashes_(other.hashes_, typename HashVector::allocator_type(alloc))
+        , slots_(other.slots_, typename SlotVector::allocator_type(alloc))
+        , valid_(other.valid_)
+    {}
+
+    linear_hash_index(linear_hash_index&& other)
+        : Hash(std::move(other.ref_to_hash()))
+        , hashes_(std::move(other.hashes_))
+        , slots_(std::move(other.slots_))
+        , valid_(other.valid_)
+    {}
+
+    template <typename Alloc>
+    linear_hash_index(linear_hash_index&& other, const Alloc& alloc)
+        : Hash(std::move(other.ref_to_hash()))
+        , hashes_(std::move(other.hashes_), typename HashVector::allocator_type(alloc))
+        , slots_(std::move(other.slots_), typename SlotVector::allocator_type(alloc))
+        , valid_(other.valid_)
+    {}
+
+    linear_hash_index& operator=(const linear_hash_index& other)
+    {
+        ref_to_hash() = other.ref_to_hash();
+        hashes_ = other.hashes_;
+        slots_ = other.slots_;
+        valid_ = other.valid_;
+        return *this;
+    }
+
+    linear_hash_index& operator=(linear_hash_index&& other)
+    {
+        ref_to_hash() = std::move(other.ref_to_hash());
+        hashes_ = std::move(other.hashes_);
+        slots_ = std::move(other.slots_);
+        valid_ = other.valid_;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    Hash& ref_to_hash() noexcept
+    {
+        return *this;
+    }
+
+    SFL_NODISCARD
+    const Hash& ref_to_hash() const noexcept
+    {
+        return *this;
+    }
+
+    // Returns true if lookup uses the hash table.
+    SFL_NODISCARD
+    bool indexed() const noexcept
+    {
+        return !slots_.empty();
+    }
+
+    SFL_NODISCARD
+    bool valid() const noexcept
+    {
+        return valid_;
+    }
+
+    // Drops all hash values and the table. Lookup compares keys of all
+    // elements until the index is cleared or rebuilt.
+    void invalidate() noexcept
+    {
+        hashes_.clear();
+        release();
+        valid_ = false;
+    }
+
+    template <typename K>
+    void push_back(const K& k)
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        hashes_.push_back(hash(k));
+
+        SFL_TRY
+        {
+            const std::size_t size = hashes_.size();
+
+            if (indexed())
+            {
+                if (2 * size > slots_.size())
+                {
+                    rebuild(2 * slots_.size());
+                }
+                else
+                {
+                    insert_slot(size - 1);
+                }
+            }
+            else if (size > Threshold)
+            {
+                rebuild(slot_count_for(size));
+            }
+        }
+        SFL_CATCH (...)
+        {
+            // Table is unchanged and does not contain the new hash value.
+            hashes_.pop_back();
+            SFL_RETHROW;
+        }
+    }
+
+    void pop_back() noexcept
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        if (indexed())
+        {
+            erase_slot(find_slot(hashes_.size() - 1));
+        }
+
+        hashes_.pop_back();
+
+        release_if_small();
+    }
+
+    template <typename K>
+    void replace(std::size_t pos, const K& k)
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        const std::size_t h = hash(k);
+
+        if (indexed())
+        {
+            erase_slot(find_slot(pos));
+            hashes_.data()[pos] = h;
+            insert_slot(pos);
+        }
+        else
+        {
+            hashes_.data()[pos] = h;
+        }
+    }
+
+    // Removes hash values in [first, last) and shifts the following ones.
+    // Indices of the following elements change, so the table is refilled.
+    void erase(std::size_t first, std::size_t last) noexcept
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        hashes_.erase(hashes_.nth(first), hashes_.nth(last));
+
+        release_if_small();
+
+        if (indexed())
+        {
+            std::fill(slots_.begin(), slots_.end(), std::size_t(0));
+
+            for (std::size_t i = 0; i != hashes_.size(); ++i)
+            {
+                insert_slot(i);
+            }
+        }
+    }
+
+    // Removes hash value at `pos` and moves the last hash value into its
+    // place.
+    void erase_by_moving_last(std::size_t pos) noexcept
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        const std::size_t last = hashes_.size() - 1;
+
+        if (indexed())
+        {
+            erase_slot(find_slot(pos));
+
+            if (pos != last)
+            {
+                slots_.data()[find_slot(last)] = pos + 1;
+            }
+        }
+
+        hashes_.data()[pos] = hashes_.data()[last];
+        hashes_.pop_back();
+
+        release_if_small();
+    }
+
+    // Removes hash values in [first, last) and moves the same number of
+    // hash values from the end into their place. There must be at least
+    // `last - first` hash values after `last`.
+    void erase_by_moving_tail(std::size_t first, std::size_t last) noexcept
+    {
+        if (!valid_)
+        {
+            return;
+        }
+
+        const std::size_t tail = hashes_.size() - (last - first);
+
+        if (indexed())
+        {
+            for (std::size_t i = first; i != last; ++i)
+            {
+                erase_slot(find_slot(i));
+            }
+
+            for (std::size_t i = tail; i != hashes_.size(); ++i)
+            {
+                slots_.data()[find_slot(i)] = first + (i - tail) + 1;
+            }
+        }
+
+        std::copy
+        (
+            hashes_.data() + tail,
+            hashes_.data() + hashes_.size(),
+            hashes_.data() + first
+        );
+
+        hashes_.erase(hashes_.nth(tail), hashes_.end());
+
+        release_if_small();
+    }
+
+    void clear() noexcept
+    {
+        hashes_.clear();
+        release();
+        valid_ = true;
+    }
+
+    void reserve(std::size_t new_cap)
+    {
+        if (valid_)
+        {
+            hashes_.reserve(new_cap);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        hashes_.shrink_to_fit();
+    }
+
+    void swap(linear_hash_index& other)
+    {
+        using std::swap;
+        swap(ref_to_hash(), other.ref_to_hash());
+        hashes_.swap(other.hashes_);
+        slots_.swap(other.slots_);
+        swap(valid_, other.valid_);
+    }
+
+    // Recomputes hash values in [first, last) from keys of elements.
+    template <typename KeyOfValue, typename Value>
+    void refresh(const Value* data, std::size_t first, std::size_t last)
+    {
+        for (; first != last; ++first)
+        {
+            replace(first, KeyOfValue()(data[first]));
+        }
+    }
+
+    // Recomputes all hash values and the table from keys of `size` elements.
+    // On exception, the index is invalidated.
+    template <typename KeyOfValue, typename Value>
+    void rebuild(const Value* data, std::size_t size)
+    {
+        clear();
+
+        SFL_TRY
+        {
+            hashes_.reserve(size);
+
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                push_back(KeyOfValue()(data[i]));
+            }
+        }
+        SFL_CATCH (...)
+        {
+            invalidate();
+            SFL_RETHROW;
+        }
+    }
+
+    // Returns index of the first element in [first, last) whose key is
+    // equal to `k`, or `last` if there is no such element.
+    template <typename KeyOfValue, typename Value, typename K, typename KeyEqual>
+    std::size_t find(const Value* data, std::size_t first, std::size_t last, const K& k, const KeyEqual& equal) const
+    {
+        if (!valid_)
+        {
+            return std::size_t(sfl::dtl::find_key<KeyOfValue>(data + first, data + last, k, equal) - data);
+        }
+
+        const std::size_t h = hash(k);
+
+        const std::size_t* const hashes = hashes_.data();
+
+        if (!indexed())
+        {
+            while (first != last)
+            {
+                first = std::size_t
+                (
+                    sfl::dtl::find_key<sfl::dtl::identity>(hashes + first, hashes + last, h, std::equal_to<std::size_t>()) - hashes
+                );
+
+                if (first == last || equal(KeyOfValue()(data[first]), k))
+                {
+                    break;
+                }
+
+                ++first;
+            }
+
+            return first;
+        }
+
+        // Elements with equal keys may be anywhere in the probe sequence,
+        // so the whole sequence is scanned for the smallest index.
+        const std::size_t* const slots = slots_.data();
+        const std::size_t mask = slots_.size() - 1;
+
+        std::size_t result = last;
+
+        for (std::size_t i = h & mask; slots[i] != 0; i = (i + 1) & mask)
+        {
+            const std::size_t pos = slots[i] - 1;
+
+            if (pos >= first && pos < result && hashes[pos] == h && equal(KeyOfValue()(data[pos]), k))
+            {
+                result = pos;
+
+                if (pos == first)
+                {
+                    break;
+                }
+            }
+        }
+
+        return result;
+    }
+
+private:
+
+    // Scrambles the hash value, so hash functions that vary only some bits
+    // (e.g. identity for integers) still spread elements over the table.
+    template <typename K>
+    std::size_t hash(const K& k) const
+    {
+        std::size_t h = ref_to_hash()(k);
+        h *= std::size_t(0x9E3779B97F4A7C15ull);
+        h ^= h >> (std::numeric_limits<std::size_t>::digits / 2);
+        return h;
+    }
+
+    static std::size_t slot_count_for(std::size_t size) noexcept
+    {
+        std::size_t n = min_slot_count;
+
+        while (n < 2 * size)
+        {
+            n *= 2;
+        }
+
+        return n;
+    }
+
+    // Builds a new table with `n` slots. Strong exception guarantee.
+    void rebuild(std::size_t n)
+    {
+        SlotVector slots(slots_.get_allocator());
+        slots.resize(n);
+        slots_.swap(slots);
+
+        for (std::size_t i = 0; i != hashes_.size(); ++i)
+        {
+            insert_slot(i);
+        }
+    }
+
+    void release() noexcept
+    {
+        SlotVector(slots_.get_allocator()).swap(slots_);
+    }
+
+    void release_if_small() noexcept
+    {
+        if (indexed() && hashes_.size() <= Threshold / 2)
+        {
+            release();
+        }
+    }
+
+    void insert_slot(std::size_t pos) noexcept
+    {
+        std::size_t* const slots = slots_.data();
+        const std::size_t mask = slots_.size() - 1;
+
+        std::size_t i = hashes_.data()[pos] & mask;
+
+        while (slots[i] != 0)
+        {
+            i = (i + 1) & mask;
+        }
+
+        slots[i] = pos + 1;
+    }
+
+    // Returns slot that holds element at `pos`.
+    std::size_t find_slot(std::size_t pos) const noexcept
+    {
+        const std::size_t* const slots = slots_.data();
+        const std::size_t mask = slots_.size() - 1;
+
+        std::size_t i = hashes_.data()[pos] & mask;
+
+        while (slots[i] != pos + 1)
+        {
+            i = (i + 1) & mask;
+        }
+
+        return i;
+    }
+
+    // Empties slot `i` and shifts back the following slots of the probe
+    // sequence, so no lookup stops early at the emptied slot.
+    void erase_slot(std::size_t i) noexcept
+    {
+        std::size_t* const slots = slots_.data();
+        const std::size_t mask = slots_.size() - 1;
+
+        for (std::size_t j = (i + 1) & mask; slots[j] != 0; j = (j + 1) & mask)
+        {
+            const std::size_t home = hashes_.data()[slots[j] - 1] & mask;
+
+            // Slot `j` can be moved to `i` unless its home slot is
+            // cyclically in (i, j].
+            const bool stays = (i < j) ? (i < home && home <= j)
+                                       : (i < home || home <= j);
+
+            if (!stays)
+            {
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+
+        slots[i] = 0;
+    }
+};
+
+template <typename Hash, std::size_t Threshold, typename HashVector, typename SlotVector>
+constexpr std::size_t linear_hash_index<Hash, Threshold, HashVector, SlotVector>::min_slot_count;
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_LINEAR_HASH_INDEX_HPP_INCLUDED
@@ -21,6 +21,8 @@
 #ifndef SFL_DETAIL_ALLOCATE_HPP_INCLUDED
 #define SFL_DETAIL_ALLOCATE_HPP_INCLUDED
 
+#include <sfl/detail/allocator_traits.hpp>
+
 #include <memory> // allocator_traits
 
 namespace sfl
@@ -39,6 +41,24 @@ auto allocate(Allocator& a, Size n) -> typename std::allocator_traits<Allocator>
     return nullptr;
 }
 
+// Allocates storage for at least `n` objects. If allocator provides member
+// function `allocate_at_least` (C++23), the allocator may return more storage
+// than requested and `count` holds the actual number of objects that fit.
+template <typename Allocator, typename Size>
+auto allocate_at_least(Allocator& a, Size n)
+    -> sfl::dtl::allocation_result
+       <
+           typename sfl::dtl::allocator_traits<Allocator>::pointer,
+           typename sfl::dtl::allocator_traits<Allocator>::size_type
+       >
+{
+    if (n != 0)
+    {
+        return sfl::dtl::allocator_traits<Allocator>::allocate_at_least(a, n);
+    }
+    return {nullptr, 0};
+}
+
 } // namespace dtl
 
 } // namespace sfl
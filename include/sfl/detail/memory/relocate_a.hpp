@@ -0,0 +1,290 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+#ifndef SFL_DETAIL_RELOCATE_A_HPP_INCLUDED
+#define SFL_DETAIL_RELOCATE_A_HPP_INCLUDED
+
+#include <sfl/detail/algorithm/move.hpp>
+#include <sfl/detail/algorithm/move_backward.hpp>
+#include <sfl/detail/memory/construct_at_a.hpp>
+#include <sfl/detail/memory/destroy_a.hpp>
+#include <sfl/detail/memory/to_address.hpp>
+#include <sfl/detail/memory/uninitialized_move_if_noexcept_a.hpp>
+#include <sfl/detail/type_traits/is_trivially_relocatable.hpp>
+#include <sfl/detail/utility/ignore_unused.hpp>
+#include <sfl/detail/cpp.hpp>
+
+#include <cstring>     // memcpy, memmove
+#include <iterator>    // distance
+#include <memory>      // pointer_traits
+#include <type_traits> // true_type, false_type
+#include <utility>     // forward, move
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Relocation of elements between contiguous storages is done in two steps:
+//
+//  1. Function `uninitialized_relocate_a` creates elements in uninitialized
+//     storage pointed to by `d_first`. This step can throw an exception.
+//
+//  2. Function `destroy_relocated_a` destroys source elements. This step must
+//     be called exactly once after successful completion of the first step.
+//
+// If elements are trivially relocatable then the first step copies bytes and
+// the second step does nothing.
+//
+
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a_aux(Allocator& a, Pointer first, Pointer last, Pointer d_first, std::true_type)
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    sfl::dtl::ignore_unused(a);
+
+    const auto n = std::distance(first, last);
+
+    if (n != 0)
+    {
+        std::memcpy
+        (
+            static_cast<void*>(sfl::dtl::to_address(d_first)),
+            static_cast<const void*>(sfl::dtl::to_address(first)),
+            n * sizeof(value_type)
+        );
+    }
+
+    return d_first + n;
+}
+
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a_aux(Allocator& a, Pointer first, Pointer last, Pointer d_first, std::false_type)
+{
+    return sfl::dtl::uninitialized_move_if_noexcept_a(a, first, last, d_first);
+}
+
+template <typename Allocator, typename Pointer>
+Pointer uninitialized_relocate_a(Allocator& a, Pointer first, Pointer last, Pointer d_first)
+{
+    return sfl::dtl::uninitialized_relocate_a_aux
+    (
+        a,
+        first,
+        last,
+        d_first,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+template <typename Allocator, typename Pointer>
+void destroy_relocated_a_aux(Allocator& a, Pointer first, Pointer last, std::true_type) noexcept
+{
+    sfl::dtl::ignore_unused(a, first, last);
+}
+
+template <typename Allocator, typename Pointer>
+void destroy_relocated_a_aux(Allocator& a, Pointer first, Pointer last, std::false_type) noexcept
+{
+    sfl::dtl::destroy_a(a, first, last);
+}
+
+template <typename Allocator, typename Pointer>
+void destroy_relocated_a(Allocator& a, Pointer first, Pointer last) noexcept
+{
+    sfl::dtl::destroy_relocated_a_aux
+    (
+        a,
+        first,
+        last,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+//
+// Destroys elements in range [first, last) and closes the gap by shifting
+// elements in range [last, end) to the left. Returns new end of sequence.
+//
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_a_aux(Allocator& a, Pointer first, Pointer last, Pointer end, std::true_type)
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    sfl::dtl::destroy_a(a, first, last);
+
+    const auto n = std::distance(last, end);
+
+    if (n != 0)
+    {
+        std::memmove
+        (
+            static_cast<void*>(sfl::dtl::to_address(first)),
+            static_cast<const void*>(sfl::dtl::to_address(last)),
+            n * sizeof(value_type)
+        );
+    }
+
+    return first + n;
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_a_aux(Allocator& a, Pointer first, Pointer last, Pointer end, std::false_type)
+{
+    const Pointer new_end = sfl::dtl::move(last, end, first);
+    sfl::dtl::destroy_a(a, new_end, end);
+    return new_end;
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_a(Allocator& a, Pointer first, Pointer last, Pointer end)
+{
+    return sfl::dtl::erase_shift_a_aux
+    (
+        a,
+        first,
+        last,
+        end,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+//
+// Destroys elements in range [first, last) and closes the gap by shifting
+// elements in range [begin, first) to the right. Returns new beginning of
+// sequence.
+//
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_backward_a_aux(Allocator& a, Pointer begin, Pointer first, Pointer last, std::true_type)
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    sfl::dtl::destroy_a(a, first, last);
+
+    const auto n = std::distance(begin, first);
+
+    if (n != 0)
+    {
+        std::memmove
+        (
+            static_cast<void*>(sfl::dtl::to_address(last - n)),
+            static_cast<const void*>(sfl::dtl::to_address(begin)),
+            n * sizeof(value_type)
+        );
+    }
+
+    return last - n;
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_backward_a_aux(Allocator& a, Pointer begin, Pointer first, Pointer last, std::false_type)
+{
+    const Pointer new_begin = sfl::dtl::move_backward(begin, first, last);
+    sfl::dtl::destroy_a(a, begin, new_begin);
+    return new_begin;
+}
+
+template <typename Allocator, typename Pointer>
+Pointer erase_shift_backward_a(Allocator& a, Pointer begin, Pointer first, Pointer last)
+{
+    return sfl::dtl::erase_shift_backward_a_aux
+    (
+        a,
+        begin,
+        first,
+        last,
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+//
+// Inserts `value` at position `pos` by shifting elements in range [pos, end)
+// one position to the right. There must be room for one more element at `end`.
+// Parameter `end` is updated as soon as the new last element is created.
+//
+
+template <typename Allocator, typename Pointer, typename T>
+void insert_shift_a_aux(Allocator& a, Pointer pos, Pointer& end, T&& value, std::true_type)
+{
+    using value_type = typename std::pointer_traits<Pointer>::element_type;
+
+    const auto n = std::distance(pos, end);
+
+    std::memmove
+    (
+        static_cast<void*>(sfl::dtl::to_address(pos + 1)),
+        static_cast<const void*>(sfl::dtl::to_address(pos)),
+        n * sizeof(value_type)
+    );
+
+    SFL_TRY
+    {
+        sfl::dtl::construct_at_a(a, pos, std::forward<T>(value));
+    }
+    SFL_CATCH (...)
+    {
+        std::memmove
+        (
+            static_cast<void*>(sfl::dtl::to_address(pos)),
+            static_cast<const void*>(sfl::dtl::to_address(pos + 1)),
+            n * sizeof(value_type)
+        );
+
+        SFL_RETHROW;
+    }
+
+    ++end;
+}
+
+template <typename Allocator, typename Pointer, typename T>
+void insert_shift_a_aux(Allocator& a, Pointer pos, Pointer& end, T&& value, std::false_type)
+{
+    const Pointer old_end = end;
+
+    sfl::dtl::construct_at_a(a, end, std::move(*(end - 1)));
+
+    ++end;
+
+    sfl::dtl::move_backward(pos, old_end - 1, old_end);
+
+    *pos = std::forward<T>(value);
+}
+
+template <typename Allocator, typename Pointer, typename T>
+void insert_shift_a(Allocator& a, Pointer pos, Pointer& end, T&& value)
+{
+    sfl::dtl::insert_shift_a_aux
+    (
+        a,
+        pos,
+        end,
+        std::forward<T>(value),
+        sfl::dtl::is_trivially_relocatable_a<Allocator>()
+    );
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_RELOCATE_A_HPP_INCLUDED
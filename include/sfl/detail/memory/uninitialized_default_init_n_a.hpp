@@ -0,0 +1,82 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_UNINITIALIZED_DEFAULT_INIT_N_A_HPP_INCLUDED
+#define SFL_DETAIL_UNINITIALIZED_DEFAULT_INIT_N_A_HPP_INCLUDED
+
+#include <sfl/detail/memory/uninitialized_default_construct_n.hpp>
+#include <sfl/detail/memory/uninitialized_default_construct_n_a.hpp>
+#include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/type_traits/void_t.hpp>
+
+#include <memory>       // allocator
+#include <type_traits>  // false_type, true_type
+#include <utility>      // declval
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+namespace uninitialized_default_init_n_a_impl
+{
+
+// True if `Allocator` has member function `construct(T*)` and it is not
+// `std::allocator` (its `construct` only does placement new).
+template <typename Allocator, typename T, typename = void>
+struct has_construct : std::false_type {};
+
+template <typename Allocator, typename T>
+struct has_construct
+<
+    Allocator,
+    T,
+    sfl::dtl::void_t<decltype(std::declval<Allocator&>().construct(std::declval<T*>()))>
+> : std::true_type {};
+
+template <typename U, typename T>
+struct has_construct<std::allocator<U>, T, void> : std::false_type {};
+
+} // namespace uninitialized_default_init_n_a_impl
+
+// Default-initializes `n` elements starting at `first`, so elements of
+// trivial types are left uninitialized. If the allocator has its own member
+// function `construct`, elements are constructed through the allocator
+// (which value-initializes them) because they will be destroyed through it.
+template <typename Allocator, typename ForwardIt, typename Size,
+          sfl::dtl::enable_if_t< uninitialized_default_init_n_a_impl::has_construct<Allocator, typename Allocator::value_type>::value >* = nullptr>
+ForwardIt uninitialized_default_init_n_a(Allocator& a, ForwardIt first, Size n)
+{
+    return sfl::dtl::uninitialized_default_construct_n_a(a, first, n);
+}
+
+template <typename Allocator, typename ForwardIt, typename Size,
+          sfl::dtl::enable_if_t< !uninitialized_default_init_n_a_impl::has_construct<Allocator, typename Allocator::value_type>::value >* = nullptr>
+ForwardIt uninitialized_default_init_n_a(Allocator&, ForwardIt first, Size n)
+{
+    return sfl::dtl::uninitialized_default_construct_n(first, n);
+}
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_UNINITIALIZED_DEFAULT_INIT_N_A_HPP_INCLUDED
@@ -0,0 +1,354 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_NODE_HANDLE_HPP_INCLUDED
+#define SFL_DETAIL_NODE_HANDLE_HPP_INCLUDED
+
+#include <sfl/detail/memory/construct_at.hpp>
+#include <sfl/detail/memory/destroy_at.hpp>
+#include <sfl/detail/memory/destroy_at_a.hpp>
+#include <sfl/detail/utility/optional_value.hpp>
+#include <sfl/detail/allocator_traits.hpp>
+#include <sfl/detail/cpp.hpp>
+
+#include <utility>      // move, swap
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// NODE HANDLE ACCESS
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Containers use this class to create node handles and to take nodes from
+// node handles. Constructor of node handle and its node and allocator are
+// not accessible to users.
+struct node_handle_access
+{
+    template <typename NodeHandle, typename NodePointer, typename NodeAllocator>
+    static NodeHandle make(NodePointer p, const NodeAllocator& alloc) noexcept
+    {
+        return NodeHandle(p, alloc);
+    }
+
+    template <typename NodeHandle>
+    static auto node(const NodeHandle& nh) noexcept -> decltype(nh.node_)
+    {
+        return nh.node_;
+    }
+
+    template <typename NodeHandle>
+    static auto allocator(const NodeHandle& nh) noexcept -> decltype(nh.alloc_.ref())
+    {
+        return nh.alloc_.ref();
+    }
+
+    template <typename NodeHandle>
+    static auto release(NodeHandle& nh) noexcept -> decltype(nh.node_)
+    {
+        return nh.release();
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// NODE HANDLE BASE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+// Owns node extracted from node-based container. Node can be inserted into
+// another container that uses equal allocator without reallocation.
+template <typename Allocator, typename Node>
+class node_handle_base
+{
+    friend struct sfl::dtl::node_handle_access;
+
+public:
+
+    using allocator_type = Allocator;
+
+protected:
+
+    using node_allocator_type = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<Node>;
+
+    using node_pointer = typename Node::node_pointer;
+
+    node_pointer node_;
+
+    sfl::dtl::optional_value<node_allocator_type> alloc_;
+
+    node_handle_base() noexcept
+        : node_(nullptr)
+    {}
+
+    node_handle_base(node_pointer p, const node_allocator_type& alloc) noexcept
+        : node_(p)
+    {
+        sfl::dtl::construct_at(alloc_.ptr(), alloc);
+    }
+
+    node_handle_base(node_handle_base&& other) noexcept
+        : node_(other.node_)
+    {
+        if (other.node_ != nullptr)
+        {
+            sfl::dtl::construct_at(alloc_.ptr(), std::move(other.alloc_.ref()));
+            sfl::dtl::destroy_at(other.alloc_.ptr());
+            other.node_ = nullptr;
+        }
+    }
+
+    ~node_handle_base()
+    {
+        reset();
+    }
+
+    node_handle_base& operator=(node_handle_base&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+
+            if (other.node_ != nullptr)
+            {
+                sfl::dtl::construct_at(alloc_.ptr(), std::move(other.alloc_.ref()));
+                sfl::dtl::destroy_at(other.alloc_.ptr());
+                node_ = other.node_;
+                other.node_ = nullptr;
+            }
+        }
+
+        return *this;
+    }
+
+    void swap_base(node_handle_base& other) noexcept
+    {
+        if (node_ != nullptr && other.node_ != nullptr)
+        {
+            using std::swap;
+            swap(alloc_.ref(), other.alloc_.ref());
+        }
+        else if (node_ != nullptr)
+        {
+            sfl::dtl::construct_at(other.alloc_.ptr(), std::move(alloc_.ref()));
+            sfl::dtl::destroy_at(alloc_.ptr());
+        }
+        else if (other.node_ != nullptr)
+        {
+            sfl::dtl::construct_at(alloc_.ptr(), std::move(other.alloc_.ref()));
+            sfl::dtl::destroy_at(other.alloc_.ptr());
+        }
+
+        using std::swap;
+        swap(node_, other.node_);
+    }
+
+public:
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return node_ == nullptr;
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return node_ != nullptr;
+    }
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const
+    {
+        SFL_ASSERT(!empty());
+        return allocator_type(alloc_.ref());
+    }
+
+private:
+
+    node_pointer release() noexcept
+    {
+        SFL_ASSERT(!empty());
+        node_pointer p = node_;
+        sfl::dtl::destroy_at(alloc_.ptr());
+        node_ = nullptr;
+        return p;
+    }
+
+    void reset() noexcept
+    {
+        if (node_ != nullptr)
+        {
+            sfl::dtl::destroy_at_a(alloc_.ref(), node_->value_.ptr());
+            sfl::dtl::destroy_at_a(alloc_.ref(), node_);
+            sfl::dtl::allocator_traits<node_allocator_type>::deallocate(alloc_.ref(), node_, 1);
+            sfl::dtl::destroy_at(alloc_.ptr());
+            node_ = nullptr;
+        }
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// MAP NODE HANDLE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Key, typename T, typename Allocator, typename Node>
+class map_node_handle : public sfl::dtl::node_handle_base<Allocator, Node>
+{
+    friend struct sfl::dtl::node_handle_access;
+
+private:
+
+    using base_type = sfl::dtl::node_handle_base<Allocator, Node>;
+
+public:
+
+    using key_type    = Key;
+    using mapped_type = T;
+
+public:
+
+    map_node_handle() noexcept
+    {}
+
+    map_node_handle(map_node_handle&& other) noexcept
+        : base_type(std::move(other))
+    {}
+
+    map_node_handle& operator=(map_node_handle&& other) noexcept
+    {
+        base_type::operator=(std::move(other));
+        return *this;
+    }
+
+    SFL_NODISCARD
+    key_type& key() const noexcept
+    {
+        SFL_ASSERT(!this->empty());
+        return const_cast<key_type&>(this->node_->value_.ref().first);
+    }
+
+    SFL_NODISCARD
+    mapped_type& mapped() const noexcept
+    {
+        SFL_ASSERT(!this->empty());
+        return this->node_->value_.ref().second;
+    }
+
+    void swap(map_node_handle& other) noexcept
+    {
+        this->swap_base(other);
+    }
+
+    friend void swap(map_node_handle& x, map_node_handle& y) noexcept
+    {
+        x.swap(y);
+    }
+
+private:
+
+    map_node_handle(typename base_type::node_pointer p, const typename base_type::node_allocator_type& alloc) noexcept
+        : base_type(p, alloc)
+    {}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// SET NODE HANDLE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Value, typename Allocator, typename Node>
+class set_node_handle : public sfl::dtl::node_handle_base<Allocator, Node>
+{
+    friend struct sfl::dtl::node_handle_access;
+
+private:
+
+    using base_type = sfl::dtl::node_handle_base<Allocator, Node>;
+
+public:
+
+    using value_type = Value;
+
+public:
+
+    set_node_handle() noexcept
+    {}
+
+    set_node_handle(set_node_handle&& other) noexcept
+        : base_type(std::move(other))
+    {}
+
+    set_node_handle& operator=(set_node_handle&& other) noexcept
+    {
+        base_type::operator=(std::move(other));
+        return *this;
+    }
+
+    SFL_NODISCARD
+    value_type& value() const noexcept
+    {
+        SFL_ASSERT(!this->empty());
+        return this->node_->value_.ref();
+    }
+
+    void swap(set_node_handle& other) noexcept
+    {
+        this->swap_base(other);
+    }
+
+    friend void swap(set_node_handle& x, set_node_handle& y) noexcept
+    {
+        x.swap(y);
+    }
+
+private:
+
+    set_node_handle(typename base_type::node_pointer p, const typename base_type::node_allocator_type& alloc) noexcept
+        : base_type(p, alloc)
+    {}
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+// INSERT RETURN TYPE
+///////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////
+
+template <typename Iterator, typename NodeType>
+struct node_insert_return_type
+{
+    Iterator position;
+    bool     inserted;
+    NodeType node;
+};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_NODE_HANDLE_HPP_INCLUDED
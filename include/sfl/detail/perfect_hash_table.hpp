@@ -0,0 +1,374 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_PERFECT_HASH_TABLE_HPP_INCLUDED
+#define SFL_DETAIL_PERFECT_HASH_TABLE_HPP_INCLUDED
+
+#include <sfl/detail/utility/index_sequence.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+
+#include <cstddef>      // size_t
+#include <cstdint>      // uint8_t, uint16_t, uint32_t, uint64_t
+#include <type_traits>  // conditional, enable_if, is_enum, is_integral
+
+#if SFL_CPP_VERSION >= SFL_CPP_17
+#include <string_view>  // basic_string_view
+#endif
+
+#if SFL_CPP_VERSION >= SFL_CPP_14
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+// Finalizer of SplitMix64. Every bit of the result depends on every bit
+// of the argument.
+constexpr std::uint64_t mix64(std::uint64_t x) noexcept
+{
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    x ^= x >> 31;
+    return x;
+}
+
+} // namespace dtl
+
+//
+// Hash function used by static perfect hash containers. It must be usable
+// in constant expressions and it returns 64-bit hash value.
+//
+// Specializations are provided for integral types, enumerations and
+// `std::basic_string_view` (C++17). Users can specialize this template
+// or provide their own hash function.
+//
+template <typename Key, typename Enable = void>
+struct static_perfect_hash;
+
+template <typename Key>
+struct static_perfect_hash
+<
+    Key,
+    typename std::enable_if<std::is_integral<Key>::value || std::is_enum<Key>::value>::type
+>
+{
+    SFL_NODISCARD
+    constexpr std::uint64_t operator()(const Key& key) const noexcept
+    {
+        return sfl::dtl::mix64(std::uint64_t(key));
+    }
+};
+
+#if SFL_CPP_VERSION >= SFL_CPP_17
+
+template <typename CharT, typename Traits>
+struct static_perfect_hash<std::basic_string_view<CharT, Traits>>
+{
+    SFL_NODISCARD
+    constexpr std::uint64_t operator()(std::basic_string_view<CharT, Traits> key) const noexcept
+    {
+        // FNV-1a
+        std::uint64_t h = 0xcbf29ce484222325ULL;
+
+        for (const CharT c : key)
+        {
+            h ^= std::uint64_t(c);
+            h *= 0x100000001b3ULL;
+        }
+
+        return sfl::dtl::mix64(h ^ key.size());
+    }
+};
+
+#endif // C++17
+
+namespace dtl
+{
+
+//
+// Perfect hash table for set of keys known at compile time. The table is
+// built by constexpr constructor using hash-and-displace method:
+//
+//  1. Keys are distributed into buckets by hash value. There are about
+//     two keys per bucket.
+//
+//  2. Buckets are processed from largest to smallest. For each bucket we
+//     search for the smallest displacement value (pilot) such that all
+//     keys of the bucket land into distinct free slots. Slot of key is
+//     `(hash ^ mix(pilot)) % num_slots`.
+//
+// Lookup needs one hash, one read of pilot, one read of slot and one key
+// comparison. Values are stored in the given order and slots store
+// indexes of values.
+//
+template < typename Key,
+           typename Value,
+           typename KeyOfValue,
+           std::size_t N,
+           typename Hash,
+           typename KeyEqual >
+class perfect_hash_table
+{
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using key_type        = Key;
+    using value_type      = Value;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = KeyEqual;
+    using const_iterator  = const value_type*;
+
+private:
+
+    // Index of value in slot. Value `N` means empty slot.
+    using index_type = typename std::conditional
+    <
+        (N < 0xffU),
+        std::uint8_t,
+        typename std::conditional<(N < 0xffffU), std::uint16_t, std::uint32_t>::type
+    >::type;
+
+    using pilot_type = std::uint16_t;
+
+    static constexpr size_type num_buckets = N / 2 + 1;
+
+    static constexpr size_type num_slots = N + N / 4 + 1;
+
+    static constexpr size_type max_pilot = 0xffff;
+
+    value_type values_[N];
+
+    index_type slots_[num_slots];
+
+    pilot_type pilots_[num_buckets];
+
+    hasher hash_;
+
+    key_equal equal_;
+
+public:
+
+    constexpr perfect_hash_table(const value_type (&values)[N], const Hash& hash, const KeyEqual& equal)
+        : perfect_hash_table(values, hash, equal, sfl::dtl::make_index_sequence<N>())
+    {
+        build();
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator begin() const noexcept
+    {
+        return values_;
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator end() const noexcept
+    {
+        return values_ + N;
+    }
+
+    SFL_NODISCARD
+    constexpr hasher hash_function() const
+    {
+        return hash_;
+    }
+
+    SFL_NODISCARD
+    constexpr key_equal key_eq() const
+    {
+        return equal_;
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator find(const Key& key) const
+    {
+        const std::uint64_t h = hash_(key);
+
+        const index_type i = slots_[slot_of(h, pilots_[bucket_of(h)])];
+
+        if (i != N && equal_(key_of(i), key))
+        {
+            return values_ + i;
+        }
+
+        return end();
+    }
+
+private:
+
+    template <std::size_t... Ints>
+    constexpr perfect_hash_table(const value_type (&values)[N], const Hash& hash, const KeyEqual& equal, sfl::dtl::index_sequence<Ints...>)
+        : values_{values[Ints]...}
+        , slots_{}
+        , pilots_{}
+        , hash_(hash)
+        , equal_(equal)
+    {}
+
+    constexpr const Key& key_of(size_type i) const noexcept
+    {
+        return KeyOfValue()(values_[i]);
+    }
+
+    static constexpr size_type bucket_of(std::uint64_t h) noexcept
+    {
+        return size_type((h >> 32) % num_buckets);
+    }
+
+    static constexpr size_type slot_of(std::uint64_t h, pilot_type pilot) noexcept
+    {
+        return size_type((h ^ sfl::dtl::mix64(pilot)) % num_slots);
+    }
+
+    constexpr void build()
+    {
+        std::uint64_t hashes[N] = {};
+
+        // Number of keys in each bucket. After prefix sum, start of bucket
+        // in array `order`.
+        size_type bucket_size[num_buckets] = {};
+        size_type bucket_start[num_buckets + 1] = {};
+
+        // Indexes of values grouped by bucket.
+        size_type order[N] = {};
+
+        size_type max_bucket_size = 0;
+
+        for (size_type i = 0; i < N; ++i)
+        {
+            hashes[i] = hash_(key_of(i));
+
+            const size_type b = bucket_of(hashes[i]);
+
+            ++bucket_size[b];
+
+            if (bucket_size[b] > max_bucket_size)
+            {
+                max_bucket_size = bucket_size[b];
+            }
+        }
+
+        for (size_type b = 0; b < num_buckets; ++b)
+        {
+            bucket_start[b + 1] = bucket_start[b] + bucket_size[b];
+        }
+
+        {
+            size_type fill[num_buckets] = {};
+
+            for (size_type i = 0; i < N; ++i)
+            {
+                const size_type b = bucket_of(hashes[i]);
+                order[bucket_start[b] + fill[b]] = i;
+                ++fill[b];
+            }
+        }
+
+        for (size_type s = 0; s < num_slots; ++s)
+        {
+            slots_[s] = index_type(N);
+        }
+
+        // Place buckets from largest to smallest.
+        for (size_type size = max_bucket_size; size > 0; --size)
+        {
+            for (size_type b = 0; b < num_buckets; ++b)
+            {
+                if (bucket_size[b] == size)
+                {
+                    place_bucket(b, hashes, order + bucket_start[b], size);
+                }
+            }
+        }
+    }
+
+    constexpr void place_bucket(size_type b, const std::uint64_t* hashes, const size_type* keys, size_type size)
+    {
+        // Keys with the same hash value can never be separated.
+        for (size_type k1 = 0; k1 < size; ++k1)
+        {
+            for (size_type k2 = 0; k2 < k1; ++k2)
+            {
+                if (hashes[keys[k1]] == hashes[keys[k2]])
+                {
+                    if (equal_(key_of(keys[k1]), key_of(keys[k2])))
+                    {
+                        sfl::dtl::throw_invalid_argument("sfl::dtl::perfect_hash_table: duplicate key");
+                    }
+                    else
+                    {
+                        sfl::dtl::throw_invalid_argument("sfl::dtl::perfect_hash_table: keys with same hash value");
+                    }
+                }
+            }
+        }
+
+        for (size_type pilot = 0; pilot <= max_pilot; ++pilot)
+        {
+            bool ok = true;
+
+            for (size_type k1 = 0; k1 < size && ok; ++k1)
+            {
+                const size_type s1 = slot_of(hashes[keys[k1]], pilot_type(pilot));
+
+                if (slots_[s1] != N)
+                {
+                    ok = false;
+                }
+
+                for (size_type k2 = 0; k2 < k1 && ok; ++k2)
+                {
+                    if (s1 == slot_of(hashes[keys[k2]], pilot_type(pilot)))
+                    {
+                        ok = false;
+                    }
+                }
+            }
+
+            if (ok)
+            {
+                for (size_type k = 0; k < size; ++k)
+                {
+                    slots_[slot_of(hashes[keys[k]], pilot_type(pilot))] = index_type(keys[k]);
+                }
+
+                pilots_[b] = pilot_type(pilot);
+
+                return;
+            }
+        }
+
+        sfl::dtl::throw_invalid_argument("sfl::dtl::perfect_hash_table: pilot not found");
+    }
+};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // C++14
+
+#endif // SFL_DETAIL_PERFECT_HASH_TABLE_HPP_INCLUDED
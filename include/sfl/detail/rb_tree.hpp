@@ -21,6 +21,7 @@
 #ifndef SFL_DETAIL_RB_TREE_HPP_INCLUDED
 #define SFL_DETAIL_RB_TREE_HPP_INCLUDED
 
+#include <sfl/detail/bit/bit_width.hpp>
 #include <sfl/detail/memory/construct_at_a.hpp>
 #include <sfl/detail/memory/destroy_at_a.hpp>
 #include <sfl/detail/memory/to_address.hpp>
@@ -30,9 +31,11 @@
 #include <sfl/detail/utility/optional_value.hpp>
 #include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
+#include <sfl/detail/node_handle.hpp>
 
 #include <algorithm>    // equal, lexicographical_compare
 #include <cstddef>      // size_t, ptrdiff_t
+#include <cstdint>      // uintptr_t
 #include <iterator>     // iterator_traits, xxxxx_iterator_tag, reverse_iterator
 #include <memory>       // pointer_traits
 #include <tuple>        // forward_as_tuple
@@ -58,12 +61,53 @@ namespace dtl
 
 enum class rb_tree_node_color
 {
-    red,
-    black
+    red   = 0,
+    black = 1
 };
 
-template <typename VoidPointer>
-struct rb_tree_node_base
+//
+// Number of nodes in the subtree rooted at the node. It is stored only in
+// trees with order statistic.
+//
+template <bool OrderStatistic>
+struct rb_tree_node_count
+{
+    std::size_t count() const noexcept
+    {
+        return 0;
+    }
+
+    void set_count(std::size_t) noexcept
+    {
+    }
+};
+
+template <>
+struct rb_tree_node_count<true>
+{
+    std::size_t count_;
+
+    std::size_t count() const noexcept
+    {
+        return count_;
+    }
+
+    void set_count(std::size_t n) noexcept
+    {
+        count_ = n;
+    }
+};
+
+template <typename VoidPointer,
+          bool OrderStatistic = false,
+          bool Compact = std::is_pointer<VoidPointer>::value>
+struct rb_tree_node_base;
+
+//
+// Node layout used with fancy pointers. Color is stored in a separate member.
+//
+template <typename VoidPointer, bool OrderStatistic>
+struct rb_tree_node_base<VoidPointer, OrderStatistic, false> : rb_tree_node_count<OrderStatistic>
 {
     using base_node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<rb_tree_node_base>;
 
@@ -74,10 +118,78 @@ struct rb_tree_node_base
     base_node_pointer left_;
 
     base_node_pointer right_;
+
+    base_node_pointer parent() const noexcept
+    {
+        return parent_;
+    }
+
+    void set_parent(base_node_pointer p) noexcept
+    {
+        parent_ = p;
+    }
+
+    rb_tree_node_color color() const noexcept
+    {
+        return color_;
+    }
+
+    void set_color(rb_tree_node_color c) noexcept
+    {
+        color_ = c;
+    }
+
+    void set_parent_and_color(base_node_pointer p, rb_tree_node_color c) noexcept
+    {
+        parent_ = p;
+        color_  = c;
+    }
 };
 
-template <typename Value, typename Allocator, typename VoidPointer>
-struct rb_tree_node : rb_tree_node_base<VoidPointer>
+//
+// Compact node layout used with raw pointers. Color is stored in the lowest
+// bit of the parent pointer, which is always zero because nodes are aligned
+// at least to pointer size.
+//
+template <typename VoidPointer, bool OrderStatistic>
+struct rb_tree_node_base<VoidPointer, OrderStatistic, true> : rb_tree_node_count<OrderStatistic>
+{
+    using base_node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<rb_tree_node_base>;
+
+    std::uintptr_t parent_and_color_;
+
+    base_node_pointer left_;
+
+    base_node_pointer right_;
+
+    base_node_pointer parent() const noexcept
+    {
+        return reinterpret_cast<base_node_pointer>(parent_and_color_ & ~std::uintptr_t(1));
+    }
+
+    void set_parent(base_node_pointer p) noexcept
+    {
+        parent_and_color_ = reinterpret_cast<std::uintptr_t>(p) | (parent_and_color_ & std::uintptr_t(1));
+    }
+
+    rb_tree_node_color color() const noexcept
+    {
+        return static_cast<rb_tree_node_color>(parent_and_color_ & std::uintptr_t(1));
+    }
+
+    void set_color(rb_tree_node_color c) noexcept
+    {
+        parent_and_color_ = (parent_and_color_ & ~std::uintptr_t(1)) | static_cast<std::uintptr_t>(c);
+    }
+
+    void set_parent_and_color(base_node_pointer p, rb_tree_node_color c) noexcept
+    {
+        parent_and_color_ = reinterpret_cast<std::uintptr_t>(p) | static_cast<std::uintptr_t>(c);
+    }
+};
+
+template <typename Value, typename Allocator, typename VoidPointer, bool OrderStatistic = false>
+struct rb_tree_node : rb_tree_node_base<VoidPointer, OrderStatistic>
 {
     static_assert
     (
@@ -85,7 +197,7 @@ struct rb_tree_node : rb_tree_node_base<VoidPointer>
         "Allocator::value_type must be Value."
     );
 
-    using typename rb_tree_node_base<VoidPointer>::base_node_pointer;
+    using typename rb_tree_node_base<VoidPointer, OrderStatistic>::base_node_pointer;
 
     using node_pointer = typename std::pointer_traits<VoidPointer>::template rebind<rb_tree_node>;
 
@@ -102,7 +214,8 @@ template < typename Key,
            typename Value,
            typename KeyOfValue,
            typename KeyCompare,
-           typename Allocator >
+           typename Allocator,
+           bool OrderStatistic = false >
 class rb_tree
 {
     static_assert
@@ -116,6 +229,9 @@ class rb_tree
     friend void ::test_rb_tree();
     #endif
 
+    template <typename, typename, typename, typename, typename, bool>
+    friend class rb_tree;
+
 public:
 
     using allocator_type  = Allocator;
@@ -133,9 +249,9 @@ private:
 
     using void_pointer = typename sfl::dtl::allocator_traits<allocator_type>::void_pointer;
 
-    using base_node_type = rb_tree_node_base<void_pointer>;
+    using base_node_type = rb_tree_node_base<void_pointer, OrderStatistic>;
 
-    using node_type = rb_tree_node<value_type, allocator_type, void_pointer>;
+    using node_type = rb_tree_node<value_type, allocator_type, void_pointer, OrderStatistic>;
 
     using node_allocator_type = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<node_type>;
 
@@ -145,6 +261,9 @@ private:
 
 public:
 
+    // Type of node owned by node handles.
+    using node_handle_node_type = node_type;
+
     class iterator
     {
         #ifdef SFL_TEST_RB_TREE
@@ -358,6 +477,10 @@ private:
 
         base_node_type header_;
 
+        // Kept outside of the header because the parent pointer of a
+        // compact node cannot be accessed by reference.
+        base_node_pointer minimum_;
+
     public:
 
         size_type size_;
@@ -374,18 +497,33 @@ private:
 
         base_node_pointer& minimum() noexcept
         {
-            return header_.parent_;
+            return minimum_;
         }
 
         void reset() noexcept
         {
-            header_.color_  = rb_tree_node_color::red;
-            header_.parent_ = std::pointer_traits<base_node_pointer>::pointer_to(header_); // minimum
-            header_.left_   = nullptr;  // root
-            header_.right_  = nullptr;  // unused
+            header_.set_parent_and_color(header(), rb_tree_node_color::red); // parent is unused
+            header_.left_  = nullptr;   // root
+            header_.right_ = nullptr;   // unused
+            header_.set_count(0);       // unused
+            minimum_ = header();
             size_ = 0;
         }
 
+        // Parent of the root and empty tree's minimum point to the header.
+        // Restores that after nodes are taken over from another tree.
+        void relink_header() noexcept
+        {
+            if (header_.left_ != nullptr)
+            {
+                header_.left_->set_parent(header());
+            }
+            else
+            {
+                minimum_ = header();
+            }
+        }
+
     public:
 
         data()
@@ -576,6 +714,41 @@ public:
         }
     }
 
+    // Inserts elements from range. If tree is empty, leading run of elements
+    // with strictly increasing keys is linked into balanced tree in linear
+    // time, and the rest of the range is inserted one-by-one.
+    template <typename InputIt, typename Sentinel>
+    void insert_range_unique(InputIt first, Sentinel last)
+    {
+        if (empty())
+        {
+            build_from_sorted_run(first, last, std::true_type());
+        }
+
+        while (first != last)
+        {
+            insert_unique(*first);
+            ++first;
+        }
+    }
+
+    // Inserts elements from range that is sorted and contains no elements
+    // with equivalent keys. If tree is empty, it is built in linear time.
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_unique(InputIt first, Sentinel last)
+    {
+        if (empty())
+        {
+            build_from_sorted_run(first, last, std::false_type());
+        }
+
+        while (first != last)
+        {
+            insert_hint_unique(cend(), *first);
+            ++first;
+        }
+    }
+
     //
     // ---- KEY COMPARE -------------------------------------------------------
     //
@@ -1000,6 +1173,293 @@ public:
         swap_impl(other);
     }
 
+    template <typename NodeHandle>
+    NodeHandle extract(const_iterator pos)
+    {
+        base_node_pointer x = pos.node_;
+        --data_.size_;
+        remove(x, data_.root(), data_.minimum());
+        return sfl::dtl::node_handle_access::make<NodeHandle>(static_cast<node_pointer>(x), data_.ref_to_node_alloc());
+    }
+
+    template <typename NodeHandle, typename K>
+    NodeHandle extract_key(const K& k)
+    {
+        auto it = lower_bound(k);
+
+        if (it != end() && !data_.ref_to_key_compare()(k, key_of(it.node_)))
+        {
+            return extract<NodeHandle>(it);
+        }
+        else
+        {
+            return NodeHandle();
+        }
+    }
+
+    template <typename NodeHandle>
+    iterator insert_node_handle_equal(NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = calculate_position_for_insert_equal(key_of(sfl::dtl::node_handle_access::node(nh)));
+        node_pointer x = sfl::dtl::node_handle_access::release(nh);
+        insert(x, res.pos, res.left, data_.root(), data_.minimum());
+        ++data_.size_;
+        return iterator(x);
+    }
+
+    template <typename InsertReturnType, typename NodeHandle>
+    InsertReturnType insert_node_handle_unique(NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return InsertReturnType{end(), false, NodeHandle()};
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = calculate_position_for_insert_unique(key_of(sfl::dtl::node_handle_access::node(nh)));
+        if (res.status)
+        {
+            node_pointer x = sfl::dtl::node_handle_access::release(nh);
+            insert(x, res.pos, res.left, data_.root(), data_.minimum());
+            ++data_.size_;
+            return InsertReturnType{iterator(x), true, NodeHandle()};
+        }
+        else
+        {
+            return InsertReturnType{iterator(res.pos), false, std::move(nh)};
+        }
+    }
+
+    template <typename NodeHandle>
+    iterator insert_node_handle_hint_equal(const_iterator hint, NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = calculate_position_for_insert_hint_equal(hint, key_of(sfl::dtl::node_handle_access::node(nh)));
+        node_pointer x = sfl::dtl::node_handle_access::release(nh);
+        insert(x, res.pos, res.left, data_.root(), data_.minimum());
+        ++data_.size_;
+        return iterator(x);
+    }
+
+    template <typename NodeHandle>
+    iterator insert_node_handle_hint_unique(const_iterator hint, NodeHandle&& nh)
+    {
+        if (nh.empty())
+        {
+            return end();
+        }
+
+        SFL_ASSERT(sfl::dtl::node_handle_access::allocator(nh) == data_.ref_to_node_alloc());
+
+        auto res = calculate_position_for_insert_hint_unique(hint, key_of(sfl::dtl::node_handle_access::node(nh)));
+        if (res.status)
+        {
+            node_pointer x = sfl::dtl::node_handle_access::release(nh);
+            insert(x, res.pos, res.left, data_.root(), data_.minimum());
+            ++data_.size_;
+            return iterator(x);
+        }
+        else
+        {
+            return iterator(res.pos);
+        }
+    }
+
+    // Moves all nodes from `other` to this tree. Nodes are relinked, not
+    // reallocated. Allocators must compare equal.
+    template <typename KeyCompare2>
+    void merge_equal(rb_tree<Key, Value, KeyOfValue, KeyCompare2, Allocator, OrderStatistic>& other)
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        SFL_ASSERT(data_.ref_to_node_alloc() == other.data_.ref_to_node_alloc());
+
+        base_node_pointer x = other.data_.minimum();
+
+        while (x != other.data_.header())
+        {
+            base_node_pointer y = next(x);
+            auto res = calculate_position_for_insert_equal(key_of(x));
+            --other.data_.size_;
+            remove(x, other.data_.root(), other.data_.minimum());
+            insert(x, res.pos, res.left, data_.root(), data_.minimum());
+            ++data_.size_;
+            x = y;
+        }
+    }
+
+    // Moves nodes from `other` to this tree if this tree does not contain
+    // element with equivalent key. Nodes are relinked, not reallocated.
+    // Allocators must compare equal.
+    template <typename KeyCompare2>
+    void merge_unique(rb_tree<Key, Value, KeyOfValue, KeyCompare2, Allocator, OrderStatistic>& other)
+    {
+        if (static_cast<const void*>(this) == static_cast<const void*>(&other))
+        {
+            return;
+        }
+
+        SFL_ASSERT(data_.ref_to_node_alloc() == other.data_.ref_to_node_alloc());
+
+        base_node_pointer x = other.data_.minimum();
+
+        while (x != other.data_.header())
+        {
+            base_node_pointer y = next(x);
+            auto res = calculate_position_for_insert_unique(key_of(x));
+            if (res.status)
+            {
+                --other.data_.size_;
+                remove(x, other.data_.root(), other.data_.minimum());
+                insert(x, res.pos, res.left, data_.root(), data_.minimum());
+                ++data_.size_;
+            }
+            x = y;
+        }
+    }
+
+    // Inserts copies of elements from `other` whose keys are not present in
+    // this tree. Both trees are walked in order and each new node is linked
+    // using the next greater element as hint, which takes amortized constant
+    // time. If `other` is much smaller, its elements are looked up instead.
+    // Returns the number of inserted elements.
+    size_type union_unique(const rb_tree& other)
+    {
+        if (this == &other)
+        {
+            return 0;
+        }
+
+        const size_type old_size = size();
+
+        if (empty())
+        {
+            insert_range_sorted_unique(other.begin(), other.end());
+        }
+        else if (prefer_lookup(other.size()))
+        {
+            for (auto it = other.begin(); it != other.end(); ++it)
+            {
+                insert_unique(*it);
+            }
+        }
+        else
+        {
+            const_iterator pos = cbegin();
+
+            for (auto it = other.begin(); it != other.end(); ++it)
+            {
+                while (pos != cend() && data_.ref_to_key_compare()(key_of(pos.node_), key_of(it.node_)))
+                {
+                    ++pos;
+                }
+
+                if (pos == cend() || data_.ref_to_key_compare()(key_of(it.node_), key_of(pos.node_)))
+                {
+                    insert_hint_unique(pos, *it);
+                }
+            }
+        }
+
+        return size() - old_size;
+    }
+
+    // Erases elements whose keys are not present in `other`. Returns the
+    // number of erased elements.
+    size_type intersection_unique(const rb_tree& other)
+    {
+        if (this == &other)
+        {
+            return 0;
+        }
+
+        const size_type old_size = size();
+
+        const_iterator it = cbegin();
+        const_iterator jt = other.cbegin();
+
+        while (it != cend() && jt != other.cend())
+        {
+            if (data_.ref_to_key_compare()(key_of(it.node_), key_of(jt.node_)))
+            {
+                it = erase(it);
+            }
+            else if (data_.ref_to_key_compare()(key_of(jt.node_), key_of(it.node_)))
+            {
+                ++jt;
+            }
+            else
+            {
+                ++it;
+                ++jt;
+            }
+        }
+
+        erase(it, cend());
+
+        return old_size - size();
+    }
+
+    // Erases elements whose keys are present in `other`. Returns the number
+    // of erased elements.
+    size_type difference_unique(const rb_tree& other)
+    {
+        const size_type old_size = size();
+
+        if (this == &other)
+        {
+            clear();
+        }
+        else if (prefer_lookup(other.size()))
+        {
+            for (auto jt = other.begin(); jt != other.end(); ++jt)
+            {
+                erase_key_unique(key_of(jt.node_));
+            }
+        }
+        else
+        {
+            const_iterator it = cbegin();
+            const_iterator jt = other.cbegin();
+
+            while (it != cend() && jt != other.cend())
+            {
+                if (data_.ref_to_key_compare()(key_of(it.node_), key_of(jt.node_)))
+                {
+                    ++it;
+                }
+                else if (data_.ref_to_key_compare()(key_of(jt.node_), key_of(it.node_)))
+                {
+                    ++jt;
+                }
+                else
+                {
+                    it = erase(it);
+                    ++jt;
+                }
+            }
+        }
+
+        return old_size - size();
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -1264,8 +1724,242 @@ public:
         return find(k) != end();
     }
 
+    //
+    // ---- ORDER STATISTIC ---------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator nth(size_type n) noexcept
+    {
+        return iterator(find_by_order(n));
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type n) const noexcept
+    {
+        return const_iterator(find_by_order(n));
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        static_assert(OrderStatistic, "Tree does not maintain subtree sizes.");
+
+        base_node_pointer x = pos.node_;
+
+        if (x == data_.header())
+        {
+            return data_.size_;
+        }
+
+        size_type index = subtree_count(x->left_);
+
+        while (x != data_.root())
+        {
+            base_node_pointer p = x->parent();
+
+            if (x == p->right_)
+            {
+                index += subtree_count(p->left_) + 1;
+            }
+
+            x = p;
+        }
+
+        return index;
+    }
+
+    // Returns the number of elements with keys less than `k`.
+    template <typename K>
+    SFL_NODISCARD
+    size_type order_of_key(const K& k) const
+    {
+        static_assert(OrderStatistic, "Tree does not maintain subtree sizes.");
+
+        base_node_pointer x = data_.root();
+        size_type index = 0;
+
+        while (x != nullptr)
+        {
+            if (data_.ref_to_key_compare()(key_of(x), k))
+            {
+                index += subtree_count(x->left_) + 1;
+                x = x->right_;
+            }
+            else
+            {
+                x = x->left_;
+            }
+        }
+
+        return index;
+    }
+
 private:
 
+    base_node_pointer find_by_order(size_type n) const noexcept
+    {
+        static_assert(OrderStatistic, "Tree does not maintain subtree sizes.");
+
+        SFL_ASSERT(n <= data_.size_);
+
+        base_node_pointer x = data_.root();
+
+        while (x != nullptr)
+        {
+            const size_type left_count = subtree_count(x->left_);
+
+            if (n < left_count)
+            {
+                x = x->left_;
+            }
+            else if (n == left_count)
+            {
+                return x;
+            }
+            else
+            {
+                n -= left_count + 1;
+                x = x->right_;
+            }
+        }
+
+        return data_.header();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Returns true if `m` lookups, each taking O(log size()), are cheaper
+    // than walking through this tree and `m` other elements.
+    bool prefer_lookup(size_type m) const noexcept
+    {
+        const std::size_t n = data_.size_;
+        return m * std::size_t(sfl::dtl::bit_width(n)) < n;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    // Creates nodes for elements from range while their keys are strictly
+    // increasing (or for all elements if `CheckOrder` is false) and links
+    // them into balanced tree. Nodes are allocated in key order. Tree must
+    // be empty. On return, `first` points to the first element that was
+    // not used.
+    template <typename InputIt, typename Sentinel, bool CheckOrder>
+    void build_from_sorted_run(InputIt& first, Sentinel last, std::integral_constant<bool, CheckOrder>)
+    {
+        SFL_ASSERT(empty());
+
+        make_node_functor make_node(*this);
+
+        // Nodes are chained through `right_` pointers.
+        base_node_pointer head = nullptr;
+        base_node_pointer tail = nullptr;
+        size_type n = 0;
+
+        SFL_TRY
+        {
+            while (first != last)
+            {
+                if (CheckOrder && tail != nullptr && !data_.ref_to_key_compare()(key_of(tail), KeyOfValue()(*first)))
+                {
+                    break;
+                }
+
+                base_node_pointer x = make_node(*first);
+
+                x->right_ = nullptr;
+
+                if (tail == nullptr)
+                {
+                    head = x;
+                }
+                else
+                {
+                    tail->right_ = x;
+                }
+
+                tail = x;
+                ++n;
+                ++first;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            link_sorted_chain(head, n);
+            SFL_RETHROW;
+        }
+
+        link_sorted_chain(head, n);
+    }
+
+    // Links chain of `n` nodes sorted by key into balanced red-black tree.
+    // Nodes on the lowest level are red if that level is not full, all other
+    // nodes are black.
+    void link_sorted_chain(base_node_pointer head, size_type n) noexcept
+    {
+        if (n == 0)
+        {
+            return;
+        }
+
+        size_type red_depth = 0;
+
+        while ((size_type(2) << red_depth) - 1 <= n)
+        {
+            ++red_depth;
+        }
+
+        base_node_pointer minimum = head;
+
+        data_.root() = link_sorted_chain(head, n, 0, red_depth);
+        data_.minimum() = minimum;
+        data_.size_ = n;
+        data_.relink_header();
+    }
+
+    static base_node_pointer link_sorted_chain(base_node_pointer& head,
+                                               size_type n,
+                                               size_type depth,
+                                               size_type red_depth) noexcept
+    {
+        if (n == 0)
+        {
+            return nullptr;
+        }
+
+        const size_type n_left = (n - 1) / 2;
+
+        base_node_pointer left = link_sorted_chain(head, n_left, depth + 1, red_depth);
+
+        base_node_pointer x = head;
+
+        head = head->right_;
+
+        base_node_pointer right = link_sorted_chain(head, n - 1 - n_left, depth + 1, red_depth);
+
+        x->set_parent_and_color
+        (
+            nullptr,
+            depth == red_depth ? rb_tree_node_color::red : rb_tree_node_color::black
+        );
+
+        x->left_  = left;
+        x->right_ = right;
+        x->set_count(n);
+
+        if (left != nullptr)
+        {
+            left->set_parent(x);
+        }
+
+        if (right != nullptr)
+        {
+            right->set_parent(x);
+        }
+
+        return x;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
 
     static base_node_pointer minimum(base_node_pointer x) noexcept
@@ -1302,12 +1996,12 @@ private:
         }
         else
         {
-            base_node_pointer y = x->parent_;
+            base_node_pointer y = x->parent();
 
             while (x == y->right_)
             {
                 x = y;
-                y = y->parent_;
+                y = y->parent();
             }
 
             return y;
@@ -1324,18 +2018,51 @@ private:
         }
         else
         {
-            base_node_pointer y = x->parent_;
+            base_node_pointer y = x->parent();
 
             while (x == y->left_)
             {
                 x = y;
-                y = y->parent_;
+                y = y->parent();
             }
 
             return y;
         }
     }
 
+    static size_type subtree_count(base_node_pointer x) noexcept
+    {
+        return x == nullptr ? 0 : x->count();
+    }
+
+    // Adds one to the subtree sizes of `x` and its ancestors, up to (but
+    // not including) `header`.
+    static void increment_counts(base_node_pointer x, base_node_pointer header) noexcept
+    {
+        if (OrderStatistic)
+        {
+            while (x != header)
+            {
+                x->set_count(x->count() + 1);
+                x = x->parent();
+            }
+        }
+    }
+
+    // Subtracts one from the subtree sizes of `x` and its ancestors, up to
+    // (but not including) `header`.
+    static void decrement_counts(base_node_pointer x, base_node_pointer header) noexcept
+    {
+        if (OrderStatistic)
+        {
+            while (x != header)
+            {
+                x->set_count(x->count() - 1);
+                x = x->parent();
+            }
+        }
+    }
+
     static void rotate_left(base_node_pointer x) noexcept
     {
         /*
@@ -1356,23 +2083,26 @@ private:
 
         if (y->left_ != nullptr)
         {
-            y->left_->parent_ = x;
+            y->left_->set_parent(x);
         }
 
-        y->parent_ = x->parent_;
+        y->set_parent(x->parent());
 
-        if (x == x->parent_->left_)
+        if (x == x->parent()->left_)
         {
-            x->parent_->left_ = y;
+            x->parent()->left_ = y;
         }
         else
         {
-            x->parent_->right_ = y;
+            x->parent()->right_ = y;
         }
 
         y->left_ = x;
 
-        x->parent_ = y;
+        x->set_parent(y);
+
+        y->set_count(x->count());
+        x->set_count(subtree_count(x->left_) + subtree_count(x->right_) + 1);
     }
 
     static void rotate_right(base_node_pointer x) noexcept
@@ -1395,23 +2125,26 @@ private:
 
         if (y->right_ != nullptr)
         {
-            y->right_->parent_ = x;
+            y->right_->set_parent(x);
         }
 
-        y->parent_ = x->parent_;
+        y->set_parent(x->parent());
 
-        if (x == x->parent_->right_)
+        if (x == x->parent()->right_)
         {
-            x->parent_->right_ = y;
+            x->parent()->right_ = y;
         }
         else
         {
-            x->parent_->left_ = y;
+            x->parent()->left_ = y;
         }
 
         y->right_ = x;
 
-        x->parent_ = y;
+        x->set_parent(y);
+
+        y->set_count(x->count());
+        x->set_count(subtree_count(x->left_) + subtree_count(x->right_) + 1);
     }
 
     static void insert(base_node_pointer x,
@@ -1424,10 +2157,15 @@ private:
         SFL_ASSERT(parent != nullptr);
         SFL_ASSERT(x != parent);
 
-        x->parent_ = parent;
-        x->left_   = nullptr;
-        x->right_  = nullptr;
-        x->color_  = rb_tree_node_color::red;
+        x->set_parent_and_color(parent, rb_tree_node_color::red);
+        x->left_  = nullptr;
+        x->right_ = nullptr;
+        x->set_count(1);
+
+        if (root != nullptr)
+        {
+            increment_counts(parent, root->parent());
+        }
 
         if (insert_left)
         {
@@ -1448,81 +2186,81 @@ private:
 
     static void insert_fixup(base_node_pointer x, base_node_pointer& root) noexcept
     {
-        while (x != root && x->parent_->color_ == rb_tree_node_color::red)
+        while (x != root && x->parent()->color() == rb_tree_node_color::red)
         {
-            if (x->parent_ == x->parent_->parent_->left_) // is z's parent a left child?
+            if (x->parent() == x->parent()->parent()->left_) // is z's parent a left child?
             {
-                base_node_pointer y = x->parent_->parent_->right_; // y is z's uncle
+                base_node_pointer y = x->parent()->parent()->right_; // y is z's uncle
 
-                if (y != nullptr && y->color_ == rb_tree_node_color::red) // are z's parent and uncle both red?
+                if (y != nullptr && y->color() == rb_tree_node_color::red) // are z's parent and uncle both red?
                 {
                     // Case 1
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    y->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    x = x->parent_->parent_;
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    y->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    x = x->parent()->parent();
                 }
                 else
                 {
-                    if (x == x->parent_->right_)
+                    if (x == x->parent()->right_)
                     {
                         // Case 2
-                        x = x->parent_;
+                        x = x->parent();
                         rotate_left(x);
                     }
 
                     // Case 3
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    rotate_right(x->parent_->parent_);
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    rotate_right(x->parent()->parent());
                 }
             }
             else // same as block above, but with "right" and "left" exchanged
             {
-                base_node_pointer y = x->parent_->parent_->left_;
+                base_node_pointer y = x->parent()->parent()->left_;
 
-                if (y != nullptr && y->color_ == rb_tree_node_color::red)
+                if (y != nullptr && y->color() == rb_tree_node_color::red)
                 {
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    y->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    x = x->parent_->parent_;
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    y->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    x = x->parent()->parent();
                 }
                 else
                 {
-                    if (x == x->parent_->left_)
+                    if (x == x->parent()->left_)
                     {
-                        x = x->parent_;
+                        x = x->parent();
                         rotate_right(x);
                     }
 
-                    x->parent_->color_ = rb_tree_node_color::black;
-                    x->parent_->parent_->color_ = rb_tree_node_color::red;
-                    rotate_left(x->parent_->parent_);
+                    x->parent()->set_color(rb_tree_node_color::black);
+                    x->parent()->parent()->set_color(rb_tree_node_color::red);
+                    rotate_left(x->parent()->parent());
                 }
             }
         }
 
-        root->color_ = rb_tree_node_color::black;
+        root->set_color(rb_tree_node_color::black);
     }
 
     static void transplant(base_node_pointer x, base_node_pointer y)
     {
         SFL_ASSERT(x != nullptr);
-        SFL_ASSERT(x->parent_ != nullptr);
+        SFL_ASSERT(x->parent() != nullptr);
 
-        if (x == x->parent_->left_)
+        if (x == x->parent()->left_)
         {
-            x->parent_->left_ = y;
+            x->parent()->left_ = y;
         }
         else
         {
-            x->parent_->right_ = y;
+            x->parent()->right_ = y;
         }
 
         if (y != nullptr)
         {
-            y->parent_ = x->parent_;
+            y->set_parent(x->parent());
         }
     }
 
@@ -1535,35 +2273,39 @@ private:
             minimum = next(z);
         }
 
+        base_node_pointer header = root->parent();
         base_node_pointer x;
         base_node_pointer x_parent;
         base_node_pointer y = z;
-        rb_tree_node_color y_original_color = y->color_;
+        rb_tree_node_color y_original_color = y->color();
 
         if (z->left_ == nullptr) // if z has at most one child
         {
+            decrement_counts(z->parent(), header);
             x = z->right_; // z->right_ could be null pointer
             transplant(z, z->right_);
-            x_parent = z->parent_;
+            x_parent = z->parent();
         }
         else if (z->right_ == nullptr) // if z has exactly one child
         {
+            decrement_counts(z->parent(), header);
             x = z->left_; // z->left_ is not null pointer
             transplant(z, z->left_);
-            x_parent = z->parent_;
+            x_parent = z->parent();
         }
         else // if z has two children
         {
             y = rb_tree::minimum(z->right_);
-            y_original_color = y->color_;
+            y_original_color = y->color();
+            decrement_counts(y->parent(), header);
             x = y->right_; // y->right_ could be null pointer
 
             if (y != z->right_) // if y is farther down the tree
             {
                 transplant(y, y->right_); // replace y by its right child
-                x_parent = y->parent_;
+                x_parent = y->parent();
                 y->right_ = z->right_; // z's right child becomes y's right child
-                y->right_->parent_ = y;
+                y->right_->set_parent(y);
             }
             else
             {
@@ -1572,8 +2314,9 @@ private:
 
             transplant(z, y); // replace z by its successor y
             y->left_ = z->left_; // give z's left child to y, which had not left child
-            y->left_->parent_ = y;
-            y->color_ = z->color_;
+            y->left_->set_parent(y);
+            y->set_color(z->color());
+            y->set_count(z->count());
         }
 
         if (y_original_color == rb_tree_node_color::black)
@@ -1584,49 +2327,49 @@ private:
 
     static void remove_fixup(base_node_pointer x, base_node_pointer x_parent, base_node_pointer& root)
     {
-        while (x != root && (x == nullptr || x->color_ == rb_tree_node_color::black))
+        while (x != root && (x == nullptr || x->color() == rb_tree_node_color::black))
         {
             if (x == x_parent->left_) // is x a left child?
             {
                 base_node_pointer w = x_parent->right_; // w is x's sibling
 
-                if (w->color_ == rb_tree_node_color::red)
+                if (w->color() == rb_tree_node_color::red)
                 {
                     // Case 1
-                    w->color_ = rb_tree_node_color::black;
-                    x_parent->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::black);
+                    x_parent->set_color(rb_tree_node_color::red);
                     rotate_left(x_parent);
                     w = x_parent->right_;
                 }
 
                 if
                 (
-                    (w->left_  == nullptr || w->left_->color_  == rb_tree_node_color::black) &&
-                    (w->right_ == nullptr || w->right_->color_ == rb_tree_node_color::black)
+                    (w->left_  == nullptr || w->left_->color()  == rb_tree_node_color::black) &&
+                    (w->right_ == nullptr || w->right_->color() == rb_tree_node_color::black)
                 )
                 {
                     // Case 2
-                    w->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::red);
                     x = x_parent;
-                    x_parent = x_parent->parent_;
+                    x_parent = x_parent->parent();
                 }
                 else
                 {
-                    if (w->right_ == nullptr || w->right_->color_ == rb_tree_node_color::black)
+                    if (w->right_ == nullptr || w->right_->color() == rb_tree_node_color::black)
                     {
                         // Case 3
-                        w->left_->color_ = rb_tree_node_color::black;
-                        w->color_ = rb_tree_node_color::red;
+                        w->left_->set_color(rb_tree_node_color::black);
+                        w->set_color(rb_tree_node_color::red);
                         rotate_right(w);
                         w = x_parent->right_;
                     }
 
                     // Case 4
-                    w->color_ = x_parent->color_;
-                    x_parent->color_ = rb_tree_node_color::black;
+                    w->set_color(x_parent->color());
+                    x_parent->set_color(rb_tree_node_color::black);
                     if (w->right_ != nullptr)
                     {
-                        w->right_->color_ = rb_tree_node_color::black;
+                        w->right_->set_color(rb_tree_node_color::black);
                     }
                     rotate_left(x_parent);
                     break;
@@ -1636,39 +2379,39 @@ private:
             {
                 base_node_pointer w = x_parent->left_;
 
-                if (w->color_ == rb_tree_node_color::red)
+                if (w->color() == rb_tree_node_color::red)
                 {
-                    w->color_ = rb_tree_node_color::black;
-                    x_parent->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::black);
+                    x_parent->set_color(rb_tree_node_color::red);
                     rotate_right(x_parent);
                     w = x_parent->left_;
                 }
 
                 if
                 (
-                    (w->right_ == nullptr || w->right_->color_ == rb_tree_node_color::black) &&
-                    (w->left_  == nullptr || w->left_->color_  == rb_tree_node_color::black)
+                    (w->right_ == nullptr || w->right_->color() == rb_tree_node_color::black) &&
+                    (w->left_  == nullptr || w->left_->color()  == rb_tree_node_color::black)
                 )
                 {
-                    w->color_ = rb_tree_node_color::red;
+                    w->set_color(rb_tree_node_color::red);
                     x = x_parent;
-                    x_parent = x_parent->parent_;
+                    x_parent = x_parent->parent();
                 }
                 else
                 {
-                    if (w->left_ == nullptr || w->left_->color_ == rb_tree_node_color::black)
+                    if (w->left_ == nullptr || w->left_->color() == rb_tree_node_color::black)
                     {
-                        w->right_->color_ = rb_tree_node_color::black;
-                        w->color_ = rb_tree_node_color::red;
+                        w->right_->set_color(rb_tree_node_color::black);
+                        w->set_color(rb_tree_node_color::red);
                         rotate_left(w);
                         w = x_parent->left_;
                     }
 
-                    w->color_ = x_parent->color_;
-                    x_parent->color_ = rb_tree_node_color::black;
+                    w->set_color(x_parent->color());
+                    x_parent->set_color(rb_tree_node_color::black);
                     if (w->left_)
                     {
-                        w->left_->color_ = rb_tree_node_color::black;
+                        w->left_->set_color(rb_tree_node_color::black);
                     }
                     rotate_right(x_parent);
                     break;
@@ -1678,7 +2421,7 @@ private:
 
         if (x != nullptr)
         {
-            x->color_ = rb_tree_node_color::black;
+            x->set_color(rb_tree_node_color::black);
         }
     }
 
@@ -1818,11 +2561,11 @@ private:
 
                 if (node != root_)
                 {
-                    node->parent_->left_ = node->right_;
+                    node->parent()->left_ = node->right_;
 
                     if (node->right_ != nullptr)
                     {
-                        node->right_->parent_ = node->parent_;
+                        node->right_->set_parent(node->parent());
                     }
                 }
                 else
@@ -1831,7 +2574,7 @@ private:
 
                     if (node->right_ != nullptr)
                     {
-                        node->right_->parent_ = nullptr;
+                        node->right_->set_parent(nullptr);
                     }
                 }
 
@@ -2112,22 +2855,23 @@ private:
 
         base_node_pointer y = make_node(static_cast<node_pointer>(x)->value_.ref());
 
-        y->color_ = x->color_;
+        y->set_parent_and_color(nullptr, x->color());
         y->left_  = nullptr;
         y->right_ = nullptr;
+        y->set_count(x->count());
 
         SFL_TRY
         {
             if (x->left_ != nullptr)
             {
                 y->left_ = copy(x->left_, make_node);
-                y->left_->parent_ = y;
+                y->left_->set_parent(y);
             }
 
             if (x->right_ != nullptr)
             {
                 y->right_ = copy(x->right_, make_node);
-                y->right_->parent_ = y;
+                y->right_->set_parent(y);
             }
         }
         SFL_CATCH (...)
@@ -2146,22 +2890,23 @@ private:
 
         base_node_pointer y = make_node(std::move(static_cast<node_pointer>(x)->value_.ref()));
 
-        y->color_ = x->color_;
+        y->set_parent_and_color(nullptr, x->color());
         y->left_  = nullptr;
         y->right_ = nullptr;
+        y->set_count(x->count());
 
         SFL_TRY
         {
             if (x->left_ != nullptr)
             {
                 y->left_ = move(x->left_, make_node);
-                y->left_->parent_ = y;
+                y->left_->set_parent(y);
             }
 
             if (x->right_ != nullptr)
             {
                 y->right_ = move(x->right_, make_node);
-                y->right_->parent_ = y;
+                y->right_->set_parent(y);
             }
         }
         SFL_CATCH (...)
@@ -2198,6 +2943,7 @@ private:
         {
             make_node_functor make_node(*this);
             data_.root() = copy(other.data_.root(), make_node);
+            data_.relink_header();
             data_.minimum() = minimum(data_.root());
             data_.size_ = other.data_.size_;
         }
@@ -2220,6 +2966,7 @@ private:
         {
             make_node_functor make_node(*this);
             data_.root() = move(other.data_.root(), make_node);
+            data_.relink_header();
             data_.minimum() = minimum(data_.root());
             data_.size_ = other.data_.size_;
         }
@@ -2240,6 +2987,7 @@ private:
         data_.root() = other.data_.root();
         data_.minimum() = other.data_.minimum();
         data_.size_ = other.data_.size_;
+        data_.relink_header();
         other.data_.reset();
     }
 
@@ -2281,6 +3029,7 @@ private:
             if (other.data_.root() != nullptr)
             {
                 data_.root() = copy(other.data_.root(), make_node);
+                data_.relink_header();
                 data_.minimum() = minimum(data_.root());
                 data_.size_ = other.data_.size_;
             }
@@ -2320,6 +3069,7 @@ private:
         if (other.data_.root() != nullptr)
         {
             data_.root() = move(other.data_.root(), make_node);
+            data_.relink_header();
             data_.minimum() = minimum(data_.root());
             data_.size_ = other.data_.size_;
         }
@@ -2357,6 +3107,7 @@ private:
         data_.root() = other.data_.root();
         data_.minimum() = other.data_.minimum();
         data_.size_ = other.data_.size_;
+        data_.relink_header();
 
         // Set other data (noexcept)
         other.data_.reset();
@@ -2401,11 +3152,11 @@ private:
 
         if (old_this != nullptr)
         {
-            old_this->parent_ = nullptr;
+            old_this->set_parent(nullptr);
         }
         if (old_other != nullptr)
         {
-            old_other->parent_ = nullptr;
+            old_other->set_parent(nullptr);
         }
 
         // Reset data (noexcept)
@@ -2447,7 +3198,7 @@ private:
                     SFL_ASSERT(x->left_ == nullptr);
                     SFL_ASSERT(x->right_ == nullptr);
 
-                    base_node_pointer parent = x->parent_;
+                    base_node_pointer parent = x->parent();
 
                     if (parent != nullptr)
                     {
@@ -2592,7 +3343,7 @@ private:
                     SFL_ASSERT(x->left_ == nullptr);
                     SFL_ASSERT(x->right_ == nullptr);
 
-                    base_node_pointer parent = x->parent_;
+                    base_node_pointer parent = x->parent();
 
                     if (parent != nullptr)
                     {
@@ -2712,6 +3463,9 @@ private:
         swap(data_.root(), other.data_.root());
         swap(data_.minimum(), other.data_.minimum());
         swap(data_.size_, other.data_.size_);
+
+        data_.relink_header();
+        other.data_.relink_header();
     }
 
     void swap_impl(rb_tree& other, std::false_type, std::false_type)
@@ -2739,7 +3493,7 @@ private:
 
         while (true)
         {
-            if (x->color_ == rb_tree_node_color::black)
+            if (x->color() == rb_tree_node_color::black)
             {
                 ++count;
             }
@@ -2749,7 +3503,7 @@ private:
                 break;
             }
 
-            x = x->parent_;
+            x = x->parent();
         }
 
         return count;
@@ -2761,7 +3515,7 @@ private:
         {
             return data_.size_ == 0
                 && begin() == end()
-                && data_.header()->parent_ == data_.header()
+                && data_.minimum() == data_.header()
                 && data_.header()->left_ == nullptr;
         }
 
@@ -2773,12 +3527,12 @@ private:
             node_pointer l = static_cast<node_pointer>(x->left_);
             node_pointer r = static_cast<node_pointer>(x->right_);
 
-            if (x->color_ == rb_tree_node_color::red)
+            if (x->color() == rb_tree_node_color::red)
             {
                 if
                 (
-                    (l != nullptr && l->color_ == rb_tree_node_color::red) ||
-                    (r != nullptr && r->color_ == rb_tree_node_color::red)
+                    (l != nullptr && l->color() == rb_tree_node_color::red) ||
+                    (r != nullptr && r->color() == rb_tree_node_color::red)
                 )
                 {
                     return false;
@@ -2799,6 +3553,16 @@ private:
             {
                 return false;
             }
+
+            if (OrderStatistic && x->count() != subtree_count(l) + subtree_count(r) + 1)
+            {
+                return false;
+            }
+        }
+
+        if (OrderStatistic && data_.root()->count() != data_.size_)
+        {
+            return false;
         }
 
         if (data_.minimum() != minimum(data_.root()))
@@ -2816,67 +3580,67 @@ private:
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, bool TP6>
 SFL_NODISCARD
 bool operator==
 (
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& x,
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& y
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, bool TP6>
 SFL_NODISCARD
 bool operator!=
 (
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& x,
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& y
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return !(x == y);
 }
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, bool TP6>
 SFL_NODISCARD
 bool operator<
 (
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& x,
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& y
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, bool TP6>
 SFL_NODISCARD
 bool operator>
 (
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& x,
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& y
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return y < x;
 }
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, bool TP6>
 SFL_NODISCARD
 bool operator<=
 (
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& x,
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& y
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return !(y < x);
 }
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, bool TP6>
 SFL_NODISCARD
 bool operator>=
 (
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& x,
-    const rb_tree<TP1, TP2, TP3, TP4, TP5>& y
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const rb_tree<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return !(x < y);
@@ -0,0 +1,264 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_TIERED_ITERATOR_HPP_INCLUDED
+#define SFL_DETAIL_TIERED_ITERATOR_HPP_INCLUDED
+
+#include <sfl/detail/memory/to_address.hpp>
+#include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/cpp.hpp>
+
+#include <cstddef>      // size_t
+#include <iterator>     // iterator_traits, random_access_iterator_tag
+#include <memory>       // pointer_traits
+#include <type_traits>  // conditional
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Segment of tiered vector. Storage of segment is circular buffer, i.e.
+// the first element of segment is not necessarily stored at the beginning
+// of storage. Element with logical index `i` is stored at physical index
+// `(head_ + i) % SegmentSize`.
+//
+template <typename Pointer>
+struct tiered_segment
+{
+    Pointer     elements_; // Storage for `SegmentSize` elements
+    std::size_t head_;     // Physical index of the first element
+};
+
+template <typename SegmentPointer, typename Pointer, std::size_t SegmentSize, bool IsConst>
+class tiered_iterator
+{
+    template <typename, typename, std::size_t, bool>
+    friend class tiered_iterator;
+
+public:
+
+    SegmentPointer table_;
+
+    typename std::iterator_traits<Pointer>::difference_type index_;
+
+public:
+
+    using difference_type = typename std::iterator_traits<Pointer>::difference_type;
+
+    using value_type = typename std::iterator_traits<Pointer>::value_type;
+
+    using pointer = typename std::conditional
+    <
+        IsConst,
+        typename std::pointer_traits<Pointer>::template rebind<const value_type>,
+        Pointer
+    >::type;
+
+    using reference = typename std::iterator_traits<pointer>::reference;
+
+    using iterator_category = std::random_access_iterator_tag;
+
+public:
+
+    explicit tiered_iterator(const SegmentPointer& table, difference_type index) noexcept
+        : table_(table)
+        , index_(index)
+    {}
+
+public:
+
+    // Default constructor
+    tiered_iterator() noexcept
+        : table_()
+        , index_()
+    {}
+
+    // Copy constructor
+    tiered_iterator(const tiered_iterator& other) noexcept
+        : table_(other.table_)
+        , index_(other.index_)
+    {}
+
+    // Converting constructor (from iterator to const_iterator)
+    template <bool IsConst2 = IsConst,
+              sfl::dtl::enable_if_t<IsConst2 == false>* = nullptr>
+    tiered_iterator(const tiered_iterator<SegmentPointer, Pointer, SegmentSize, IsConst2>& other) noexcept
+        : table_(other.table_)
+        , index_(other.index_)
+    {}
+
+    // Copy assignment operator
+    tiered_iterator& operator=(const tiered_iterator& other) noexcept
+    {
+        table_ = other.table_;
+        index_ = other.index_;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    reference operator*() const noexcept
+    {
+        return *element();
+    }
+
+    SFL_NODISCARD
+    pointer operator->() const noexcept
+    {
+        return sfl::dtl::to_address(element());
+    }
+
+    tiered_iterator& operator++() noexcept
+    {
+        ++index_;
+        return *this;
+    }
+
+    tiered_iterator operator++(int) noexcept
+    {
+        auto temp = *this;
+        this->operator++();
+        return temp;
+    }
+
+    tiered_iterator& operator--() noexcept
+    {
+        --index_;
+        return *this;
+    }
+
+    tiered_iterator operator--(int) noexcept
+    {
+        auto temp = *this;
+        this->operator--();
+        return temp;
+    }
+
+    tiered_iterator& operator+=(difference_type n) noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+
+    tiered_iterator& operator-=(difference_type n) noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+
+    SFL_NODISCARD
+    tiered_iterator operator+(difference_type n) const noexcept
+    {
+        auto temp = *this;
+        temp += n;
+        return temp;
+    }
+
+    SFL_NODISCARD
+    tiered_iterator operator-(difference_type n) const noexcept
+    {
+        auto temp = *this;
+        temp -= n;
+        return temp;
+    }
+
+    SFL_NODISCARD
+    reference operator[](difference_type n) const noexcept
+    {
+        auto temp = *this;
+        temp += n;
+        return *temp;
+    }
+
+    SFL_NODISCARD
+    friend tiered_iterator operator+(difference_type n, const tiered_iterator& it) noexcept
+    {
+        return it + n;
+    }
+
+    SFL_NODISCARD
+    friend difference_type operator-(const tiered_iterator& x, const tiered_iterator& y) noexcept
+    {
+        return x.index_ - y.index_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator==(const tiered_iterator& x, const tiered_iterator& y) noexcept
+    {
+        return x.index_ == y.index_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator!=(const tiered_iterator& x, const tiered_iterator& y) noexcept
+    {
+        return !(x == y);
+    }
+
+    SFL_NODISCARD
+    friend bool operator<(const tiered_iterator& x, const tiered_iterator& y) noexcept
+    {
+        return x.index_ < y.index_;
+    }
+
+    SFL_NODISCARD
+    friend bool operator>(const tiered_iterator& x, const tiered_iterator& y) noexcept
+    {
+        return y < x;
+    }
+
+    SFL_NODISCARD
+    friend bool operator<=(const tiered_iterator& x, const tiered_iterator& y) noexcept
+    {
+        return !(y < x);
+    }
+
+    SFL_NODISCARD
+    friend bool operator>=(const tiered_iterator& x, const tiered_iterator& y) noexcept
+    {
+        return !(x < y);
+    }
+
+private:
+
+    Pointer element() const noexcept
+    {
+        const std::size_t i = std::size_t(index_) / SegmentSize;
+        const std::size_t j = std::size_t(index_) - i * SegmentSize;
+
+        const auto seg = table_ + i;
+
+        std::size_t k = seg->head_ + j;
+
+        if (k >= SegmentSize)
+        {
+            k -= SegmentSize;
+        }
+
+        return seg->elements_ + k;
+    }
+};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_TIERED_ITERATOR_HPP_INCLUDED
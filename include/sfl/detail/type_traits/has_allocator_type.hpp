@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_HAS_ALLOCATOR_TYPE_HPP_INCLUDED
+#define SFL_DETAIL_HAS_ALLOCATOR_TYPE_HPP_INCLUDED
+
+#include <sfl/detail/type_traits/void_t.hpp>
+
+#include <type_traits> // true_type, false_type
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+template <typename Type, typename = void>
+struct has_allocator_type : std::false_type {};
+
+template <typename Type>
+struct has_allocator_type<Type, sfl::dtl::void_t<typename Type::allocator_type>> : std::true_type {};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_HAS_ALLOCATOR_TYPE_HPP_INCLUDED
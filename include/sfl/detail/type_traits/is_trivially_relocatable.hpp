@@ -0,0 +1,104 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+#ifndef SFL_DETAIL_IS_TRIVIALLY_RELOCATABLE_HPP_INCLUDED
+#define SFL_DETAIL_IS_TRIVIALLY_RELOCATABLE_HPP_INCLUDED
+
+#include <sfl/detail/type_traits/void_t.hpp>
+
+#include <memory>      // allocator, unique_ptr, default_delete
+#include <type_traits> // integral_constant, is_trivially_copyable, is_trivial
+#include <utility>     // declval
+
+namespace sfl
+{
+
+//
+// Checks whether objects of type T can be relocated (moved to a new address
+// and destroyed at the old one) simply by copying their bytes.
+//
+// Users can specialize this trait for their own types.
+//
+template <typename T>
+struct is_trivially_relocatable
+#if defined(__GLIBCXX__) && !defined(_GLIBCXX_USE_CXX11_ABI)
+    // libstdc++ older than 5.0 doesn't provide std::is_trivially_copyable.
+    : std::integral_constant<bool, std::is_trivial<T>::value> {};
+#else
+    : std::integral_constant<bool, std::is_trivially_copyable<T>::value> {};
+#endif
+
+template <typename T>
+struct is_trivially_relocatable<std::unique_ptr<T, std::default_delete<T>>>
+    : std::true_type {};
+
+namespace dtl
+{
+
+template <typename Allocator, typename = void>
+struct has_construct_member : std::false_type {};
+
+template <typename Allocator>
+struct has_construct_member
+<
+    Allocator,
+    sfl::dtl::void_t<decltype(std::declval<Allocator&>().construct(std::declval<typename Allocator::value_type*>(),
+                                                                   std::declval<typename Allocator::value_type&&>()))>
+> : std::true_type {};
+
+template <typename Allocator, typename = void>
+struct has_destroy_member : std::false_type {};
+
+template <typename Allocator>
+struct has_destroy_member
+<
+    Allocator,
+    sfl::dtl::void_t<decltype(std::declval<Allocator&>().destroy(std::declval<typename Allocator::value_type*>()))>
+> : std::true_type {};
+
+template <typename Allocator>
+struct is_std_allocator : std::false_type {};
+
+template <typename T>
+struct is_std_allocator<std::allocator<T>> : std::true_type {};
+
+//
+// Checks whether elements of container that uses allocator `Allocator` can be
+// relocated by copying their bytes. Value type must be trivially relocatable
+// and allocator must not customize construction and destruction of elements.
+//
+template <typename Allocator>
+struct is_trivially_relocatable_a : std::integral_constant
+<
+    bool,
+    sfl::is_trivially_relocatable<typename Allocator::value_type>::value &&
+    (
+        sfl::dtl::is_std_allocator<Allocator>::value ||
+        (
+            !sfl::dtl::has_construct_member<Allocator>::value &&
+            !sfl::dtl::has_destroy_member<Allocator>::value
+        )
+    )
+> {};
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_IS_TRIVIALLY_RELOCATABLE_HPP_INCLUDED
@@ -0,0 +1,60 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_DETAIL_SEGMENT_LOCAL_ITERATOR_T_HPP_INCLUDED
+#define SFL_DETAIL_SEGMENT_LOCAL_ITERATOR_T_HPP_INCLUDED
+
+#include <sfl/detail/type_traits/is_segmented_iterator.hpp>
+
+#include <iterator>    // iterator_traits
+#include <type_traits> // remove_reference
+
+namespace sfl
+{
+
+namespace dtl
+{
+
+//
+// Type of iterators that denote contiguous parts of the range visited by
+// `for_each_segment`. It is raw pointer to elements if `T` is segmented
+// iterator (pointer to const if `T` is constant iterator), otherwise it is `T`.
+//
+
+template <typename T, bool = sfl::dtl::is_segmented_iterator<T>::value>
+struct segment_local_iterator
+{
+    using type = T;
+};
+
+template <typename T>
+struct segment_local_iterator<T, true>
+{
+    using type = typename std::remove_reference<typename std::iterator_traits<T>::reference>::type*;
+};
+
+template <typename T>
+using segment_local_iterator_t = typename sfl::dtl::segment_local_iterator<T>::type;
+
+} // namespace dtl
+
+} // namespace sfl
+
+#endif // SFL_DETAIL_SEGMENT_LOCAL_ITERATOR_T_HPP_INCLUDED
@@ -26,6 +26,7 @@
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
 #include <sfl/detail/utility/ignore_unused.hpp>
 #include <sfl/detail/cpp.hpp>
+#include <sfl/detail/linear_fingerprints.hpp>
 
 #include <algorithm>    // is_permutation
 #include <iterator>     // distance, next, prev
@@ -54,8 +55,9 @@ template < typename Key,
            typename Value,
            typename KeyOfValue,
            typename KeyEqual,
-           typename Vector >
-class unordered_associative_vector : private KeyEqual, private Vector
+           typename Vector,
+           typename Fingerprints = sfl::dtl::no_linear_fingerprints >
+class unordered_associative_vector : private KeyEqual, private Vector, private Fingerprints
 {
     static_assert
     (
@@ -103,45 +105,53 @@ public:
     unordered_associative_vector()
         : KeyEqual()
         , Vector()
+        , Fingerprints()
     {}
 
     unordered_associative_vector(const KeyEqual& equal)
         : KeyEqual(equal)
         , Vector()
+        , Fingerprints()
     {}
 
     template <typename Alloc>
     unordered_associative_vector(const Alloc& alloc)
         : KeyEqual()
         , Vector(alloc)
+        , Fingerprints(alloc)
     {}
 
     template <typename Alloc>
     unordered_associative_vector(const KeyEqual& equal, const Alloc& alloc)
         : KeyEqual(equal)
         , Vector(alloc)
+        , Fingerprints(alloc)
     {}
 
     unordered_associative_vector(const unordered_associative_vector& other)
         : KeyEqual(other.ref_to_key_equal())
         , Vector(other.ref_to_vector())
+        , Fingerprints(other.ref_to_fingerprints())
     {}
 
     template <typename Alloc>
     unordered_associative_vector(const unordered_associative_vector& other, const Alloc& alloc)
         : KeyEqual(other.ref_to_key_equal())
         , Vector(other.ref_to_vector(), alloc)
+        , Fingerprints(other.ref_to_fingerprints(), alloc)
     {}
 
     unordered_associative_vector(unordered_associative_vector&& other)
         : KeyEqual(std::move(other.ref_to_key_equal()))
         , Vector(std::move(other.ref_to_vector()))
+        , Fingerprints(std::move(other.ref_to_fingerprints()))
     {}
 
     template <typename Alloc>
     unordered_associative_vector(unordered_associative_vector&& other, const Alloc& alloc)
         : KeyEqual(std::move(other.ref_to_key_equal()))
         , Vector(std::move(other.ref_to_vector()), alloc)
+        , Fingerprints(std::move(other.ref_to_fingerprints()), alloc)
     {}
 
     ~unordered_associative_vector()
@@ -162,14 +172,34 @@ public:
         if (this != &other)
         {
             ref_to_key_equal() = other.ref_to_key_equal();
-            ref_to_vector() = other.ref_to_vector();
+
+            SFL_TRY
+            {
+                ref_to_vector() = other.ref_to_vector();
+                ref_to_fingerprints() = other.ref_to_fingerprints();
+            }
+            SFL_CATCH (...)
+            {
+                rebuild_after_exception();
+                SFL_RETHROW;
+            }
         }
     }
 
     void assign_move(unordered_associative_vector& other)
     {
         ref_to_key_equal() = std::move(other.ref_to_key_equal());
-        ref_to_vector() = std::move(other.ref_to_vector());
+
+        SFL_TRY
+        {
+            ref_to_vector() = std::move(other.ref_to_vector());
+            ref_to_fingerprints() = std::move(other.ref_to_fingerprints());
+        }
+        SFL_CATCH (...)
+        {
+            rebuild_after_exception();
+            SFL_RETHROW;
+        }
     }
 
     template <typename InputIt,
@@ -180,7 +210,16 @@ public:
 
         while (first != last && it != end())
         {
-            *it = *first;
+            SFL_TRY
+            {
+                *it = *first;
+                ref_to_fingerprints().replace(index_of(it), KeyOfValue()(*it));
+            }
+            SFL_CATCH (...)
+            {
+                repair_after_exception(index_of(it), index_of(it) + 1);
+                SFL_RETHROW;
+            }
             ++it;
             ++first;
         }
@@ -245,6 +284,22 @@ public:
         return *this;
     }
 
+    //
+    // ---- FINGERPRINTS ------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    Fingerprints& ref_to_fingerprints() noexcept
+    {
+        return *this;
+    }
+
+    SFL_NODISCARD
+    const Fingerprints& ref_to_fingerprints() const noexcept
+    {
+        return *this;
+    }
+
     //
     // ---- ITERATORS ---------------------------------------------------------
     //
@@ -340,11 +395,13 @@ public:
     void reserve(size_type new_cap)
     {
         ref_to_vector().reserve(new_cap);
+        ref_to_fingerprints().reserve(new_cap);
     }
 
     void shrink_to_fit()
     {
         ref_to_vector().shrink_to_fit();
+        ref_to_fingerprints().shrink_to_fit();
     }
 
     //
@@ -354,25 +411,26 @@ public:
     void clear() noexcept
     {
         ref_to_vector().clear();
+        ref_to_fingerprints().clear();
     }
 
     template <typename... Args>
     iterator emplace_equal(Args&&... args)
     {
-        return ref_to_vector().emplace(end(), std::forward<Args>(args)...);
+        return emplace_back(std::forward<Args>(args)...);
     }
 
     template <typename... Args>
     std::pair<iterator, bool> emplace_unique(Args&&... args)
     {
-        auto it1 = ref_to_vector().emplace(end(), std::forward<Args>(args)...);
+        auto it1 = emplace_back(std::forward<Args>(args)...);
         auto it2 = find(KeyOfValue()(*it1));
 
         bool is_unique = it1 == it2;
 
         if (!is_unique)
         {
-            ref_to_vector().pop_back();
+            pop_back();
         }
 
         return std::make_pair(it2, is_unique);
@@ -382,7 +440,7 @@ public:
     iterator emplace_hint_equal(const_iterator hint, Args&&... args)
     {
         sfl::dtl::ignore_unused(hint);
-        return ref_to_vector().emplace(end(), std::forward<Args>(args)...);
+        return emplace_back(std::forward<Args>(args)...);
     }
 
     template <typename... Args>
@@ -390,14 +448,14 @@ public:
     {
         sfl::dtl::ignore_unused(hint);
 
-        auto it1 = ref_to_vector().emplace(end(), std::forward<Args>(args)...);
+        auto it1 = emplace_back(std::forward<Args>(args)...);
         auto it2 = find(KeyOfValue()(*it1));
 
         bool is_unique = it1 == it2;
 
         if (!is_unique)
         {
-            ref_to_vector().pop_back();
+            pop_back();
         }
 
         return it2;
@@ -406,7 +464,7 @@ public:
     template <typename V>
     iterator insert_equal(V&& value)
     {
-        return ref_to_vector().emplace(end(), std::forward<V>(value));
+        return emplace_back(std::forward<V>(value));
     }
 
     template <typename V>
@@ -415,7 +473,7 @@ public:
         auto it = find(KeyOfValue()(value));
         if (it == end())
         {
-            return std::make_pair(ref_to_vector().emplace(end(), std::forward<V>(value)), true);
+            return std::make_pair(emplace_back(std::forward<V>(value)), true);
         }
         else
         {
@@ -427,7 +485,7 @@ public:
     iterator insert_hint_equal(const_iterator hint, V&& value)
     {
         sfl::dtl::ignore_unused(hint);
-        return ref_to_vector().emplace(end(), std::forward<V>(value));
+        return emplace_back(std::forward<V>(value));
     }
 
     template <typename V>
@@ -436,7 +494,7 @@ public:
         auto it = find_hint(hint, KeyOfValue()(value));
         if (it == end())
         {
-            return ref_to_vector().emplace(end(), std::forward<V>(value));
+            return emplace_back(std::forward<V>(value));
         }
         else
         {
@@ -457,9 +515,8 @@ public:
         {
             return std::make_pair
             (
-                ref_to_vector().emplace
+                emplace_back
                 (
-                    end(),
                     std::piecewise_construct,
                     std::forward_as_tuple(std::forward<K>(k)),
                     std::forward_as_tuple(std::forward<M>(obj))
@@ -480,9 +537,8 @@ public:
         }
         else
         {
-            return ref_to_vector().emplace
+            return emplace_back
             (
-                end(),
                 std::piecewise_construct,
                 std::forward_as_tuple(std::forward<K>(k)),
                 std::forward_as_tuple(std::forward<M>(obj))
@@ -502,9 +558,8 @@ public:
         {
             return std::make_pair
             (
-                ref_to_vector().emplace
+                emplace_back
                 (
-                    end(),
                     std::piecewise_construct,
                     std::forward_as_tuple(std::forward<K>(k)),
                     std::forward_as_tuple(std::forward<Args>(args)...)
@@ -524,9 +579,8 @@ public:
         }
         else
         {
-            return ref_to_vector().emplace
+            return emplace_back
             (
-                end(),
                 std::piecewise_construct,
                 std::forward_as_tuple(std::forward<K>(k)),
                 std::forward_as_tuple(std::forward<Args>(args)...)
@@ -544,9 +598,19 @@ public:
 
         if (it != last)
         {
-            *it = std::move(*last);
+            SFL_TRY
+            {
+                *it = std::move(*last);
+            }
+            SFL_CATCH (...)
+            {
+                repair_after_exception(index_of(it), index_of(it) + 1);
+                repair_after_exception(index_of(last), index_of(last) + 1);
+                SFL_RETHROW;
+            }
         }
 
+        ref_to_fingerprints().erase_by_moving_last(index_of(it));
         ref_to_vector().pop_back();
 
         return it;
@@ -566,17 +630,33 @@ public:
         auto count1 = std::distance(first, last);
         auto count2 = std::distance(last, cend());
 
-        if (count1 >= count2)
-        {
-            ref_to_vector().erase(first, last);
-        }
-        else
+        const size_type index1 = index_of(first);
+        const size_type index2 = index_of(last);
+
+        SFL_TRY
         {
-            auto it2 = std::next(it1, count2);
+            if (count1 >= count2)
+            {
+                ref_to_vector().erase(first, last);
+                ref_to_fingerprints().erase(index1, index2);
+            }
+            else
+            {
+                auto it2 = std::next(it1, count2);
+
+                sfl::dtl::move(it2, end(), it1);
 
-            sfl::dtl::move(it2, end(), it1);
+                ref_to_fingerprints().erase_by_moving_tail(index1, index2);
 
-            ref_to_vector().erase(it2, end());
+                ref_to_vector().erase(it2, end());
+            }
+        }
+        SFL_CATCH (...)
+        {
+            // Number of elements is unchanged, but elements after `first`
+            // may have been moved.
+            repair_after_exception(index1, size());
+            SFL_RETHROW;
         }
 
         return it1;
@@ -587,17 +667,10 @@ public:
     {
         size_type n = 0;
 
-        for (auto it = begin(); it != end();)
+        for (size_type i = find_index(0, k); i != size(); i = find_index(i, k))
         {
-            if (ref_to_key_equal()(KeyOfValue()(*it), k))
-            {
-                it = erase(it);
-                ++n;
-            }
-            else
-            {
-                ++it;
-            }
+            erase(nth(i));
+            ++n;
         }
 
         return n;
@@ -624,6 +697,7 @@ public:
         using std::swap;
         swap(ref_to_key_equal(), other.ref_to_key_equal());
         swap(ref_to_vector(), other.ref_to_vector());
+        ref_to_fingerprints().swap(other.ref_to_fingerprints());
     }
 
     //
@@ -634,30 +708,14 @@ public:
     SFL_NODISCARD
     iterator find(const K& k)
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (ref_to_key_equal()(KeyOfValue()(*it), k))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return std::next(begin(), difference_type(find_index(0, k)));
     }
 
     template <typename K>
     SFL_NODISCARD
     const_iterator find(const K& k) const
     {
-        for (auto it = begin(); it != end(); ++it)
-        {
-            if (ref_to_key_equal()(KeyOfValue()(*it), k))
-            {
-                return it;
-            }
-        }
-
-        return end();
+        return std::next(begin(), difference_type(find_index(0, k)));
     }
 
     template <typename K>
@@ -666,12 +724,9 @@ public:
     {
         size_type n = 0;
 
-        for (auto it = begin(); it != end(); ++it)
+        for (size_type i = find_index(0, k); i != size(); i = find_index(i + 1, k))
         {
-            if (ref_to_key_equal()(KeyOfValue()(*it), k))
-            {
-                ++n;
-            }
+            ++n;
         }
 
         return n;
@@ -717,15 +772,72 @@ private:
             return std::next(begin(), std::distance(cbegin(), hint));
         }
 
-        for (auto it = begin(); it != end(); ++it)
+        return find(k);
+    }
+
+    // Returns index of the first element at or after `pos` whose key is
+    // equal to `k`, or `size()` if there is no such element.
+    template <typename K>
+    size_type find_index(size_type pos, const K& k) const
+    {
+        return ref_to_fingerprints().template find<KeyOfValue>(data(), pos, size(), k, ref_to_key_equal());
+    }
+
+    template <typename... Args>
+    iterator emplace_back(Args&&... args)
+    {
+        auto it = ref_to_vector().emplace(end(), std::forward<Args>(args)...);
+
+        SFL_TRY
         {
-            if (ref_to_key_equal()(KeyOfValue()(*it), k))
-            {
-                return it;
-            }
+            ref_to_fingerprints().push_back(KeyOfValue()(*it));
+        }
+        SFL_CATCH (...)
+        {
+            ref_to_vector().pop_back();
+            SFL_RETHROW;
         }
 
-        return end();
+        return it;
+    }
+
+    void pop_back()
+    {
+        ref_to_vector().pop_back();
+        ref_to_fingerprints().pop_back();
+    }
+
+    // An exception was thrown while elements [first, last) were modified,
+    // so their fingerprints may no longer match. Recomputes them. If that
+    // throws too, fingerprints are invalidated and lookup compares keys of
+    // all elements. Elements are kept.
+    void repair_after_exception(size_type first, size_type last) noexcept
+    {
+        SFL_TRY
+        {
+            ref_to_fingerprints().template refresh<KeyOfValue>(data(), first, last);
+        }
+        SFL_CATCH (...)
+        {
+            ref_to_fingerprints().invalidate();
+        }
+    }
+
+    // An exception was thrown while the vector of elements was assigned,
+    // so the number of fingerprints may differ from the number of elements.
+    // Rebuilds all fingerprints. If that throws too, fingerprints remain
+    // invalidated and lookup compares keys of all elements. Elements are
+    // kept.
+    void rebuild_after_exception() noexcept
+    {
+        SFL_TRY
+        {
+            ref_to_fingerprints().template rebuild<KeyOfValue>(data(), size());
+        }
+        SFL_CATCH (...)
+        {
+            // Nothing to do.
+        }
     }
 };
 
@@ -735,23 +847,23 @@ private:
 ///////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6>
 SFL_NODISCARD
 bool operator==
 (
-    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5>& x,
-    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5>& y
+    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return x.size() == y.size() && std::is_permutation(x.begin(), x.end(), y.begin());
 }
 
-template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5>
+template <typename TP1, typename TP2, typename TP3, typename TP4, typename TP5, typename TP6>
 SFL_NODISCARD
 bool operator!=
 (
-    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5>& x,
-    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5>& y
+    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5, TP6>& x,
+    const unordered_associative_vector<TP1, TP2, TP3, TP4, TP5, TP6>& y
 )
 {
     return !(x == y);
@@ -32,14 +32,16 @@
 #include <sfl/detail/memory/destroy_a.hpp>
 #include <sfl/detail/memory/destroy_at_a.hpp>
 #include <sfl/detail/memory/destroy_n_a.hpp>
+#include <sfl/detail/memory/relocate_a.hpp>
 #include <sfl/detail/memory/to_address.hpp>
 #include <sfl/detail/memory/uninitialized_copy_a.hpp>
 #include <sfl/detail/memory/uninitialized_default_construct_a.hpp>
 #include <sfl/detail/memory/uninitialized_default_construct_n_a.hpp>
+#include <sfl/detail/memory/uninitialized_default_init_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_fill_a.hpp>
 #include <sfl/detail/memory/uninitialized_fill_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_move_a.hpp>
-#include <sfl/detail/memory/uninitialized_move_if_noexcept_a.hpp>
+#include <sfl/detail/tags/default_init_t.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -48,6 +50,7 @@
 #include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/growth_policy.hpp>
 #include <sfl/detail/normal_iterator.hpp>
 
 #include <algorithm>        // copy, move, swap, swap_ranges
@@ -68,7 +71,9 @@ void test_devector();
 namespace sfl
 {
 
-template <typename T, typename Allocator = std::allocator<T>>
+template < typename T,
+           typename Allocator = std::allocator<T>,
+           typename GrowthPolicy = sfl::growth_factor_1_5 >
 class devector
 {
     #ifdef SFL_TEST_DEVECTOR
@@ -79,6 +84,7 @@ class devector
 public:
 
     using allocator_type         = Allocator;
+    using growth_policy          = GrowthPolicy;
     using value_type             = T;
     using size_type              = typename sfl::dtl::allocator_traits<allocator_type>::size_type;
     using difference_type        = typename sfl::dtl::allocator_traits<allocator_type>::difference_type;
@@ -522,14 +528,15 @@ public:
         {
             const size_type n = available_back + new_capacity;
 
-            pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
-            pointer new_eos   = new_bos + n;
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            pointer new_bos   = new_storage.ptr;
+            pointer new_eos   = new_bos + new_storage.count;
             pointer new_first = new_eos - std::distance(data_.first_, data_.eos_);
             pointer new_last  = new_first;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -543,13 +550,13 @@ public:
                 (
                     data_.ref_to_alloc(),
                     new_bos,
-                    n
+                    std::distance(new_bos, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -587,14 +594,15 @@ public:
         {
             const size_type n = available_front + new_capacity;
 
-            pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
-            pointer new_eos   = new_bos + n;
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            pointer new_bos   = new_storage.ptr;
+            pointer new_eos   = new_bos + new_storage.count;
             pointer new_first = new_bos + std::distance(data_.bos_, data_.first_);
             pointer new_last  = new_first;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -608,13 +616,13 @@ public:
                 (
                     data_.ref_to_alloc(),
                     new_bos,
-                    n
+                    std::distance(new_bos, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -641,14 +649,15 @@ public:
 
         if (new_cap < capacity())
         {
-            pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_bos   = new_storage.ptr;
             pointer new_first = new_bos;
             pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
+            pointer new_eos   = new_first + new_storage.count;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -662,13 +671,13 @@ public:
                 (
                     data_.ref_to_alloc(),
                     new_bos,
-                    new_cap
+                    std::distance(new_bos, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -961,19 +970,13 @@ public:
 
         if (dist_to_begin < dist_to_end)
         {
-            const pointer old_first = data_.first_;
-
-            data_.first_ = sfl::dtl::move_backward(data_.first_, p1, p2);
-
-            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), old_first);
+            data_.first_ = sfl::dtl::erase_shift_backward_a(data_.ref_to_alloc(), data_.first_, p1, p2);
 
             return iterator(p2);
         }
         else
         {
-            data_.last_ = sfl::dtl::move(p2, data_.last_, p1);
-
-            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+            data_.last_ = sfl::dtl::erase_shift_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
             return iterator(p1);
         }
@@ -996,21 +999,13 @@ public:
 
         if (dist_to_begin < dist_to_end)
         {
-            const pointer new_first = sfl::dtl::move_backward(data_.first_, p1, p2);
-
-            sfl::dtl::destroy_a(data_.ref_to_alloc(), data_.first_, new_first);
-
-            data_.first_ = new_first;
+            data_.first_ = sfl::dtl::erase_shift_backward_a(data_.ref_to_alloc(), data_.first_, p1, p2);
 
             return iterator(p2);
         }
         else
         {
-            const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
-
-            sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
-
-            data_.last_ = new_last;
+            data_.last_ = sfl::dtl::erase_shift_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
             return iterator(p1);
         }
@@ -1295,6 +1290,41 @@ public:
         }
     }
 
+    void resize_back(size_type n, sfl::default_init_t)
+    {
+        const size_type size = this->size();
+
+        if (n <= size)
+        {
+            const pointer new_last = data_.first_ + n;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                new_last,
+                data_.last_
+            );
+
+            data_.last_ = new_last;
+        }
+        else
+        {
+            const size_type available_back = this->available_back();
+
+            if (n > size + available_back)
+            {
+                grow_storage_back(n - (size + available_back));
+            }
+
+            data_.last_ = sfl::dtl::uninitialized_default_init_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                n - size
+            );
+        }
+    }
+
     void resize_back(size_type n, const T& value)
     {
         const size_type size = this->size();
@@ -1331,6 +1361,47 @@ public:
         }
     }
 
+    T* append_uninitialized(size_type n)
+    {
+        const size_type size = this->size();
+
+        if (n > available_back())
+        {
+            grow_storage_back(calculate_additional_capacity_for_grow_storage_back(n));
+        }
+
+        resize_back(size + n, sfl::default_init_t());
+
+        return data() + size;
+    }
+
+    template <typename Operation>
+    void resize_and_overwrite(size_type n, Operation op)
+    {
+        const size_type size = this->size();
+
+        if (n > size + available_back())
+        {
+            grow_storage_back(calculate_additional_capacity_for_grow_storage_back(n - size));
+        }
+
+        resize_back(n, sfl::default_init_t());
+
+        SFL_TRY
+        {
+            const size_type new_size = std::move(op)(data(), n);
+
+            SFL_ASSERT(new_size <= n);
+
+            resize_back(new_size, sfl::default_init_t());
+        }
+        SFL_CATCH (...)
+        {
+            resize_back(std::min(size, n), sfl::default_init_t());
+            SFL_RETHROW;
+        }
+    }
+
     void swap(devector& other)
     {
         if (this == &other)
@@ -1492,18 +1563,23 @@ private:
         const size_type capacity_front  = std::distance(data_.bos_, data_.last_);
         const size_type available_front = std::distance(data_.bos_, data_.first_);
 
-        if (num_additional_elements >= available_front)
-        {
-            return std::max
-            (
-                num_additional_elements - available_front,
-                capacity_front / 2
-            );
-        }
-        else
+        const size_type max_capacity_front = max_size() - std::distance(data_.last_, data_.eos_);
+
+        const size_type required =
+            num_additional_elements >= available_front ? num_additional_elements - available_front : 0;
+
+        if (required > max_capacity_front - capacity_front)
         {
-            return capacity_front / 2;
+            // Caller will throw length error.
+            return required;
         }
+
+        return GrowthPolicy::template new_capacity<T>
+        (
+            capacity_front,
+            size_type(capacity_front + required),
+            max_capacity_front
+        ) - capacity_front;
     }
 
     size_type calculate_additional_capacity_for_grow_storage_back(size_type num_additional_elements)
@@ -1511,18 +1587,23 @@ private:
         const size_type capacity_back  = std::distance(data_.first_, data_.eos_);
         const size_type available_back = std::distance(data_.last_,  data_.eos_);
 
-        if (num_additional_elements >= available_back)
-        {
-            return std::max
-            (
-                num_additional_elements - available_back,
-                capacity_back / 2
-            );
-        }
-        else
+        const size_type max_capacity_back = max_size() - std::distance(data_.bos_, data_.first_);
+
+        const size_type required =
+            num_additional_elements >= available_back ? num_additional_elements - available_back : 0;
+
+        if (required > max_capacity_back - capacity_back)
         {
-            return capacity_back / 2;
+            // Caller will throw length error.
+            return required;
         }
+
+        return GrowthPolicy::template new_capacity<T>
+        (
+            capacity_back,
+            size_type(capacity_back + required),
+            max_capacity_back
+        ) - capacity_back;
     }
 
     void reset(size_type new_cap = 0)
@@ -1551,10 +1632,11 @@ private:
         // first_, last_ and eos_ won't be dangling pointers.
         if (new_cap > 0)
         {
-            data_.bos_   = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            data_.bos_   = storage.ptr;
             data_.first_ = data_.bos_;
             data_.last_  = data_.bos_;
-            data_.eos_   = data_.bos_ + new_cap;
+            data_.eos_   = data_.bos_ + storage.count;
         }
     }
 
@@ -1570,14 +1652,15 @@ private:
 
         const size_type n = capacity + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
-        pointer new_eos   = new_bos + n;
+        const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        pointer new_bos   = new_storage.ptr;
+        pointer new_eos   = new_bos + new_storage.count;
         pointer new_first = new_eos - std::distance(data_.first_, data_.eos_);
         pointer new_last  = new_first;
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1591,13 +1674,13 @@ private:
             (
                 data_.ref_to_alloc(),
                 new_bos,
-                n
+                std::distance(new_bos, new_eos)
             );
 
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -1629,14 +1712,15 @@ private:
 
         const size_type n = capacity + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
-        pointer new_eos   = new_bos + n;
+        const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        pointer new_bos   = new_storage.ptr;
+        pointer new_eos   = new_bos + new_storage.count;
         pointer new_first = new_bos + std::distance(data_.bos_, data_.first_);
         pointer new_last  = new_first;
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1650,13 +1734,13 @@ private:
             (
                 data_.ref_to_alloc(),
                 new_bos,
-                n
+                std::distance(new_bos, new_eos)
             );
 
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -1680,10 +1764,11 @@ private:
     {
         check_size(n, "sfl::devector::initialize_default_n");
 
-        data_.bos_   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.bos_   = storage.ptr;
         data_.first_ = data_.bos_;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.bos_ + n;
+        data_.eos_   = data_.bos_ + storage.count;
 
         SFL_TRY
         {
@@ -1696,7 +1781,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, std::distance(data_.bos_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1705,10 +1790,11 @@ private:
     {
         check_size(n, "sfl::devector::initialize_fill_n");
 
-        data_.bos_   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.bos_   = storage.ptr;
         data_.first_ = data_.bos_;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.bos_ + n;
+        data_.eos_   = data_.bos_ + storage.count;
 
         SFL_TRY
         {
@@ -1722,7 +1808,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, std::distance(data_.bos_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1771,10 +1857,11 @@ private:
 
         check_size(n, "sfl::devector::initialize_range");
 
-        data_.bos_   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.bos_   = storage.ptr;
         data_.first_ = data_.bos_;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.bos_ + n;
+        data_.eos_   = data_.bos_ + storage.count;
 
         SFL_TRY
         {
@@ -1788,7 +1875,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, std::distance(data_.bos_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1826,10 +1913,11 @@ private:
 
         check_size(n, "sfl::devector::initialize_copy");
 
-        data_.bos_   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.bos_   = storage.ptr;
         data_.first_ = data_.bos_;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.bos_ + n;
+        data_.eos_   = data_.bos_ + storage.count;
 
         SFL_TRY
         {
@@ -1843,7 +1931,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, std::distance(data_.bos_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1868,10 +1956,11 @@ private:
 
             check_size(n, "sfl::devector::initialize_move");
 
-            data_.bos_   = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            data_.bos_   = storage.ptr;
             data_.first_ = data_.bos_;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.bos_ + n;
+            data_.eos_   = data_.bos_ + storage.count;
 
             SFL_TRY
             {
@@ -1885,7 +1974,7 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, n);
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.bos_, std::distance(data_.bos_, data_.eos_));
                 SFL_RETHROW;
             }
         }
@@ -4055,8 +4144,9 @@ private:
 
         const size_type new_cap = capacity() + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
-        pointer new_eos   = new_bos + new_cap;
+        const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+        pointer new_bos   = new_storage.ptr;
+        pointer new_eos   = new_bos + new_storage.count;
         pointer new_first = new_eos - std::distance(data_.last_, data_.eos_) - size() - insert_size;
         pointer new_last  = new_first;
 
@@ -4064,22 +4154,29 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_a
+            // First we will insert new elements and after that we
+            // can relocate existing elements.
+
+            proxy.uninitialized_insert_n
             (
                 data_.ref_to_alloc(),
-                data_.first_,
-                insert_pos.base(),
-                new_first
+                p,
+                insert_size
             );
 
-            new_last = proxy.uninitialized_insert_n
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
-                new_last,
-                insert_size
+                data_.first_,
+                insert_pos.base(),
+                new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_a
+            new_last += insert_size;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 insert_pos.base(),
@@ -4089,24 +4186,36 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    insert_size
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
                 data_.ref_to_alloc(),
                 new_bos,
-                new_cap
+                std::distance(new_bos, new_eos)
             );
 
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -4150,8 +4259,9 @@ private:
 
         const size_type new_cap = capacity() + additional_capacity;
 
-        pointer new_bos   = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
-        pointer new_eos   = new_bos + new_cap;
+        const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+        pointer new_bos   = new_storage.ptr;
+        pointer new_eos   = new_bos + new_storage.count;
         pointer new_first = new_bos + std::distance(data_.bos_, data_.first_);
         pointer new_last  = new_first;
 
@@ -4159,22 +4269,29 @@ private:
 
         SFL_TRY
         {
-            new_last = sfl::dtl::uninitialized_move_a
+            // First we will insert new elements and after that we
+            // can relocate existing elements.
+
+            proxy.uninitialized_insert_n
             (
                 data_.ref_to_alloc(),
-                data_.first_,
-                insert_pos.base(),
-                new_first
+                p,
+                insert_size
             );
 
-            new_last = proxy.uninitialized_insert_n
+            new_last = nullptr;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
-                new_last,
-                insert_size
+                data_.first_,
+                insert_pos.base(),
+                new_first
             );
 
-            new_last = sfl::dtl::uninitialized_move_a
+            new_last += insert_size;
+
+            new_last = sfl::dtl::uninitialized_relocate_a
             (
                 data_.ref_to_alloc(),
                 insert_pos.base(),
@@ -4184,24 +4301,36 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::destroy_a
-            (
-                data_.ref_to_alloc(),
-                new_first,
-                new_last
-            );
+            if (new_last == nullptr)
+            {
+                sfl::dtl::destroy_n_a
+                (
+                    data_.ref_to_alloc(),
+                    p,
+                    insert_size
+                );
+            }
+            else
+            {
+                sfl::dtl::destroy_a
+                (
+                    data_.ref_to_alloc(),
+                    new_first,
+                    new_last
+                );
+            }
 
             sfl::dtl::deallocate
             (
                 data_.ref_to_alloc(),
                 new_bos,
-                new_cap
+                std::distance(new_bos, new_eos)
             );
 
             SFL_RETHROW;
         }
 
-        sfl::dtl::destroy_a
+        sfl::dtl::destroy_relocated_a
         (
             data_.ref_to_alloc(),
             data_.first_,
@@ -4265,85 +4394,85 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator==
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator!=
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return !(x == y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return y < x;
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<=
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return !(y < x);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>=
 (
-    const devector<T, A>& x,
-    const devector<T, A>& y
+    const devector<T, A, G>& x,
+    const devector<T, A, G>& y
 )
 {
     return !(x < y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 void swap
 (
-    devector<T, A>& x,
-    devector<T, A>& y
+    devector<T, A, G>& x,
+    devector<T, A, G>& y
 )
 {
     x.swap(y);
 }
 
-template <typename T, typename A, typename U>
-typename devector<T, A>::size_type
-    erase(devector<T, A>& c, const U& value)
+template <typename T, typename A, typename G, typename U>
+typename devector<T, A, G>::size_type
+    erase(devector<T, A, G>& c, const U& value)
 {
     auto it = std::remove(c.begin(), c.end(), value);
     auto r = std::distance(it, c.end());
@@ -4351,9 +4480,9 @@ typename devector<T, A>::size_type
     return r;
 }
 
-template <typename T, typename A, typename Predicate>
-typename devector<T, A>::size_type
-    erase_if(devector<T, A>& c, Predicate pred)
+template <typename T, typename A, typename G, typename Predicate>
+typename devector<T, A, G>::size_type
+    erase_if(devector<T, A, G>& c, Predicate pred)
 {
     auto it = std::remove_if(c.begin(), c.end(), pred);
     auto r = std::distance(it, c.end());
@@ -24,6 +24,7 @@
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/functional/first.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_equivalent_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -190,6 +191,54 @@ public:
         : flat_multimap(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+        : impl_()
+    {
+        insert(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Compare& comp)
+        : impl_(comp)
+    {
+        insert(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Allocator& alloc)
+        : impl_(alloc)
+    {
+        insert(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    flat_multimap(sfl::sorted_equivalent_t, InputIt first, InputIt last, const Compare& comp, const Allocator& alloc)
+        : impl_(comp, alloc)
+    {
+        insert(sfl::sorted_equivalent_t(), first, last);
+    }
+
+    flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+        : flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end())
+    {}
+
+    flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist, const Allocator& alloc)
+        : flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    flat_multimap(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist, const Compare& comp, const Allocator& alloc)
+        : flat_multimap(sfl::sorted_equivalent_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     flat_multimap(const flat_multimap& other)
         : impl_(other.impl_)
     {}
@@ -535,6 +584,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_equivalent_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_equivalent_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -543,6 +604,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_equivalent_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -553,6 +620,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_equivalent_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
 #endif // before C++20
 
     iterator erase(iterator pos)
@@ -755,11 +830,13 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        impl_.insert_range_equal(std::move(first), std::move(last));
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        impl_.insert_range_sorted_equal(std::move(first), std::move(last));
     }
 
     template <typename K2, typename T2, typename C2, typename A2>
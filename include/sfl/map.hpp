@@ -24,6 +24,7 @@
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/functional/first.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_unique_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -43,6 +44,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, typename Compare, typename Allocator>
+class multimap;
+
 template < typename Key,
            typename T,
            typename Compare = std::less<Key>,
@@ -105,6 +109,8 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = sfl::dtl::map_node_handle<Key, T, allocator_type, typename tree_type::node_handle_node_type>;
+    using insert_return_type     = sfl::dtl::node_insert_return_type<iterator, node_type>;
 
 public:
 
@@ -192,6 +198,54 @@ public:
         : map(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : tree_()
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : tree_(comp)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    map(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : tree_(alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp, const Allocator& alloc)
+        : tree_(comp, alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Allocator& alloc)
+        : map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp, const Allocator& alloc)
+        : map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     map(const map& other)
         : tree_(other.tree_)
     {}
@@ -490,6 +544,28 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
+    insert_return_type insert(node_type&& nh)
+    {
+        return tree_.template insert_node_handle_unique<insert_return_type>(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_handle_hint_unique(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -498,6 +574,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -508,6 +590,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
 #endif // before C++20
 
     template <typename M,
@@ -638,6 +728,49 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.template extract<node_type>(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.template extract_key<node_type>(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     !std::is_convertible<K&&, const_iterator>::value &&
+                                     !std::is_convertible<K&&, iterator>::value >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.template extract_key<node_type>(x);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -867,13 +1000,21 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(std::move(first), std::move(last));
     }
 
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        tree_.insert_range_sorted_unique(std::move(first), std::move(last));
+    }
+
+    template <typename, typename, typename, typename>
+    friend class map;
+
+    template <typename, typename, typename, typename>
+    friend class multimap;
+
     template <typename K2, typename T2, typename C2, typename A2>
     friend bool operator==(const map<K2, T2, C2, A2>& x, const map<K2, T2, C2, A2>& y);
 
@@ -891,6 +1032,15 @@ private:
 
     template <typename K2, typename T2, typename C2, typename A2>
     friend bool operator>=(const map<K2, T2, C2, A2>& x, const map<K2, T2, C2, A2>& y);
+
+    template <typename K2, typename T2, typename C2, typename A2>
+    friend typename map<K2, T2, C2, A2>::size_type set_union_into(map<K2, T2, C2, A2>& x, const map<K2, T2, C2, A2>& y);
+
+    template <typename K2, typename T2, typename C2, typename A2>
+    friend typename map<K2, T2, C2, A2>::size_type set_intersection_into(map<K2, T2, C2, A2>& x, const map<K2, T2, C2, A2>& y);
+
+    template <typename K2, typename T2, typename C2, typename A2>
+    friend typename map<K2, T2, C2, A2>::size_type set_difference_into(map<K2, T2, C2, A2>& x, const map<K2, T2, C2, A2>& y);
 };
 
 //
@@ -994,6 +1144,27 @@ typename map<K, T, C, A>::size_type
     return old_size - c.size();
 }
 
+template <typename K, typename T, typename C, typename A>
+typename map<K, T, C, A>::size_type
+    set_union_into(map<K, T, C, A>& x, const map<K, T, C, A>& y)
+{
+    return x.tree_.union_unique(y.tree_);
+}
+
+template <typename K, typename T, typename C, typename A>
+typename map<K, T, C, A>::size_type
+    set_intersection_into(map<K, T, C, A>& x, const map<K, T, C, A>& y)
+{
+    return x.tree_.intersection_unique(y.tree_);
+}
+
+template <typename K, typename T, typename C, typename A>
+typename map<K, T, C, A>::size_type
+    set_difference_into(map<K, T, C, A>& x, const map<K, T, C, A>& y)
+{
+    return x.tree_.difference_unique(y.tree_);
+}
+
 } // namespace sfl
 
 #endif // SFL_MAP_HPP_INCLUDED
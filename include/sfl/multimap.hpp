@@ -41,6 +41,9 @@
 namespace sfl
 {
 
+template <typename Key, typename T, typename Compare, typename Allocator>
+class map;
+
 template < typename Key,
            typename T,
            typename Compare = std::less<Key>,
@@ -103,6 +106,7 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::reverse_iterator;
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = sfl::dtl::map_node_handle<Key, T, allocator_type, typename tree_type::node_handle_node_type>;
 
 public:
 
@@ -488,6 +492,16 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    iterator insert(node_type&& nh)
+    {
+        return tree_.insert_node_handle_equal(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_handle_hint_equal(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -540,6 +554,49 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.template extract<node_type>(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.template extract_key<node_type>(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     !std::is_convertible<K&&, const_iterator>::value &&
+                                     !std::is_convertible<K&&, iterator>::value >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.template extract_key<node_type>(x);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(map<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multimap<Key, T, Compare2, Allocator>&& source)
+    {
+        tree_.merge_equal(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -696,6 +753,12 @@ private:
         }
     }
 
+    template <typename, typename, typename, typename>
+    friend class multimap;
+
+    template <typename, typename, typename, typename>
+    friend class map;
+
     template <typename K2, typename T2, typename C2, typename A2>
     friend bool operator==(const multimap<K2, T2, C2, A2>& x, const multimap<K2, T2, C2, A2>& y);
 
@@ -0,0 +1,988 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_ORDER_STATISTIC_SET_HPP_INCLUDED
+#define SFL_ORDER_STATISTIC_SET_HPP_INCLUDED
+
+#include <sfl/detail/concepts/container_compatible_range.hpp>
+#include <sfl/detail/functional/identity.hpp>
+#include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_unique_t.hpp>
+#include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/type_traits/has_is_transparent.hpp>
+#include <sfl/detail/type_traits/is_input_iterator.hpp>
+#include <sfl/detail/allocator_traits.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/rb_tree.hpp>
+
+#include <cstddef>          // size_t
+#include <functional>       // equal_to, less
+#include <initializer_list> // initializer_list
+#include <memory>           // allocator
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <utility>          // forward, move, pair
+
+namespace sfl
+{
+
+template < typename Key,
+           typename Compare = std::less<Key>,
+           typename Allocator = std::allocator<Key> >
+class order_statistic_set
+{
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, Key>::value,
+        "Allocator::value_type must be Key."
+    );
+
+public:
+
+    using allocator_type = Allocator;
+    using key_type       = Key;
+    using value_type     = Key;
+    using key_compare    = Compare;
+    using value_compare  = Compare;
+
+private:
+
+    using tree_type = sfl::dtl::rb_tree
+    <
+        key_type,
+        value_type,
+        sfl::dtl::identity,
+        key_compare,
+        typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<value_type>,
+        true
+    >;
+
+    tree_type tree_;
+
+public:
+
+    using size_type              = typename sfl::dtl::allocator_traits<typename tree_type::allocator_type>::size_type;
+    using difference_type        = typename sfl::dtl::allocator_traits<typename tree_type::allocator_type>::difference_type;
+    using reference              = value_type&;
+    using const_reference        = const value_type&;
+    using pointer                = typename sfl::dtl::allocator_traits<typename tree_type::allocator_type>::pointer;
+    using const_pointer          = typename sfl::dtl::allocator_traits<typename tree_type::allocator_type>::const_pointer;
+    using iterator               = typename tree_type::const_iterator; // MUST BE const
+    using const_iterator         = typename tree_type::const_iterator;
+    using reverse_iterator       = typename tree_type::const_reverse_iterator; // MUST BE const
+    using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = sfl::dtl::set_node_handle<Key, allocator_type, typename tree_type::node_handle_node_type>;
+    using insert_return_type     = sfl::dtl::node_insert_return_type<iterator, node_type>;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    order_statistic_set() noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<Compare>::value
+    )
+        : tree_()
+    {}
+
+    explicit order_statistic_set(const Compare& comp) noexcept
+    (
+        std::is_nothrow_default_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<Compare>::value
+    )
+        : tree_(comp)
+    {}
+
+    explicit order_statistic_set(const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_default_constructible<Compare>::value
+    )
+        : tree_(alloc)
+    {}
+
+    explicit order_statistic_set(const Compare& comp, const Allocator& alloc) noexcept
+    (
+        std::is_nothrow_copy_constructible<Allocator>::value &&
+        std::is_nothrow_copy_constructible<Compare>::value
+    )
+        : tree_(comp, alloc)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(InputIt first, InputIt last)
+        : tree_()
+    {
+        insert(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(InputIt first, InputIt last, const Compare& comp)
+        : tree_(comp)
+    {
+        insert(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(InputIt first, InputIt last, const Allocator& alloc)
+        : tree_(alloc)
+    {
+        insert(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(InputIt first, InputIt last, const Compare& comp, const Allocator& alloc)
+        : tree_(comp, alloc)
+    {
+        insert(first, last);
+    }
+
+    order_statistic_set(std::initializer_list<value_type> ilist)
+        : order_statistic_set(ilist.begin(), ilist.end())
+    {}
+
+    order_statistic_set(std::initializer_list<value_type> ilist, const Compare& comp)
+        : order_statistic_set(ilist.begin(), ilist.end(), comp)
+    {}
+
+    order_statistic_set(std::initializer_list<value_type> ilist, const Allocator& alloc)
+        : order_statistic_set(ilist.begin(), ilist.end(), alloc)
+    {}
+
+    order_statistic_set(std::initializer_list<value_type> ilist, const Compare& comp, const Allocator& alloc)
+        : order_statistic_set(ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : tree_()
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : tree_(comp)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : tree_(alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    order_statistic_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp, const Allocator& alloc)
+        : tree_(comp, alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    order_statistic_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : order_statistic_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    order_statistic_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : order_statistic_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    order_statistic_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Allocator& alloc)
+        : order_statistic_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    order_statistic_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp, const Allocator& alloc)
+        : order_statistic_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
+    order_statistic_set(const order_statistic_set& other)
+        : tree_(other.tree_)
+    {}
+
+    order_statistic_set(const order_statistic_set& other, const Allocator& alloc)
+        : tree_(other.tree_, alloc)
+    {}
+
+    order_statistic_set(order_statistic_set&& other)
+        : tree_(std::move(other.tree_))
+    {}
+
+    order_statistic_set(order_statistic_set&& other, const Allocator& alloc)
+        : tree_(std::move(other.tree_), alloc)
+    {}
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    order_statistic_set(sfl::from_range_t, Range&& range)
+        : tree_()
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    order_statistic_set(sfl::from_range_t, Range&& range, const Compare& comp)
+        : tree_(comp)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    order_statistic_set(sfl::from_range_t, Range&& range, const Allocator& alloc)
+        : tree_(alloc)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    order_statistic_set(sfl::from_range_t, Range&& range, const Compare& comp, const Allocator& alloc)
+        : tree_(comp, alloc)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    order_statistic_set(sfl::from_range_t, Range&& range)
+        : tree_()
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <typename Range>
+    order_statistic_set(sfl::from_range_t, Range&& range, const Compare& comp)
+        : tree_(comp)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <typename Range>
+    order_statistic_set(sfl::from_range_t, Range&& range, const Allocator& alloc)
+        : tree_(alloc)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+    template <typename Range>
+    order_statistic_set(sfl::from_range_t, Range&& range, const Compare& comp, const Allocator& alloc)
+        : tree_(comp, alloc)
+    {
+        insert_range(std::forward<Range>(range));
+    }
+
+#endif // before C++20
+
+    ~order_statistic_set()
+    {}
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    order_statistic_set& operator=(const order_statistic_set& other)
+    {
+        tree_.assign_copy(other.tree_);
+        return *this;
+    }
+
+    order_statistic_set& operator=(order_statistic_set&& other)
+    {
+        tree_.assign_move(other.tree_);
+        return *this;
+    }
+
+    order_statistic_set& operator=(std::initializer_list<value_type> ilist)
+    {
+        tree_.assign_range_unique(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const noexcept
+    {
+        return allocator_type(tree_.ref_to_node_alloc());
+    }
+
+    //
+    // ---- KEY COMPARE -------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    key_compare key_comp() const
+    {
+        return key_compare(tree_.ref_to_key_compare());
+    }
+
+    //
+    // ---- VALUE COMPARE -----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    value_compare value_comp() const
+    {
+        return value_compare(tree_.ref_to_key_compare());
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return tree_.begin();
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return tree_.begin();
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return tree_.cbegin();
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return tree_.end();
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return tree_.end();
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return tree_.cend();
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return tree_.rbegin();
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return tree_.rbegin();
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return tree_.crbegin();
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return tree_.rend();
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return tree_.rend();
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return tree_.crend();
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return tree_.nth(pos);
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return tree_.nth(pos);
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        return tree_.index_of(pos);
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return tree_.empty();
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return tree_.size();
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return tree_.max_size();
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear()
+    {
+        tree_.clear();
+    }
+
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(Args&&... args)
+    {
+        return tree_.emplace_unique(std::forward<Args>(args)...);
+    }
+
+    template <typename... Args>
+    iterator emplace_hint(const_iterator hint, Args&&... args)
+    {
+        return tree_.emplace_hint_unique(hint, std::forward<Args>(args)...);
+    }
+
+    std::pair<iterator, bool> insert(const value_type& value)
+    {
+        return tree_.insert_unique(value);
+    }
+
+    std::pair<iterator, bool> insert(value_type&& value)
+    {
+        return tree_.insert_unique(std::move(value));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    std::pair<iterator, bool> insert(K&& x)
+    {
+        return tree_.insert_unique(std::forward<K>(x));
+    }
+
+    iterator insert(const_iterator hint, const value_type& value)
+    {
+        return tree_.insert_hint_unique(hint, value);
+    }
+
+    iterator insert(const_iterator hint, value_type&& value)
+    {
+        return tree_.insert_hint_unique(hint, std::move(value));
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                    !std::is_convertible<K&&, const_iterator>::value &&
+                                    !std::is_convertible<K&&, iterator>::value >* = nullptr>
+    iterator insert(const_iterator hint, K&& x)
+    {
+        return tree_.insert_hint_unique(hint, std::forward<K>(x));
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(InputIt first, InputIt last)
+    {
+        insert_range_aux(first, last);
+    }
+
+    void insert(std::initializer_list<value_type> ilist)
+    {
+        insert_range_aux(ilist.begin(), ilist.end());
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
+    insert_return_type insert(node_type&& nh)
+    {
+        return tree_.template insert_node_handle_unique<insert_return_type>(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_handle_hint_unique(hint, std::move(nh));
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(Range&& range)
+    {
+        insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    void insert_range(Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_aux(begin(range), end(range));
+    }
+
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
+#endif // before C++20
+
+    iterator erase(const_iterator pos)
+    {
+        return tree_.erase(pos);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        return tree_.erase(first, last);
+    }
+
+    size_type erase(const Key& key)
+    {
+        return tree_.erase_key_unique(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    size_type erase(K&& x)
+    {
+        return tree_.erase_key_unique(x);
+    }
+
+    void swap(order_statistic_set& other)
+    {
+        tree_.swap(other.tree_);
+    }
+
+    node_type extract(const_iterator pos)
+    {
+        return tree_.template extract<node_type>(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.template extract_key<node_type>(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     !std::is_convertible<K&&, const_iterator>::value &&
+                                     !std::is_convertible<K&&, iterator>::value >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.template extract_key<node_type>(x);
+    }
+
+    template <typename Compare2>
+    void merge(order_statistic_set<Key, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(order_statistic_set<Key, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator lower_bound(const Key& key)
+    {
+        return tree_.lower_bound(key);
+    }
+
+    SFL_NODISCARD
+    const_iterator lower_bound(const Key& key) const
+    {
+        return tree_.lower_bound(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator lower_bound(const K& x)
+    {
+        return tree_.lower_bound(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator lower_bound(const K& x) const
+    {
+        return tree_.lower_bound(x);
+    }
+
+    SFL_NODISCARD
+    iterator upper_bound(const Key& key)
+    {
+        return tree_.upper_bound(key);
+    }
+
+    SFL_NODISCARD
+    const_iterator upper_bound(const Key& key) const
+    {
+        return tree_.upper_bound(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator upper_bound(const K& x)
+    {
+        return tree_.upper_bound(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator upper_bound(const K& x) const
+    {
+        return tree_.upper_bound(x);
+    }
+
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const Key& key)
+    {
+        return tree_.equal_range(key);
+    }
+
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const Key& key) const
+    {
+        return tree_.equal_range(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<iterator, iterator> equal_range(const K& x)
+    {
+        return tree_.equal_range(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    std::pair<const_iterator, const_iterator> equal_range(const K& x) const
+    {
+        return tree_.equal_range(x);
+    }
+
+    SFL_NODISCARD
+    iterator find(const Key& key)
+    {
+        return tree_.find(key);
+    }
+
+    SFL_NODISCARD
+    const_iterator find(const Key& key) const
+    {
+        return tree_.find(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    iterator find(const K& x)
+    {
+        return tree_.find(x);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    const_iterator find(const K& x) const
+    {
+        return tree_.find(x);
+    }
+
+    SFL_NODISCARD
+    size_type count(const Key& key) const
+    {
+        return tree_.count_unique(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type count(const K& x) const
+    {
+        return tree_.count_unique(x);
+    }
+
+    SFL_NODISCARD
+    bool contains(const Key& key) const
+    {
+        return tree_.contains(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    bool contains(const K& x) const
+    {
+        return tree_.contains(x);
+    }
+
+    SFL_NODISCARD
+    size_type order_of_key(const Key& key) const
+    {
+        return tree_.order_of_key(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t<sfl::dtl::has_is_transparent<Compare, K>::value>* = nullptr>
+    SFL_NODISCARD
+    size_type order_of_key(const K& x) const
+    {
+        return tree_.order_of_key(x);
+    }
+
+private:
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_aux(InputIt first, Sentinel last)
+    {
+        tree_.insert_range_unique(std::move(first), std::move(last));
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        tree_.insert_range_sorted_unique(std::move(first), std::move(last));
+    }
+
+    template <typename, typename, typename>
+    friend class order_statistic_set;
+
+    template <typename K2, typename C2, typename A2>
+    friend bool operator==(const order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend bool operator!=(const order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend bool operator<(const order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend bool operator>(const order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend bool operator<=(const order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend bool operator>=(const order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend typename order_statistic_set<K2, C2, A2>::size_type set_union_into(order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend typename order_statistic_set<K2, C2, A2>::size_type set_intersection_into(order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend typename order_statistic_set<K2, C2, A2>::size_type set_difference_into(order_statistic_set<K2, C2, A2>& x, const order_statistic_set<K2, C2, A2>& y);
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename K, typename C, typename A>
+SFL_NODISCARD
+bool operator==
+(
+    const order_statistic_set<K, C, A>& x,
+    const order_statistic_set<K, C, A>& y
+)
+{
+    return x.tree_ == y.tree_;
+}
+
+template <typename K, typename C, typename A>
+SFL_NODISCARD
+bool operator!=
+(
+    const order_statistic_set<K, C, A>& x,
+    const order_statistic_set<K, C, A>& y
+)
+{
+    return x.tree_ != y.tree_;
+}
+
+template <typename K, typename C, typename A>
+SFL_NODISCARD
+bool operator<
+(
+    const order_statistic_set<K, C, A>& x,
+    const order_statistic_set<K, C, A>& y
+)
+{
+    return x.tree_ < y.tree_;
+}
+
+template <typename K, typename C, typename A>
+SFL_NODISCARD
+bool operator>
+(
+    const order_statistic_set<K, C, A>& x,
+    const order_statistic_set<K, C, A>& y
+)
+{
+    return x.tree_ > y.tree_;
+}
+
+template <typename K, typename C, typename A>
+SFL_NODISCARD
+bool operator<=
+(
+    const order_statistic_set<K, C, A>& x,
+    const order_statistic_set<K, C, A>& y
+)
+{
+    return x.tree_ <= y.tree_;
+}
+
+template <typename K, typename C, typename A>
+SFL_NODISCARD
+bool operator>=
+(
+    const order_statistic_set<K, C, A>& x,
+    const order_statistic_set<K, C, A>& y
+)
+{
+    return x.tree_ >= y.tree_;
+}
+
+template <typename K, typename C, typename A>
+void swap
+(
+    order_statistic_set<K, C, A>& x,
+    order_statistic_set<K, C, A>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename K, typename C, typename A, typename Predicate>
+typename order_statistic_set<K, C, A>::size_type
+    erase_if(order_statistic_set<K, C, A>& c, Predicate pred)
+{
+    auto old_size = c.size();
+
+    for (auto it = c.begin(); it != c.end(); )
+    {
+        if (pred(*it))
+        {
+            it = c.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    return old_size - c.size();
+}
+
+template <typename K, typename C, typename A>
+typename order_statistic_set<K, C, A>::size_type
+    set_union_into(order_statistic_set<K, C, A>& x, const order_statistic_set<K, C, A>& y)
+{
+    return x.tree_.union_unique(y.tree_);
+}
+
+template <typename K, typename C, typename A>
+typename order_statistic_set<K, C, A>::size_type
+    set_intersection_into(order_statistic_set<K, C, A>& x, const order_statistic_set<K, C, A>& y)
+{
+    return x.tree_.intersection_unique(y.tree_);
+}
+
+template <typename K, typename C, typename A>
+typename order_statistic_set<K, C, A>::size_type
+    set_difference_into(order_statistic_set<K, C, A>& x, const order_statistic_set<K, C, A>& y)
+{
+    return x.tree_.difference_unique(y.tree_);
+}
+
+} // namespace sfl
+
+#endif // SFL_ORDER_STATISTIC_SET_HPP_INCLUDED
@@ -0,0 +1,282 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_SEGMENTED_ALGORITHM_HPP_INCLUDED
+#define SFL_SEGMENTED_ALGORITHM_HPP_INCLUDED
+
+#include <sfl/detail/algorithm/find_if.hpp>
+#include <sfl/detail/algorithm/for_each_segment.hpp>
+#include <sfl/detail/type_traits/segment_local_iterator_t.hpp>
+#include <sfl/detail/cpp.hpp>
+
+#include <algorithm>    // count, count_if, transform
+#include <iterator>     // iterator_traits
+#include <numeric>      // accumulate
+#include <utility>      // move
+
+namespace sfl
+{
+
+//
+// Algorithms in this namespace accept any iterators. If iterators are
+// segmented iterators (iterators of `segmented_vector` and
+// `segmented_devector`), the range is processed segment by segment and the
+// inner loop runs over contiguous memory, so it does not pay for two-level
+// iterator increment and can be vectorized by compiler.
+//
+namespace segmented
+{
+
+//
+// Type of iterators passed to the function called by `for_each_segment`.
+//
+template <typename ForwardIt>
+using local_iterator_t = sfl::dtl::segment_local_iterator_t<ForwardIt>;
+
+//
+// Calls `f(local_first, local_last)` for each contiguous part of the range
+// [first, last), in order. If iterators are segmented iterators then
+// `local_first` and `local_last` are raw pointers into one segment, otherwise
+// `f` is called exactly once with `first` and `last`.
+//
+template <typename ForwardIt, typename Function>
+Function for_each_segment(ForwardIt first, ForwardIt last, Function f)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt>;
+
+    sfl::dtl::for_each_segment
+    (
+        first,
+        last,
+        [&f](local_iterator local_first, local_iterator local_last)
+        {
+            f(local_first, local_last);
+        }
+    );
+
+    return f;
+}
+
+template <typename ForwardIt, typename UnaryFunction>
+UnaryFunction for_each(ForwardIt first, ForwardIt last, UnaryFunction f)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt>;
+
+    sfl::dtl::for_each_segment
+    (
+        first,
+        last,
+        [&f](local_iterator local_first, local_iterator local_last)
+        {
+            for (; local_first != local_last; ++local_first)
+            {
+                f(*local_first);
+            }
+        }
+    );
+
+    return f;
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+SFL_NODISCARD
+ForwardIt find_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return sfl::dtl::find_if(first, last, pred);
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+SFL_NODISCARD
+ForwardIt find_if_not(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    using reference = typename std::iterator_traits<ForwardIt>::reference;
+
+    return sfl::dtl::find_if
+    (
+        first,
+        last,
+        [&pred](reference x) { return !pred(x); }
+    );
+}
+
+template <typename ForwardIt, typename T>
+SFL_NODISCARD
+ForwardIt find(ForwardIt first, ForwardIt last, const T& value)
+{
+    using reference = typename std::iterator_traits<ForwardIt>::reference;
+
+    return sfl::dtl::find_if
+    (
+        first,
+        last,
+        [&value](reference x) { return x == value; }
+    );
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+SFL_NODISCARD
+bool all_of(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return sfl::segmented::find_if_not(first, last, pred) == last;
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+SFL_NODISCARD
+bool any_of(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return sfl::segmented::find_if(first, last, pred) != last;
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+SFL_NODISCARD
+bool none_of(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    return sfl::segmented::find_if(first, last, pred) == last;
+}
+
+template <typename ForwardIt, typename T>
+SFL_NODISCARD
+typename std::iterator_traits<ForwardIt>::difference_type
+    count(ForwardIt first, ForwardIt last, const T& value)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt>;
+
+    typename std::iterator_traits<ForwardIt>::difference_type result = 0;
+
+    sfl::dtl::for_each_segment
+    (
+        first,
+        last,
+        [&result, &value](local_iterator local_first, local_iterator local_last)
+        {
+            result += std::count(local_first, local_last, value);
+        }
+    );
+
+    return result;
+}
+
+template <typename ForwardIt, typename UnaryPredicate>
+SFL_NODISCARD
+typename std::iterator_traits<ForwardIt>::difference_type
+    count_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt>;
+
+    typename std::iterator_traits<ForwardIt>::difference_type result = 0;
+
+    sfl::dtl::for_each_segment
+    (
+        first,
+        last,
+        [&result, &pred](local_iterator local_first, local_iterator local_last)
+        {
+            result += std::count_if(local_first, local_last, pred);
+        }
+    );
+
+    return result;
+}
+
+template <typename ForwardIt, typename T>
+SFL_NODISCARD
+T accumulate(ForwardIt first, ForwardIt last, T init)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt>;
+
+    sfl::dtl::for_each_segment
+    (
+        first,
+        last,
+        [&init](local_iterator local_first, local_iterator local_last)
+        {
+            init = std::accumulate(local_first, local_last, std::move(init));
+        }
+    );
+
+    return init;
+}
+
+template <typename ForwardIt, typename T, typename BinaryOperation>
+SFL_NODISCARD
+T accumulate(ForwardIt first, ForwardIt last, T init, BinaryOperation op)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt>;
+
+    sfl::dtl::for_each_segment
+    (
+        first,
+        last,
+        [&init, &op](local_iterator local_first, local_iterator local_last)
+        {
+            init = std::accumulate(local_first, local_last, std::move(init), op);
+        }
+    );
+
+    return init;
+}
+
+template <typename ForwardIt, typename OutputIt, typename UnaryOperation>
+OutputIt transform(ForwardIt first, ForwardIt last, OutputIt d_first, UnaryOperation op)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt>;
+
+    sfl::dtl::for_each_segment
+    (
+        first,
+        last,
+        [&d_first, &op](local_iterator local_first, local_iterator local_last)
+        {
+            d_first = std::transform(local_first, local_last, d_first, op);
+        }
+    );
+
+    return d_first;
+}
+
+template <typename ForwardIt1, typename InputIt2>
+SFL_NODISCARD
+bool equal(ForwardIt1 first1, ForwardIt1 last1, InputIt2 first2)
+{
+    using local_iterator = sfl::segmented::local_iterator_t<ForwardIt1>;
+
+    bool result = true;
+
+    sfl::dtl::for_each_segment
+    (
+        first1,
+        last1,
+        [&result, &first2](local_iterator local_first, local_iterator local_last)
+        {
+            for (; result && local_first != local_last; ++local_first, ++first2)
+            {
+                result = bool(*local_first == *first2);
+            }
+        }
+    );
+
+    return result;
+}
+
+} // namespace segmented
+
+} // namespace sfl
+
+#endif // SFL_SEGMENTED_ALGORITHM_HPP_INCLUDED
@@ -46,7 +46,7 @@
 #include <sfl/detail/exceptions.hpp>
 #include <sfl/detail/segmented_iterator.hpp>
 
-#include <algorithm>        // copy, move, swap, swap_ranges
+#include <algorithm>        // copy, move, rotate, swap, swap_ranges
 #include <cstddef>          // size_t
 #include <initializer_list> // initializer_list
 #include <iterator>         // distance, next, reverse_iterator
@@ -630,7 +630,10 @@ public:
         {
             if (data_.first_ == data_.bos_)
             {
-                grow_storage_front(1);
+                if (reuse_back_segments(1) == 0)
+                {
+                    grow_storage_front(1);
+                }
                 p1 = nth(dist_to_begin);
             }
 
@@ -686,7 +689,10 @@ public:
         {
             if (data_.last_ == data_.eos_)
             {
-                grow_storage_back(1);
+                if (reuse_front_segments(1) == 0)
+                {
+                    grow_storage_back(1);
+                }
                 p1 = nth(dist_to_begin);
             }
 
@@ -803,7 +809,10 @@ public:
     {
         if (data_.first_ == data_.bos_)
         {
-            grow_storage_front(1);
+            if (reuse_back_segments(1) == 0)
+            {
+                grow_storage_front(1);
+            }
         }
 
         const iterator new_first = --iterator(data_.first_);
@@ -825,7 +834,10 @@ public:
     {
         if (data_.last_ == data_.eos_)
         {
-            grow_storage_back(1);
+            if (reuse_front_segments(1) == 0)
+            {
+                grow_storage_back(1);
+            }
         }
 
         const iterator old_last = data_.last_;
@@ -1459,6 +1471,83 @@ private:
         );
     }
 
+    // Moves up to `n` unused segments from the front of table to the back of
+    // table, so that capacity at the back grows without memory allocation.
+    // Queue-like usage (push_back and pop_front) keeps reusing the same
+    // segments instead of allocating a new segment and keeping an old one
+    // whenever the back crosses segment boundary.
+    // Returns the number of moved segments.
+    //
+    size_type reuse_front_segments(size_type n) noexcept
+    {
+        n = std::min<size_type>(n, std::distance(data_.table_first_, data_.first_.segment_));
+
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        if (size_type(std::distance(data_.table_last_, data_.table_eos_)) >= n)
+        {
+            sfl::dtl::copy(data_.table_first_, data_.table_first_ + n, data_.table_last_);
+
+            data_.table_first_ += n;
+            data_.table_last_  += n;
+        }
+        else
+        {
+            std::rotate(data_.table_first_, data_.table_first_ + n, data_.table_last_);
+
+            data_.first_.segment_ -= n;
+            data_.last_.segment_  -= n;
+        }
+
+        data_.bos_.segment_ =  data_.table_first_;
+        data_.bos_.local_   = *data_.table_first_;
+
+        data_.eos_.segment_ =  (data_.table_last_ - 1);
+        data_.eos_.local_   = *(data_.table_last_ - 1) + (N - 1);
+
+        return n;
+    }
+
+    // Moves up to `n` unused segments from the back of table to the front of
+    // table, so that capacity at the front grows without memory allocation.
+    // Returns the number of moved segments.
+    //
+    size_type reuse_back_segments(size_type n) noexcept
+    {
+        n = std::min<size_type>(n, std::distance(data_.last_.segment_ + 1, data_.table_last_));
+
+        if (n == 0)
+        {
+            return 0;
+        }
+
+        if (size_type(std::distance(data_.table_bos_, data_.table_first_)) >= n)
+        {
+            sfl::dtl::copy_backward(data_.table_last_ - n, data_.table_last_, data_.table_first_);
+
+            data_.table_first_ -= n;
+            data_.table_last_  -= n;
+        }
+        else
+        {
+            std::rotate(data_.table_first_, data_.table_last_ - n, data_.table_last_);
+
+            data_.first_.segment_ += n;
+            data_.last_.segment_  += n;
+        }
+
+        data_.bos_.segment_ =  data_.table_first_;
+        data_.bos_.local_   = *data_.table_first_;
+
+        data_.eos_.segment_ =  (data_.table_last_ - 1);
+        data_.eos_.local_   = *(data_.table_last_ - 1) + (N - 1);
+
+        return n;
+    }
+
     // Increases capacity at the front for given number of elements.
     // It does not construct any element.
     // It only allocates memory.
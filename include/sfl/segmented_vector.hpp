@@ -938,14 +938,14 @@ public:
 
 private:
 
-    // Allocates table for given number of elements (segments).
+    // Allocates table for at least given number of elements (segments).
     // It does not construct any element (segment).
     // It only allocates memory for table.
     //
-    segment_pointer allocate_table(size_type n)
+    sfl::dtl::allocation_result<segment_pointer, size_type> allocate_table(size_type n)
     {
         segment_allocator seg_alloc(data_.ref_to_alloc());
-        return sfl::dtl::allocate(seg_alloc, n);
+        return sfl::dtl::allocate_at_least(seg_alloc, n);
     }
 
     // Deallocates table.
@@ -1035,9 +1035,11 @@ private:
         const size_type table_capacity =
             std::max(table_required, min_table_capacity());
 
-        data_.table_first_ = allocate_table(table_capacity);
+        const auto table = allocate_table(table_capacity);
+
+        data_.table_first_ = table.ptr;
         data_.table_last_  = data_.table_first_ + table_required;
-        data_.table_eos_   = data_.table_first_ + table_capacity;
+        data_.table_eos_   = data_.table_first_ + table.count;
 
         SFL_TRY
         {
@@ -1053,7 +1055,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            deallocate_table(data_.table_first_, table_capacity);
+            deallocate_table(data_.table_first_, table.count);
             SFL_RETHROW;
         }
     }
@@ -1117,11 +1119,12 @@ private:
                 std::distance(data_.first_.segment_, data_.eos_.segment_);
 
             // Allocate new table. No effects if allocation fails.
-            const segment_pointer new_table_first =
-                allocate_table(new_table_capacity);
+            const auto new_table = allocate_table(new_table_capacity);
+
+            const segment_pointer new_table_first = new_table.ptr;
 
             const segment_pointer new_table_eos =
-                new_table_first + new_table_capacity;
+                new_table_first + new_table.count;
 
             // Initialize LAST element in new table (noexecept).
             const segment_pointer new_table_last = sfl::dtl::copy
@@ -1193,11 +1196,12 @@ private:
                 std::distance(data_.first_.segment_, data_.last_.segment_);
 
             // Allocate new table. No effects if allocation fails.
-            const segment_pointer new_table_first =
-                allocate_table(new_table_capacity);
+            const auto new_table = allocate_table(new_table_capacity);
+
+            const segment_pointer new_table_first = new_table.ptr;
 
             const segment_pointer new_table_eos =
-                new_table_first + new_table_capacity;
+                new_table_first + new_table.count;
 
             // Initialize LAST element in new table (noexecept).
             const segment_pointer new_table_last = sfl::dtl::copy
@@ -24,6 +24,7 @@
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/functional/identity.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_unique_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -41,6 +42,9 @@
 namespace sfl
 {
 
+template <typename Key, typename Compare, typename Allocator>
+class multiset;
+
 template < typename Key,
            typename Compare = std::less<Key>,
            typename Allocator = std::allocator<Key> >
@@ -85,6 +89,8 @@ public:
     using const_iterator         = typename tree_type::const_iterator;
     using reverse_iterator       = typename tree_type::const_reverse_iterator; // MUST BE const
     using const_reverse_iterator = typename tree_type::const_reverse_iterator;
+    using node_type              = sfl::dtl::set_node_handle<Key, allocator_type, typename tree_type::node_handle_node_type>;
+    using insert_return_type     = sfl::dtl::node_insert_return_type<iterator, node_type>;
 
 public:
 
@@ -172,6 +178,54 @@ public:
         : set(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    set(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : tree_()
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : tree_(comp)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    set(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : tree_(alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp, const Allocator& alloc)
+        : tree_(comp, alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : set(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Allocator& alloc)
+        : set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp, const Allocator& alloc)
+        : set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     set(const set& other)
         : tree_(other.tree_)
     {}
@@ -472,6 +526,28 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
+    insert_return_type insert(node_type&& nh)
+    {
+        return tree_.template insert_node_handle_unique<insert_return_type>(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return tree_.insert_node_handle_hint_unique(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -480,6 +556,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -490,6 +572,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
 #endif // before C++20
 
     iterator erase(const_iterator pos)
@@ -519,6 +609,49 @@ public:
         tree_.swap(other.tree_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return tree_.template extract<node_type>(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return tree_.template extract_key<node_type>(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Compare, K>::value &&
+                                     !std::is_convertible<K&&, const_iterator>::value &&
+                                     !std::is_convertible<K&&, iterator>::value >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return tree_.template extract_key<node_type>(x);
+    }
+
+    template <typename Compare2>
+    void merge(set<Key, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(set<Key, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multiset<Key, Compare2, Allocator>& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
+    template <typename Compare2>
+    void merge(multiset<Key, Compare2, Allocator>&& source)
+    {
+        tree_.merge_unique(source.tree_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -668,13 +801,21 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(std::move(first), std::move(last));
     }
 
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        tree_.insert_range_sorted_unique(std::move(first), std::move(last));
+    }
+
+    template <typename, typename, typename>
+    friend class set;
+
+    template <typename, typename, typename>
+    friend class multiset;
+
     template <typename K2, typename C2, typename A2>
     friend bool operator==(const set<K2, C2, A2>& x, const set<K2, C2, A2>& y);
 
@@ -692,6 +833,15 @@ private:
 
     template <typename K2, typename C2, typename A2>
     friend bool operator>=(const set<K2, C2, A2>& x, const set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend typename set<K2, C2, A2>::size_type set_union_into(set<K2, C2, A2>& x, const set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend typename set<K2, C2, A2>::size_type set_intersection_into(set<K2, C2, A2>& x, const set<K2, C2, A2>& y);
+
+    template <typename K2, typename C2, typename A2>
+    friend typename set<K2, C2, A2>::size_type set_difference_into(set<K2, C2, A2>& x, const set<K2, C2, A2>& y);
 };
 
 //
@@ -795,6 +945,27 @@ typename set<K, C, A>::size_type
     return old_size - c.size();
 }
 
+template <typename K, typename C, typename A>
+typename set<K, C, A>::size_type
+    set_union_into(set<K, C, A>& x, const set<K, C, A>& y)
+{
+    return x.tree_.union_unique(y.tree_);
+}
+
+template <typename K, typename C, typename A>
+typename set<K, C, A>::size_type
+    set_intersection_into(set<K, C, A>& x, const set<K, C, A>& y)
+{
+    return x.tree_.intersection_unique(y.tree_);
+}
+
+template <typename K, typename C, typename A>
+typename set<K, C, A>::size_type
+    set_difference_into(set<K, C, A>& x, const set<K, C, A>& y)
+{
+    return x.tree_.difference_unique(y.tree_);
+}
+
 } // namespace sfl
 
 #endif // SFL_SET_HPP_INCLUDED
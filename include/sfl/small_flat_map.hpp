@@ -24,6 +24,7 @@
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/functional/first.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_unique_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -197,6 +198,54 @@ public:
         : small_flat_map(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : impl_()
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : impl_(comp)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : impl_(alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_flat_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp, const Allocator& alloc)
+        : impl_(comp, alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Allocator& alloc)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_flat_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp, const Allocator& alloc)
+        : small_flat_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     small_flat_map(const small_flat_map& other)
         : impl_(other.impl_)
     {}
@@ -542,6 +591,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -550,6 +611,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -560,6 +627,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
 #endif // before C++20
 
     template <typename M,
@@ -940,11 +1015,13 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        impl_.insert_range_unique(std::move(first), std::move(last));
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        impl_.insert_range_sorted_unique(std::move(first), std::move(last));
     }
 
     template <typename K2, typename T2, std::size_t N2, typename C2, typename A2>
@@ -964,6 +1041,15 @@ private:
 
     template <typename K2, typename T2, std::size_t N2, typename C2, typename A2>
     friend bool operator>=(const small_flat_map<K2, T2, N2, C2, A2>& x, const small_flat_map<K2, T2, N2, C2, A2>& y);
+
+    template <typename K2, typename T2, std::size_t N2, typename C2, typename A2>
+    friend typename small_flat_map<K2, T2, N2, C2, A2>::size_type set_union_into(small_flat_map<K2, T2, N2, C2, A2>& x, const small_flat_map<K2, T2, N2, C2, A2>& y);
+
+    template <typename K2, typename T2, std::size_t N2, typename C2, typename A2>
+    friend typename small_flat_map<K2, T2, N2, C2, A2>::size_type set_intersection_into(small_flat_map<K2, T2, N2, C2, A2>& x, const small_flat_map<K2, T2, N2, C2, A2>& y);
+
+    template <typename K2, typename T2, std::size_t N2, typename C2, typename A2>
+    friend typename small_flat_map<K2, T2, N2, C2, A2>::size_type set_difference_into(small_flat_map<K2, T2, N2, C2, A2>& x, const small_flat_map<K2, T2, N2, C2, A2>& y);
 };
 
 //
@@ -1067,6 +1153,27 @@ typename small_flat_map<K, T, N, C, A>::size_type
     return old_size - c.size();
 }
 
+template <typename K, typename T, std::size_t N, typename C, typename A>
+typename small_flat_map<K, T, N, C, A>::size_type
+    set_union_into(small_flat_map<K, T, N, C, A>& x, const small_flat_map<K, T, N, C, A>& y)
+{
+    return x.impl_.union_unique(y.impl_);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+typename small_flat_map<K, T, N, C, A>::size_type
+    set_intersection_into(small_flat_map<K, T, N, C, A>& x, const small_flat_map<K, T, N, C, A>& y)
+{
+    return x.impl_.intersection_unique(y.impl_);
+}
+
+template <typename K, typename T, std::size_t N, typename C, typename A>
+typename small_flat_map<K, T, N, C, A>::size_type
+    set_difference_into(small_flat_map<K, T, N, C, A>& x, const small_flat_map<K, T, N, C, A>& y)
+{
+    return x.impl_.difference_unique(y.impl_);
+}
+
 } // namespace sfl
 
 #endif // SFL_SMALL_FLAT_MAP_HPP_INCLUDED
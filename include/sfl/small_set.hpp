@@ -24,6 +24,7 @@
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/functional/identity.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_unique_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -183,6 +184,54 @@ public:
         : small_set(ilist.begin(), ilist.end(), comp, alloc)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_set(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : tree_()
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : tree_(comp)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Allocator& alloc)
+        : tree_(alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    small_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp, const Allocator& alloc)
+        : tree_(comp, alloc)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    small_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : small_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    small_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : small_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
+    small_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Allocator& alloc)
+        : small_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), alloc)
+    {}
+
+    small_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp, const Allocator& alloc)
+        : small_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp, alloc)
+    {}
+
     small_set(const small_set& other)
         : tree_(other.tree_)
     {}
@@ -483,6 +532,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -491,6 +552,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -501,6 +568,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
 #endif // before C++20
 
     iterator erase(const_iterator pos)
@@ -679,11 +754,13 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(std::move(first), std::move(last));
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        tree_.insert_range_sorted_unique(std::move(first), std::move(last));
     }
 
     template <typename K2, std::size_t N2, typename C2, typename A2>
@@ -703,6 +780,15 @@ private:
 
     template <typename K2, std::size_t N2, typename C2, typename A2>
     friend bool operator>=(const small_set<K2, N2, C2, A2>& x, const small_set<K2, N2, C2, A2>& y);
+
+    template <typename K2, std::size_t N2, typename C2, typename A2>
+    friend typename small_set<K2, N2, C2, A2>::size_type set_union_into(small_set<K2, N2, C2, A2>& x, const small_set<K2, N2, C2, A2>& y);
+
+    template <typename K2, std::size_t N2, typename C2, typename A2>
+    friend typename small_set<K2, N2, C2, A2>::size_type set_intersection_into(small_set<K2, N2, C2, A2>& x, const small_set<K2, N2, C2, A2>& y);
+
+    template <typename K2, std::size_t N2, typename C2, typename A2>
+    friend typename small_set<K2, N2, C2, A2>::size_type set_difference_into(small_set<K2, N2, C2, A2>& x, const small_set<K2, N2, C2, A2>& y);
 };
 
 //
@@ -806,6 +892,27 @@ typename small_set<K, N, C, A>::size_type
     return old_size - c.size();
 }
 
+template <typename K, std::size_t N, typename C, typename A>
+typename small_set<K, N, C, A>::size_type
+    set_union_into(small_set<K, N, C, A>& x, const small_set<K, N, C, A>& y)
+{
+    return x.tree_.union_unique(y.tree_);
+}
+
+template <typename K, std::size_t N, typename C, typename A>
+typename small_set<K, N, C, A>::size_type
+    set_intersection_into(small_set<K, N, C, A>& x, const small_set<K, N, C, A>& y)
+{
+    return x.tree_.intersection_unique(y.tree_);
+}
+
+template <typename K, std::size_t N, typename C, typename A>
+typename small_set<K, N, C, A>::size_type
+    set_difference_into(small_set<K, N, C, A>& x, const small_set<K, N, C, A>& y)
+{
+    return x.tree_.difference_unique(y.tree_);
+}
+
 } // namespace sfl
 
 #endif // SFL_SMALL_SET_HPP_INCLUDED
@@ -27,16 +27,19 @@
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
+#include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/linear_fingerprints.hpp>
 #include <sfl/detail/unordered_associative_vector.hpp>
 #include <sfl/small_vector.hpp>
 
 #include <cstddef>          // size_t
+#include <cstdint>          // uint8_t
 #include <functional>       // equal_to
 #include <initializer_list> // initializer_list
 #include <memory>           // allocator
-#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <type_traits>      // conditional, is_same, is_void, is_nothrow_xxxxx
 #include <utility>          // forward, move, pair
 
 namespace sfl
@@ -45,7 +48,8 @@ namespace sfl
 template < typename Key,
            std::size_t N,
            typename KeyEqual = std::equal_to<Key>,
-           typename Allocator = std::allocator<Key> >
+           typename Allocator = std::allocator<Key>,
+           typename Hash = void >
 class small_unordered_linear_set
 {
     static_assert
@@ -63,13 +67,21 @@ public:
 
 private:
 
+    using fingerprints = typename std::conditional
+    <
+        std::is_void<Hash>::value,
+        sfl::dtl::no_linear_fingerprints,
+        sfl::dtl::linear_fingerprints<Hash, sfl::small_vector<std::uint8_t, N, typename sfl::dtl::allocator_traits<Allocator>::template rebind_alloc<std::uint8_t>>>
+    >::type;
+
     using unordered_associative_vector = sfl::dtl::unordered_associative_vector
     <
         key_type,
         value_type,
         sfl::dtl::identity,
         key_equal,
-        sfl::small_vector<value_type, N, allocator_type>
+        sfl::small_vector<value_type, N, allocator_type>,
+        fingerprints
     >;
 
     unordered_associative_vector impl_;
@@ -613,52 +625,52 @@ private:
         }
     }
 
-    template <typename K2, std::size_t N2, typename E2, typename A2>
-    friend bool operator==(const small_unordered_linear_set<K2, N2, E2, A2>& x, const small_unordered_linear_set<K2, N2, E2, A2>& y);
+    template <typename K2, std::size_t N2, typename E2, typename A2, typename H2>
+    friend bool operator==(const small_unordered_linear_set<K2, N2, E2, A2, H2>& x, const small_unordered_linear_set<K2, N2, E2, A2, H2>& y);
 
-    template <typename K2, std::size_t N2, typename E2, typename A2>
-    friend bool operator!=(const small_unordered_linear_set<K2, N2, E2, A2>& x, const small_unordered_linear_set<K2, N2, E2, A2>& y);
+    template <typename K2, std::size_t N2, typename E2, typename A2, typename H2>
+    friend bool operator!=(const small_unordered_linear_set<K2, N2, E2, A2, H2>& x, const small_unordered_linear_set<K2, N2, E2, A2, H2>& y);
 };
 
 //
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, std::size_t N, typename E, typename A>
+template <typename K, std::size_t N, typename E, typename A, typename H>
 SFL_NODISCARD
 bool operator==
 (
-    const small_unordered_linear_set<K, N, E, A>& x,
-    const small_unordered_linear_set<K, N, E, A>& y
+    const small_unordered_linear_set<K, N, E, A, H>& x,
+    const small_unordered_linear_set<K, N, E, A, H>& y
 )
 {
     return x.impl_ == y.impl_;
 }
 
-template <typename K, std::size_t N, typename E, typename A>
+template <typename K, std::size_t N, typename E, typename A, typename H>
 SFL_NODISCARD
 bool operator!=
 (
-    const small_unordered_linear_set<K, N, E, A>& x,
-    const small_unordered_linear_set<K, N, E, A>& y
+    const small_unordered_linear_set<K, N, E, A, H>& x,
+    const small_unordered_linear_set<K, N, E, A, H>& y
 )
 {
     return x.impl_ != y.impl_;
 }
 
-template <typename K, std::size_t N, typename E, typename A>
+template <typename K, std::size_t N, typename E, typename A, typename H>
 void swap
 (
-    small_unordered_linear_set<K, N, E, A>& x,
-    small_unordered_linear_set<K, N, E, A>& y
+    small_unordered_linear_set<K, N, E, A, H>& x,
+    small_unordered_linear_set<K, N, E, A, H>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, std::size_t N, typename E, typename A, typename Predicate>
-typename small_unordered_linear_set<K, N, E, A>::size_type
-    erase_if(small_unordered_linear_set<K, N, E, A>& c, Predicate pred)
+template <typename K, std::size_t N, typename E, typename A, typename H, typename Predicate>
+typename small_unordered_linear_set<K, N, E, A, H>::size_type
+    erase_if(small_unordered_linear_set<K, N, E, A, H>& c, Predicate pred)
 {
     auto old_size = c.size();
 
@@ -53,7 +53,8 @@ template < typename Key,
            std::size_t StaticBucketCount = StaticCapacity == 0 ? 0 : sfl::dtl::bit_ceil(StaticCapacity),
            typename Hash = std::hash<Key>,
            typename KeyEqual = std::equal_to<Key>,
-           typename Allocator = std::allocator<std::pair<const Key, T>> >
+           typename Allocator = std::allocator<std::pair<const Key, T>>,
+           bool StoreHash = false >
 class small_unordered_multimap
 {
     static_assert
@@ -110,7 +111,9 @@ private:
         node_allocator_type,
         bucket_allocator_type,
         bucket_count_policy,
-        max_load_policy
+        max_load_policy,
+        StoreHash,
+        false
     >;
 
     hash_table hash_table_;
@@ -729,6 +732,24 @@ public:
         return hash_table_.contains(x);
     }
 
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return hash_table_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return hash_table_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return hash_table_.contains_batch(first, last, out);
+    }
+
     //
     // ---- BUCKET INTERFACE --------------------------------------------------
     //
@@ -845,52 +866,52 @@ private:
         }
     }
 
-    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2, typename A2>
-    friend bool operator==(const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2>& x, const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2>& y);
+    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2, typename A2, bool S2>
+    friend bool operator==(const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2, S2>& x, const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2, S2>& y);
 
-    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2, typename A2>
-    friend bool operator!=(const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2>& x, const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2>& y);
+    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2, typename A2, bool S2>
+    friend bool operator!=(const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2, S2>& x, const small_unordered_multimap<K2, T2, N2, M2, H2, E2, A2, S2>& y);
 };
 
 //
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A>
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A, bool S>
 SFL_NODISCARD
 bool operator==
 (
-    const small_unordered_multimap<K, T, N, M, H, E, A>& x,
-    const small_unordered_multimap<K, T, N, M, H, E, A>& y
+    const small_unordered_multimap<K, T, N, M, H, E, A, S>& x,
+    const small_unordered_multimap<K, T, N, M, H, E, A, S>& y
 )
 {
     return x.hash_table_ == y.hash_table_;
 }
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A>
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A, bool S>
 SFL_NODISCARD
 bool operator!=
 (
-    const small_unordered_multimap<K, T, N, M, H, E, A>& x,
-    const small_unordered_multimap<K, T, N, M, H, E, A>& y
+    const small_unordered_multimap<K, T, N, M, H, E, A, S>& x,
+    const small_unordered_multimap<K, T, N, M, H, E, A, S>& y
 )
 {
     return x.hash_table_ != y.hash_table_;
 }
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A>
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A, bool S>
 void swap
 (
-    small_unordered_multimap<K, T, N, M, H, E, A>& x,
-    small_unordered_multimap<K, T, N, M, H, E, A>& y
+    small_unordered_multimap<K, T, N, M, H, E, A, S>& x,
+    small_unordered_multimap<K, T, N, M, H, E, A, S>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A, typename Predicate>
-typename small_unordered_multimap<K, T, N, M, H, E, A>::size_type
-    erase_if(small_unordered_multimap<K, T, N, M, H, E, A>& c, Predicate pred)
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename A, bool S, typename Predicate>
+typename small_unordered_multimap<K, T, N, M, H, E, A, S>::size_type
+    erase_if(small_unordered_multimap<K, T, N, M, H, E, A, S>& c, Predicate pred)
 {
     auto old_size = c.size();
 
@@ -23,7 +23,6 @@
 
 #include <sfl/detail/algorithm/copy.hpp>
 #include <sfl/detail/algorithm/fill.hpp>
-#include <sfl/detail/algorithm/move.hpp>
 #include <sfl/detail/algorithm/move_backward.hpp>
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/memory/allocate.hpp>
@@ -32,19 +31,22 @@
 #include <sfl/detail/memory/destroy_a.hpp>
 #include <sfl/detail/memory/destroy_at_a.hpp>
 #include <sfl/detail/memory/destroy_n_a.hpp>
+#include <sfl/detail/memory/relocate_a.hpp>
 #include <sfl/detail/memory/to_address.hpp>
 #include <sfl/detail/memory/uninitialized_copy_a.hpp>
 #include <sfl/detail/memory/uninitialized_default_construct_n_a.hpp>
+#include <sfl/detail/memory/uninitialized_default_init_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_fill_a.hpp>
 #include <sfl/detail/memory/uninitialized_fill_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_move_a.hpp>
-#include <sfl/detail/memory/uninitialized_move_if_noexcept_a.hpp>
+#include <sfl/detail/tags/default_init_t.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
 #include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/growth_policy.hpp>
 #include <sfl/detail/normal_iterator.hpp>
 
 #include <algorithm>        // copy, move, swap, swap_ranges
@@ -61,12 +63,14 @@ namespace sfl
 
 template < typename T,
            std::size_t N,
-           typename Allocator = std::allocator<T> >
+           typename Allocator = std::allocator<T>,
+           typename GrowthPolicy = sfl::growth_factor_1_5 >
 class small_vector
 {
 public:
 
     using allocator_type         = Allocator;
+    using growth_policy          = GrowthPolicy;
     using value_type             = T;
     using size_type              = typename sfl::dtl::allocator_traits<allocator_type>::size_type;
     using difference_type        = typename sfl::dtl::allocator_traits<allocator_type>::difference_type;
@@ -556,7 +560,7 @@ public:
                     pointer new_last  = new_first;
                     pointer new_eos   = new_first + N;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -564,7 +568,7 @@ public:
                         new_first
                     );
 
-                    sfl::dtl::destroy_a
+                    sfl::dtl::destroy_relocated_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -585,13 +589,14 @@ public:
             }
             else
             {
-                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+                pointer new_first = new_storage.ptr;
                 pointer new_last  = new_first;
-                pointer new_eos   = new_first + new_cap;
+                pointer new_eos   = new_first + new_storage.count;
 
                 SFL_TRY
                 {
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -605,13 +610,13 @@ public:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        new_cap
+                        std::distance(new_first, new_eos)
                     );
 
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -656,7 +661,7 @@ public:
                     pointer new_last  = new_first;
                     pointer new_eos   = new_first + N;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -664,7 +669,7 @@ public:
                         new_first
                     );
 
-                    sfl::dtl::destroy_a
+                    sfl::dtl::destroy_relocated_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -685,13 +690,14 @@ public:
             }
             else
             {
-                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+                pointer new_first = new_storage.ptr;
                 pointer new_last  = new_first;
-                pointer new_eos   = new_first + new_cap;
+                pointer new_eos   = new_first + new_storage.count;
 
                 SFL_TRY
                 {
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -705,13 +711,13 @@ public:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        new_cap
+                        std::distance(new_first, new_eos)
                     );
 
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -857,27 +863,13 @@ public:
                 // create new element now as a temporary value.
                 value_type tmp(std::forward<Args>(args)...);
 
-                const pointer p2 = data_.last_ - 1;
-
-                const pointer old_last = data_.last_;
-
-                sfl::dtl::construct_at_a
+                sfl::dtl::insert_shift_a
                 (
                     data_.ref_to_alloc(),
-                    data_.last_,
-                    std::move(*p2)
-                );
-
-                ++data_.last_;
-
-                sfl::dtl::move_backward
-                (
                     p1,
-                    p2,
-                    old_last
+                    data_.last_,
+                    std::move(tmp)
                 );
-
-                *p1 = std::move(tmp);
             }
 
             return iterator(p1);
@@ -901,9 +893,10 @@ public:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+                new_first = new_storage.ptr;
                 new_last  = new_first;
-                new_eos   = new_first + new_cap;
+                new_eos   = new_first + new_storage.count;
             }
 
             const pointer p = new_first + offset;
@@ -921,7 +914,7 @@ public:
 
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -931,7 +924,7 @@ public:
 
                 ++new_last;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -965,14 +958,14 @@ public:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        new_cap
+                        std::distance(new_first, new_eos)
                     );
                 }
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1093,9 +1086,10 @@ public:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+                new_first = new_storage.ptr;
                 new_last  = new_first;
-                new_eos   = new_first + new_cap;
+                new_eos   = new_first + new_storage.count;
             }
 
             const pointer p = new_first + size();
@@ -1111,7 +1105,7 @@ public:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1142,14 +1136,14 @@ public:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        new_cap
+                        std::distance(new_first, new_eos)
                     );
                 }
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1217,9 +1211,7 @@ public:
 
         const pointer p = pos.base();
 
-        data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
-
-        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+        data_.last_ = sfl::dtl::erase_shift_a(data_.ref_to_alloc(), p, p + 1, data_.last_);
 
         return iterator(p);
     }
@@ -1236,11 +1228,7 @@ public:
         const pointer p1 = first.base();
         const pointer p2 = last.base();
 
-        const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
-
-        sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
-
-        data_.last_ = new_last;
+        data_.last_ = sfl::dtl::erase_shift_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
         return iterator(p1);
     }
@@ -1282,9 +1270,10 @@ public:
                 }
                 else
                 {
-                    new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                    const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+                    new_first = new_storage.ptr;
                     new_last  = new_first;
-                    new_eos   = new_first + n;
+                    new_eos   = new_first + new_storage.count;
                 }
 
                 SFL_TRY
@@ -1298,7 +1287,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1335,14 +1324,14 @@ public:
                         (
                             data_.ref_to_alloc(),
                             new_first,
-                            n
+                            std::distance(new_first, new_eos)
                         );
                     }
 
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1375,6 +1364,41 @@ public:
         }
     }
 
+    void resize(size_type n, sfl::default_init_t)
+    {
+        check_size(n, "sfl::small_vector::resize");
+
+        const size_type size = this->size();
+
+        if (n < size)
+        {
+            const pointer new_last = data_.first_ + n;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                new_last,
+                data_.last_
+            );
+
+            data_.last_ = new_last;
+        }
+        else if (n > size)
+        {
+            if (n > capacity())
+            {
+                reserve(n);
+            }
+
+            data_.last_ = sfl::dtl::uninitialized_default_init_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                n - size
+            );
+        }
+    }
+
     void resize(size_type n, const T& value)
     {
         check_size(n, "sfl::small_vector::resize");
@@ -1412,9 +1436,10 @@ public:
                 }
                 else
                 {
-                    new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                    const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+                    new_first = new_storage.ptr;
                     new_last  = new_first;
-                    new_eos   = new_first + n;
+                    new_eos   = new_first + new_storage.count;
                 }
 
                 SFL_TRY
@@ -1429,7 +1454,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1466,14 +1491,14 @@ public:
                         (
                             data_.ref_to_alloc(),
                             new_first,
-                            n
+                            std::distance(new_first, new_eos)
                         );
                     }
 
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1507,6 +1532,47 @@ public:
         }
     }
 
+    T* append_uninitialized(size_type n)
+    {
+        const size_type size = this->size();
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::small_vector::append_uninitialized"));
+        }
+
+        resize(size + n, sfl::default_init_t());
+
+        return data() + size;
+    }
+
+    template <typename Operation>
+    void resize_and_overwrite(size_type n, Operation op)
+    {
+        const size_type size = this->size();
+
+        if (n > capacity())
+        {
+            reserve(calculate_new_capacity(n - size, "sfl::small_vector::resize_and_overwrite"));
+        }
+
+        resize(n, sfl::default_init_t());
+
+        SFL_TRY
+        {
+            const size_type new_size = std::move(op)(data(), n);
+
+            SFL_ASSERT(new_size <= n);
+
+            resize(new_size, sfl::default_init_t());
+        }
+        SFL_CATCH (...)
+        {
+            resize(std::min(size, n), sfl::default_init_t());
+            SFL_RETHROW;
+        }
+    }
+
     void swap(small_vector& other)
     {
         if (this == &other)
@@ -1687,18 +1753,17 @@ private:
         {
             sfl::dtl::throw_length_error(msg);
         }
-        else if (max_size - capacity < capacity / 2)
-        {
-            return max_size;
-        }
-        else if (size + num_additional_elements < capacity + capacity / 2)
-        {
-            return std::max(N, capacity + capacity / 2);
-        }
-        else
-        {
-            return std::max(N, size + num_additional_elements);
-        }
+
+        return std::max
+        (
+            N,
+            GrowthPolicy::template new_capacity<T>
+            (
+                capacity,
+                size_type(size + num_additional_elements),
+                max_size
+            )
+        );
     }
 
     void reset(size_type new_cap = N)
@@ -1726,9 +1791,10 @@ private:
 
         if (new_cap > N)
         {
-            data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            data_.first_ = storage.ptr;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.first_ + new_cap;
+            data_.eos_   = data_.first_ + storage.count;
 
             // If allocation throws, first_, last_ and eos_ will be valid
             // (they will be pointing to internal_storage).
@@ -1741,9 +1807,10 @@ private:
 
         if (n > N)
         {
-            data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            data_.first_ = storage.ptr;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.first_ + n;
+            data_.eos_   = data_.first_ + storage.count;
         }
 
         SFL_TRY
@@ -1759,7 +1826,7 @@ private:
         {
             if (n > N)
             {
-                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             }
 
             SFL_RETHROW;
@@ -1772,9 +1839,10 @@ private:
 
         if (n > N)
         {
-            data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            data_.first_ = storage.ptr;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.first_ + n;
+            data_.eos_   = data_.first_ + storage.count;
         }
 
         SFL_TRY
@@ -1791,7 +1859,7 @@ private:
         {
             if (n > N)
             {
-                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             }
 
             SFL_RETHROW;
@@ -1847,9 +1915,10 @@ private:
 
         if (n > N)
         {
-            data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            data_.first_ = storage.ptr;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.first_ + n;
+            data_.eos_   = data_.first_ + storage.count;
         }
 
         SFL_TRY
@@ -1866,7 +1935,7 @@ private:
         {
             if (n > N)
             {
-                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             }
 
             SFL_RETHROW;
@@ -1908,9 +1977,10 @@ private:
 
         if (n > N)
         {
-            data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            data_.first_ = storage.ptr;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.first_ + n;
+            data_.eos_   = data_.first_ + storage.count;
         }
 
         SFL_TRY
@@ -1927,7 +1997,7 @@ private:
         {
             if (n > N)
             {
-                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             }
 
             SFL_RETHROW;
@@ -1964,9 +2034,10 @@ private:
 
             if (n > N)
             {
-                data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+                data_.first_ = storage.ptr;
                 data_.last_  = data_.first_;
-                data_.eos_   = data_.first_ + n;
+                data_.eos_   = data_.first_ + storage.count;
             }
 
             SFL_TRY
@@ -1983,7 +2054,7 @@ private:
             {
                 if (n > N)
                 {
-                    sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+                    sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
                 }
 
                 SFL_RETHROW;
@@ -2305,9 +2376,10 @@ private:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+                new_first = new_storage.ptr;
                 new_last  = new_first;
-                new_eos   = new_first + new_cap;
+                new_eos   = new_first + new_storage.count;
             }
 
             const pointer p = new_first + offset;
@@ -2330,7 +2402,7 @@ private:
 
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -2340,7 +2412,7 @@ private:
 
                 new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -2375,14 +2447,14 @@ private:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        new_cap
+                        std::distance(new_first, new_eos)
                     );
                 }
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2522,18 +2594,32 @@ private:
             }
             else
             {
-                new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+                new_first = new_storage.ptr;
                 new_last  = new_first;
-                new_eos   = new_first + new_cap;
+                new_eos   = new_first + new_storage.count;
             }
 
             const pointer p = new_first + offset;
 
             SFL_TRY
             {
+                // First we will copy new elements and after that we
+                // can relocate existing elements.
+
+                sfl::dtl::uninitialized_copy_a
+                (
+                    data_.ref_to_alloc(),
+                    first,
+                    last,
+                    p
+                );
+
+                new_last = nullptr;
+
                 const pointer mid = data_.first_ + offset;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -2541,15 +2627,9 @@ private:
                     new_first
                 );
 
-                new_last = sfl::dtl::uninitialized_copy_a
-                (
-                    data_.ref_to_alloc(),
-                    first,
-                    last,
-                    new_last
-                );
+                new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     mid,
@@ -2559,12 +2639,24 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
 
                 if (new_first != data_.internal_storage())
                 {
@@ -2572,14 +2664,14 @@ private:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        new_cap
+                        std::distance(new_first, new_eos)
                     );
                 }
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2609,85 +2701,85 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator==
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator!=
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return !(x == y);
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator<
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator>
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return y < x;
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator<=
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return !(y < x);
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 SFL_NODISCARD
 bool operator>=
 (
-    const small_vector<T, N, A>& x,
-    const small_vector<T, N, A>& y
+    const small_vector<T, N, A, G>& x,
+    const small_vector<T, N, A, G>& y
 )
 {
     return !(x < y);
 }
 
-template <typename T, std::size_t N, typename A>
+template <typename T, std::size_t N, typename A, typename G>
 void swap
 (
-    small_vector<T, N, A>& x,
-    small_vector<T, N, A>& y
+    small_vector<T, N, A, G>& x,
+    small_vector<T, N, A, G>& y
 )
 {
     x.swap(y);
 }
 
-template <typename T, std::size_t N, typename A, typename U>
-typename small_vector<T, N, A>::size_type
-    erase(small_vector<T, N, A>& c, const U& value)
+template <typename T, std::size_t N, typename A, typename G, typename U>
+typename small_vector<T, N, A, G>::size_type
+    erase(small_vector<T, N, A, G>& c, const U& value)
 {
     auto it = std::remove(c.begin(), c.end(), value);
     auto r = std::distance(it, c.end());
@@ -2695,9 +2787,9 @@ typename small_vector<T, N, A>::size_type
     return r;
 }
 
-template <typename T, std::size_t N, typename A, typename Predicate>
-typename small_vector<T, N, A>::size_type
-    erase_if(small_vector<T, N, A>& c, Predicate pred)
+template <typename T, std::size_t N, typename A, typename G, typename Predicate>
+typename small_vector<T, N, A, G>::size_type
+    erase_if(small_vector<T, N, A, G>& c, Predicate pred)
 {
     auto it = std::remove_if(c.begin(), c.end(), pred);
     auto r = std::distance(it, c.end());
@@ -24,6 +24,7 @@
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/functional/identity.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_unique_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -123,6 +124,30 @@ public:
         : static_flat_set(ilist.begin(), ilist.end(), comp)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_set(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : impl_()
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_flat_set(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : impl_(comp)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    static_flat_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : static_flat_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    static_flat_set(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : static_flat_set(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
     static_flat_set(const static_flat_set& other)
         : impl_(other.impl_)
     {}
@@ -429,6 +454,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -437,6 +474,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -447,6 +490,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
 #endif // before C++20
 
     iterator erase(const_iterator pos)
@@ -643,11 +694,13 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        impl_.insert_range_unique(std::move(first), std::move(last));
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        impl_.insert_range_sorted_unique(std::move(first), std::move(last));
     }
 
     template <typename K2, std::size_t N2, typename C2>
@@ -667,6 +720,15 @@ private:
 
     template <typename K2, std::size_t N2, typename C2>
     friend bool operator>=(const static_flat_set<K2, N2, C2>& x, const static_flat_set<K2, N2, C2>& y);
+
+    template <typename K2, std::size_t N2, typename C2>
+    friend typename static_flat_set<K2, N2, C2>::size_type set_union_into(static_flat_set<K2, N2, C2>& x, const static_flat_set<K2, N2, C2>& y);
+
+    template <typename K2, std::size_t N2, typename C2>
+    friend typename static_flat_set<K2, N2, C2>::size_type set_intersection_into(static_flat_set<K2, N2, C2>& x, const static_flat_set<K2, N2, C2>& y);
+
+    template <typename K2, std::size_t N2, typename C2>
+    friend typename static_flat_set<K2, N2, C2>::size_type set_difference_into(static_flat_set<K2, N2, C2>& x, const static_flat_set<K2, N2, C2>& y);
 };
 
 //
@@ -770,6 +832,27 @@ typename static_flat_set<K, N, C>::size_type
     return old_size - c.size();
 }
 
+template <typename K, std::size_t N, typename C>
+typename static_flat_set<K, N, C>::size_type
+    set_union_into(static_flat_set<K, N, C>& x, const static_flat_set<K, N, C>& y)
+{
+    return x.impl_.union_unique(y.impl_);
+}
+
+template <typename K, std::size_t N, typename C>
+typename static_flat_set<K, N, C>::size_type
+    set_intersection_into(static_flat_set<K, N, C>& x, const static_flat_set<K, N, C>& y)
+{
+    return x.impl_.intersection_unique(y.impl_);
+}
+
+template <typename K, std::size_t N, typename C>
+typename static_flat_set<K, N, C>::size_type
+    set_difference_into(static_flat_set<K, N, C>& x, const static_flat_set<K, N, C>& y)
+{
+    return x.impl_.difference_unique(y.impl_);
+}
+
 } // namespace sfl
 
 #endif // SFL_STATIC_FLAT_SET_HPP_INCLUDED
@@ -24,6 +24,7 @@
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/functional/first.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/tags/sorted_unique_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/has_is_transparent.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
@@ -149,6 +150,30 @@ public:
         : static_map(ilist.begin(), ilist.end(), comp)
     {}
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_map(sfl::sorted_unique_t, InputIt first, InputIt last)
+        : tree_()
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    static_map(sfl::sorted_unique_t, InputIt first, InputIt last, const Compare& comp)
+        : tree_(comp)
+    {
+        insert(sfl::sorted_unique_t(), first, last);
+    }
+
+    static_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+        : static_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end())
+    {}
+
+    static_map(sfl::sorted_unique_t, std::initializer_list<value_type> ilist, const Compare& comp)
+        : static_map(sfl::sorted_unique_t(), ilist.begin(), ilist.end(), comp)
+    {}
+
     static_map(const static_map& other)
         : tree_(other.tree_)
     {}
@@ -428,6 +453,18 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void insert(sfl::sorted_unique_t, InputIt first, InputIt last)
+    {
+        insert_range_sorted_aux(first, last);
+    }
+
+    void insert(sfl::sorted_unique_t, std::initializer_list<value_type> ilist)
+    {
+        insert_range_sorted_aux(ilist.begin(), ilist.end());
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -436,6 +473,12 @@ public:
         insert_range_aux(std::ranges::begin(range), std::ranges::end(range));
     }
 
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        insert_range_sorted_aux(std::ranges::begin(range), std::ranges::end(range));
+    }
+
 #else // before C++20
 
     template <typename Range>
@@ -446,6 +489,14 @@ public:
         insert_range_aux(begin(range), end(range));
     }
 
+    template <typename Range>
+    void insert_range(sfl::sorted_unique_t, Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        insert_range_sorted_aux(begin(range), end(range));
+    }
+
 #endif // before C++20
 
     template <typename M,
@@ -817,11 +868,13 @@ private:
     template <typename InputIt, typename Sentinel>
     void insert_range_aux(InputIt first, Sentinel last)
     {
-        while (first != last)
-        {
-            insert(*first);
-            ++first;
-        }
+        tree_.insert_range_unique(std::move(first), std::move(last));
+    }
+
+    template <typename InputIt, typename Sentinel>
+    void insert_range_sorted_aux(InputIt first, Sentinel last)
+    {
+        tree_.insert_range_sorted_unique(std::move(first), std::move(last));
     }
 
     template <typename K2, typename T2, std::size_t N2, typename C2>
@@ -841,6 +894,15 @@ private:
 
     template <typename K2, typename T2, std::size_t N2, typename C2>
     friend bool operator>=(const static_map<K2, T2, N2, C2>& x, const static_map<K2, T2, N2, C2>& y);
+
+    template <typename K2, typename T2, std::size_t N2, typename C2>
+    friend typename static_map<K2, T2, N2, C2>::size_type set_union_into(static_map<K2, T2, N2, C2>& x, const static_map<K2, T2, N2, C2>& y);
+
+    template <typename K2, typename T2, std::size_t N2, typename C2>
+    friend typename static_map<K2, T2, N2, C2>::size_type set_intersection_into(static_map<K2, T2, N2, C2>& x, const static_map<K2, T2, N2, C2>& y);
+
+    template <typename K2, typename T2, std::size_t N2, typename C2>
+    friend typename static_map<K2, T2, N2, C2>::size_type set_difference_into(static_map<K2, T2, N2, C2>& x, const static_map<K2, T2, N2, C2>& y);
 };
 
 //
@@ -944,6 +1006,27 @@ typename static_map<K, T, N, C>::size_type
     return old_size - c.size();
 }
 
+template <typename K, typename T, std::size_t N, typename C>
+typename static_map<K, T, N, C>::size_type
+    set_union_into(static_map<K, T, N, C>& x, const static_map<K, T, N, C>& y)
+{
+    return x.tree_.union_unique(y.tree_);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+typename static_map<K, T, N, C>::size_type
+    set_intersection_into(static_map<K, T, N, C>& x, const static_map<K, T, N, C>& y)
+{
+    return x.tree_.intersection_unique(y.tree_);
+}
+
+template <typename K, typename T, std::size_t N, typename C>
+typename static_map<K, T, N, C>::size_type
+    set_difference_into(static_map<K, T, N, C>& x, const static_map<K, T, N, C>& y)
+{
+    return x.tree_.difference_unique(y.tree_);
+}
+
 } // namespace sfl
 
 #endif // SFL_STATIC_MAP_HPP_INCLUDED
@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_STATIC_PERFECT_MAP_HPP_INCLUDED
+#define SFL_STATIC_PERFECT_MAP_HPP_INCLUDED
+
+#include <sfl/detail/functional/first.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/perfect_hash_table.hpp>
+
+#include <cstddef>      // size_t
+#include <functional>   // equal_to
+#include <utility>      // pair
+
+#if SFL_CPP_VERSION >= SFL_CPP_14
+
+namespace sfl
+{
+
+template < typename Key,
+           typename T,
+           std::size_t N,
+           typename Hash = sfl::static_perfect_hash<Key>,
+           typename KeyEqual = std::equal_to<Key> >
+class static_perfect_map
+{
+public:
+
+    using key_type        = Key;
+    using mapped_type     = T;
+    using value_type      = std::pair<Key, T>;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher          = Hash;
+    using key_equal       = KeyEqual;
+    using reference       = const value_type&;
+    using const_reference = const value_type&;
+    using pointer         = const value_type*;
+    using const_pointer   = const value_type*;
+    using iterator        = const value_type*;
+    using const_iterator  = const value_type*;
+
+private:
+
+    using table_type = sfl::dtl::perfect_hash_table
+    <
+        Key,
+        value_type,
+        sfl::dtl::first,
+        N,
+        Hash,
+        KeyEqual
+    >;
+
+    table_type table_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION ------------------------------------------------------
+    //
+
+    constexpr explicit static_perfect_map(const value_type (&values)[N])
+        : table_(values, Hash(), KeyEqual())
+    {}
+
+    constexpr static_perfect_map(const value_type (&values)[N], const Hash& hash)
+        : table_(values, hash, KeyEqual())
+    {}
+
+    constexpr static_perfect_map(const value_type (&values)[N], const Hash& hash, const KeyEqual& equal)
+        : table_(values, hash, equal)
+    {}
+
+    //
+    // ---- OBSERVERS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr hasher hash_function() const
+    {
+        return table_.hash_function();
+    }
+
+    SFL_NODISCARD
+    constexpr key_equal key_eq() const
+    {
+        return table_.key_eq();
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr const_iterator begin() const noexcept
+    {
+        return table_.begin();
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator cbegin() const noexcept
+    {
+        return table_.begin();
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator end() const noexcept
+    {
+        return table_.end();
+    }
+
+    SFL_NODISCARD
+    constexpr const_iterator cend() const noexcept
+    {
+        return table_.end();
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr bool empty() const noexcept
+    {
+        return false;
+    }
+
+    SFL_NODISCARD
+    constexpr size_type size() const noexcept
+    {
+        return N;
+    }
+
+    SFL_NODISCARD
+    constexpr size_type max_size() const noexcept
+    {
+        return N;
+    }
+
+    //
+    // ---- LOOKUP ------------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr const_iterator find(const Key& key) const
+    {
+        return table_.find(key);
+    }
+
+    SFL_NODISCARD
+    constexpr size_type count(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    SFL_NODISCARD
+    constexpr bool contains(const Key& key) const
+    {
+        return find(key) != end();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    constexpr const T& at(const Key& key) const
+    {
+        const const_iterator it = find(key);
+
+        if (it == end())
+        {
+            sfl::dtl::throw_out_of_range("sfl::static_perfect_map::at");
+        }
+
+        return it->second;
+    }
+};
+
+template <typename Key, typename T, std::size_t N>
+SFL_NODISCARD
+constexpr static_perfect_map<Key, T, N> make_static_perfect_map(const std::pair<Key, T> (&values)[N])
+{
+    return static_perfect_map<Key, T, N>(values);
+}
+
+} // namespace sfl
+
+#endif // C++14
+
+#endif // SFL_STATIC_PERFECT_MAP_HPP_INCLUDED
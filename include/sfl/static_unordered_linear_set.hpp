@@ -29,13 +29,15 @@
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/linear_fingerprints.hpp>
 #include <sfl/detail/unordered_associative_vector.hpp>
 #include <sfl/static_vector.hpp>
 
 #include <cstddef>          // size_t
+#include <cstdint>          // uint8_t
 #include <functional>       // equal_to
 #include <initializer_list> // initializer_list
-#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <type_traits>      // conditional, is_same, is_void, is_nothrow_xxxxx
 #include <utility>          // forward, move, pair
 
 namespace sfl
@@ -43,7 +45,8 @@ namespace sfl
 
 template < typename Key,
            std::size_t N,
-           typename KeyEqual = std::equal_to<Key> >
+           typename KeyEqual = std::equal_to<Key>,
+           typename Hash = void >
 class static_unordered_linear_set
 {
     static_assert(N > 0, "N must be greater than zero.");
@@ -56,13 +59,21 @@ public:
 
 private:
 
+    using fingerprints = typename std::conditional
+    <
+        std::is_void<Hash>::value,
+        sfl::dtl::no_linear_fingerprints,
+        sfl::dtl::linear_fingerprints<Hash, sfl::static_vector<std::uint8_t, N>>
+    >::type;
+
     using unordered_associative_vector = sfl::dtl::unordered_associative_vector
     <
         key_type,
         value_type,
         sfl::dtl::identity,
         key_equal,
-        sfl::static_vector<value_type, N>
+        sfl::static_vector<value_type, N>,
+        fingerprints
     >;
 
     unordered_associative_vector impl_;
@@ -517,52 +528,52 @@ private:
         }
     }
 
-    template <typename K2, std::size_t N2, typename E2>
-    friend bool operator==(const static_unordered_linear_set<K2, N2, E2>& x, const static_unordered_linear_set<K2, N2, E2>& y);
+    template <typename K2, std::size_t N2, typename E2, typename H2>
+    friend bool operator==(const static_unordered_linear_set<K2, N2, E2, H2>& x, const static_unordered_linear_set<K2, N2, E2, H2>& y);
 
-    template <typename K2, std::size_t N2, typename E2>
-    friend bool operator!=(const static_unordered_linear_set<K2, N2, E2>& x, const static_unordered_linear_set<K2, N2, E2>& y);
+    template <typename K2, std::size_t N2, typename E2, typename H2>
+    friend bool operator!=(const static_unordered_linear_set<K2, N2, E2, H2>& x, const static_unordered_linear_set<K2, N2, E2, H2>& y);
 };
 
 //
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, std::size_t N, typename E>
+template <typename K, std::size_t N, typename E, typename H>
 SFL_NODISCARD
 bool operator==
 (
-    const static_unordered_linear_set<K, N, E>& x,
-    const static_unordered_linear_set<K, N, E>& y
+    const static_unordered_linear_set<K, N, E, H>& x,
+    const static_unordered_linear_set<K, N, E, H>& y
 )
 {
     return x.impl_ == y.impl_;
 }
 
-template <typename K, std::size_t N, typename E>
+template <typename K, std::size_t N, typename E, typename H>
 SFL_NODISCARD
 bool operator!=
 (
-    const static_unordered_linear_set<K, N, E>& x,
-    const static_unordered_linear_set<K, N, E>& y
+    const static_unordered_linear_set<K, N, E, H>& x,
+    const static_unordered_linear_set<K, N, E, H>& y
 )
 {
     return x.impl_ != y.impl_;
 }
 
-template <typename K, std::size_t N, typename E>
+template <typename K, std::size_t N, typename E, typename H>
 void swap
 (
-    static_unordered_linear_set<K, N, E>& x,
-    static_unordered_linear_set<K, N, E>& y
+    static_unordered_linear_set<K, N, E, H>& x,
+    static_unordered_linear_set<K, N, E, H>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, std::size_t N, typename E, typename Predicate>
-typename static_unordered_linear_set<K, N, E>::size_type
-    erase_if(static_unordered_linear_set<K, N, E>& c, Predicate pred)
+template <typename K, std::size_t N, typename E, typename H, typename Predicate>
+typename static_unordered_linear_set<K, N, E, H>::size_type
+    erase_if(static_unordered_linear_set<K, N, E, H>& c, Predicate pred)
 {
     auto old_size = c.size();
 
@@ -51,7 +51,8 @@ template < typename Key,
            std::size_t StaticCapacity,
            std::size_t StaticBucketCount = sfl::dtl::bit_ceil(StaticCapacity),
            typename Hash = std::hash<Key>,
-           typename KeyEqual = std::equal_to<Key> >
+           typename KeyEqual = std::equal_to<Key>,
+           bool StoreHash = false >
 class static_unordered_map
 {
     static_assert(StaticCapacity > 0, "StaticCapacity must be greater than zero.");
@@ -97,7 +98,9 @@ private:
         node_allocator_type,
         bucket_allocator_type,
         bucket_count_policy,
-        max_load_policy
+        max_load_policy,
+        StoreHash,
+        false
     >;
 
     hash_table hash_table_;
@@ -687,6 +690,24 @@ public:
         return hash_table_.contains(x);
     }
 
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return hash_table_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return hash_table_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return hash_table_.contains_batch(first, last, out);
+    }
+
     //
     // ---- ELEMENT ACCESS ----------------------------------------------------
     //
@@ -871,52 +892,52 @@ private:
         }
     }
 
-    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2>
-    friend bool operator==(const static_unordered_map<K2, T2, N2, M2, H2, E2>& x, const static_unordered_map<K2, T2, N2, M2, H2, E2>& y);
+    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2, bool S2>
+    friend bool operator==(const static_unordered_map<K2, T2, N2, M2, H2, E2, S2>& x, const static_unordered_map<K2, T2, N2, M2, H2, E2, S2>& y);
 
-    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2>
-    friend bool operator!=(const static_unordered_map<K2, T2, N2, M2, H2, E2>& x, const static_unordered_map<K2, T2, N2, M2, H2, E2>& y);
+    template <typename K2, typename T2, std::size_t N2, std::size_t M2, typename H2, typename E2, bool S2>
+    friend bool operator!=(const static_unordered_map<K2, T2, N2, M2, H2, E2, S2>& x, const static_unordered_map<K2, T2, N2, M2, H2, E2, S2>& y);
 };
 
 //
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E>
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, bool S>
 SFL_NODISCARD
 bool operator==
 (
-    const static_unordered_map<K, T, N, M, H, E>& x,
-    const static_unordered_map<K, T, N, M, H, E>& y
+    const static_unordered_map<K, T, N, M, H, E, S>& x,
+    const static_unordered_map<K, T, N, M, H, E, S>& y
 )
 {
     return x.hash_table_ == y.hash_table_;
 }
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E>
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, bool S>
 SFL_NODISCARD
 bool operator!=
 (
-    const static_unordered_map<K, T, N, M, H, E>& x,
-    const static_unordered_map<K, T, N, M, H, E>& y
+    const static_unordered_map<K, T, N, M, H, E, S>& x,
+    const static_unordered_map<K, T, N, M, H, E, S>& y
 )
 {
     return x.hash_table_ != y.hash_table_;
 }
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E>
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, bool S>
 void swap
 (
-    static_unordered_map<K, T, N, M, H, E>& x,
-    static_unordered_map<K, T, N, M, H, E>& y
+    static_unordered_map<K, T, N, M, H, E, S>& x,
+    static_unordered_map<K, T, N, M, H, E, S>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, typename Predicate>
-typename static_unordered_map<K, T, N, M, H, E>::size_type
-    erase_if(static_unordered_map<K, T, N, M, H, E>& c, Predicate pred)
+template <typename K, typename T, std::size_t N, std::size_t M, typename H, typename E, bool S, typename Predicate>
+typename static_unordered_map<K, T, N, M, H, E, S>::size_type
+    erase_if(static_unordered_map<K, T, N, M, H, E, S>& c, Predicate pred)
 {
     auto old_size = c.size();
 
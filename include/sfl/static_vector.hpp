@@ -824,6 +824,41 @@ public:
         }
     }
 
+    T* append_uninitialized(size_type n)
+    {
+        SFL_ASSERT(n <= available());
+
+        const size_type size = this->size();
+
+        resize(size + n, sfl::default_init_t());
+
+        return data() + size;
+    }
+
+    template <typename Operation>
+    void resize_and_overwrite(size_type n, Operation op)
+    {
+        SFL_ASSERT(n <= capacity());
+
+        const size_type size = this->size();
+
+        resize(n, sfl::default_init_t());
+
+        SFL_TRY
+        {
+            const size_type new_size = std::move(op)(data(), n);
+
+            SFL_ASSERT(new_size <= n);
+
+            resize(new_size, sfl::default_init_t());
+        }
+        SFL_CATCH (...)
+        {
+            resize(std::min(size, n), sfl::default_init_t());
+            SFL_RETHROW;
+        }
+    }
+
     void swap(static_vector& other)
     {
         if (this == &other)
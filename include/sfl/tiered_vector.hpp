@@ -0,0 +1,1639 @@
+//
+// Copyright (c) 2022 Slaven Falandys
+//
+// This software is provided 'as-is', without any express or implied
+// warranty. In no event will the authors be held liable for any damages
+// arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it
+// freely, subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented; you must not
+//    claim that you wrote the original software. If you use this software
+//    in a product, an acknowledgment in the product documentation would be
+//    appreciated but is not required.
+// 2. Altered source versions must be plainly marked as such, and must not be
+//    misrepresented as being the original software.
+// 3. This notice may not be removed or altered from any source distribution.
+//
+
+#ifndef SFL_TIERED_VECTOR_HPP_INCLUDED
+#define SFL_TIERED_VECTOR_HPP_INCLUDED
+
+#include <sfl/detail/algorithm/copy.hpp>
+#include <sfl/detail/concepts/container_compatible_range.hpp>
+#include <sfl/detail/memory/allocate.hpp>
+#include <sfl/detail/memory/construct_at_a.hpp>
+#include <sfl/detail/memory/deallocate.hpp>
+#include <sfl/detail/memory/destroy_at_a.hpp>
+#include <sfl/detail/tags/from_range_t.hpp>
+#include <sfl/detail/type_traits/enable_if_t.hpp>
+#include <sfl/detail/type_traits/is_input_iterator.hpp>
+#include <sfl/detail/allocator_traits.hpp>
+#include <sfl/detail/cpp.hpp>
+#include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/tiered_iterator.hpp>
+
+#include <algorithm>        // equal, lexicographical_compare, max, min, move, remove, remove_if, rotate
+#include <cstddef>          // size_t
+#include <initializer_list> // initializer_list
+#include <iterator>         // distance, make_move_iterator, reverse_iterator
+#include <limits>           // numeric_limits
+#include <memory>           // allocator
+#include <type_traits>      // is_same, is_nothrow_xxxxx
+#include <utility>          // forward, move, swap
+
+namespace sfl
+{
+
+template < typename T,
+           std::size_t N,
+           typename Allocator = std::allocator<T> >
+class tiered_vector
+{
+    static_assert(N > 0, "N must be greater than zero.");
+
+public:
+
+    using allocator_type         = Allocator;
+    using value_type             = T;
+    using size_type              = typename sfl::dtl::allocator_traits<allocator_type>::size_type;
+    using difference_type        = typename sfl::dtl::allocator_traits<allocator_type>::difference_type;
+    using reference              = T&;
+    using const_reference        = const T&;
+    using pointer                = typename sfl::dtl::allocator_traits<allocator_type>::pointer;
+    using const_pointer          = typename sfl::dtl::allocator_traits<allocator_type>::const_pointer;
+
+private:
+
+    using segment_type           = sfl::dtl::tiered_segment<pointer>;
+    using segment_allocator      = typename sfl::dtl::allocator_traits<allocator_type>::template rebind_alloc<segment_type>;
+    using segment_pointer        = typename sfl::dtl::allocator_traits<segment_allocator>::pointer;
+
+public:
+
+    using iterator               = sfl::dtl::tiered_iterator<segment_pointer, pointer, N, false>;
+    using const_iterator         = sfl::dtl::tiered_iterator<segment_pointer, pointer, N, true>;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static_assert
+    (
+        std::is_same<typename Allocator::value_type, value_type>::value,
+        "Allocator::value_type must be same as sfl::tiered_vector::value_type."
+    );
+
+public:
+
+    static constexpr size_type segment_capacity = N;
+
+private:
+
+    //
+    // All segments in use are full, except the last one. Unused segments
+    // follow the segments in use. Each segment is circular buffer, so
+    // inserting or erasing an element shifts elements only within one
+    // segment and rotates each of the following segments by one element.
+    //
+
+    class data_base
+    {
+    public:
+
+        // ---- TABLE (OF SEGMENTS) ----
+
+        segment_pointer table_first_; // First element in table
+        segment_pointer table_last_;  // One-past-last element in table
+        segment_pointer table_eos_;   // End of storage
+
+        // ---- ELEMENTS IN VECTOR ----
+
+        size_type size_; // Number of elements in vector
+
+        data_base() noexcept
+            : table_first_(nullptr)
+            , table_last_(nullptr)
+            , table_eos_(nullptr)
+            , size_(0)
+        {}
+    };
+
+    class data : public data_base, public allocator_type
+    {
+    public:
+
+        data() noexcept(std::is_nothrow_default_constructible<allocator_type>::value)
+            : allocator_type()
+        {}
+
+        data(const allocator_type& alloc) noexcept(std::is_nothrow_copy_constructible<allocator_type>::value)
+            : allocator_type(alloc)
+        {}
+
+        data(allocator_type&& other) noexcept(std::is_nothrow_move_constructible<allocator_type>::value)
+            : allocator_type(std::move(other))
+        {}
+
+        allocator_type& ref_to_alloc() noexcept
+        {
+            return *this;
+        }
+
+        const allocator_type& ref_to_alloc() const noexcept
+        {
+            return *this;
+        }
+
+        data_base& ref_to_storage() noexcept
+        {
+            return *this;
+        }
+    };
+
+    data data_;
+
+public:
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    tiered_vector()
+        : data_()
+    {}
+
+    explicit tiered_vector(const Allocator& alloc)
+        : data_(alloc)
+    {}
+
+    tiered_vector(size_type n)
+        : data_()
+    {
+        initialize_default_n(n);
+    }
+
+    explicit tiered_vector(size_type n, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_default_n(n);
+    }
+
+    tiered_vector(size_type n, const T& value)
+        : data_()
+    {
+        initialize_fill_n(n, value);
+    }
+
+    tiered_vector(size_type n, const T& value, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_fill_n(n, value);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    tiered_vector(InputIt first, InputIt last)
+        : data_()
+    {
+        initialize_range(first, last);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    tiered_vector(InputIt first, InputIt last, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(first, last);
+    }
+
+    tiered_vector(std::initializer_list<T> ilist)
+        : tiered_vector(ilist.begin(), ilist.end())
+    {}
+
+    tiered_vector(std::initializer_list<T> ilist, const Allocator& alloc)
+        : tiered_vector(ilist.begin(), ilist.end(), alloc)
+    {}
+
+    tiered_vector(const tiered_vector& other)
+        : data_
+        (
+            sfl::dtl::allocator_traits<allocator_type>::select_on_container_copy_construction
+            (
+                other.data_.ref_to_alloc()
+            )
+        )
+    {
+        initialize_range(other.begin(), other.end());
+    }
+
+    tiered_vector(const tiered_vector& other, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(other.begin(), other.end());
+    }
+
+    tiered_vector(tiered_vector&& other)
+        : data_(std::move(other.data_.ref_to_alloc()))
+    {
+        initialize_move(other);
+    }
+
+    tiered_vector(tiered_vector&& other, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_move(other);
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    tiered_vector(sfl::from_range_t, Range&& range)
+        : data_()
+    {
+        initialize_range(std::forward<Range>(range));
+    }
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    tiered_vector(sfl::from_range_t, Range&& range, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(std::forward<Range>(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    tiered_vector(sfl::from_range_t, Range&& range)
+        : data_()
+    {
+        initialize_range(std::forward<Range>(range));
+    }
+
+    template <typename Range>
+    tiered_vector(sfl::from_range_t, Range&& range, const Allocator& alloc)
+        : data_(alloc)
+    {
+        initialize_range(std::forward<Range>(range));
+    }
+
+#endif // before C++20
+
+    ~tiered_vector()
+    {
+        clear();
+        deallocate_storage();
+    }
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    void assign(size_type n, const T& value)
+    {
+        assign_fill_n(n, value);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    void assign(InputIt first, InputIt last)
+    {
+        assign_range(first, last);
+    }
+
+    void assign(std::initializer_list<T> ilist)
+    {
+        assign_range(ilist.begin(), ilist.end());
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void assign_range(Range&& range)
+    {
+        if constexpr (std::ranges::forward_range<Range>)
+        {
+            assign_range(std::ranges::begin(range), std::ranges::end(range), std::forward_iterator_tag());
+        }
+        else
+        {
+            assign_range(std::ranges::begin(range), std::ranges::end(range), std::input_iterator_tag());
+        }
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    void assign_range(Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        assign_range(begin(range), end(range));
+    }
+
+#endif // before C++20
+
+    tiered_vector& operator=(const tiered_vector& other)
+    {
+        assign_copy(other);
+        return *this;
+    }
+
+    tiered_vector& operator=(tiered_vector&& other)
+    {
+        assign_move(other);
+        return *this;
+    }
+
+    tiered_vector& operator=(std::initializer_list<T> ilist)
+    {
+        assign_range(ilist.begin(), ilist.end());
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATOR ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    allocator_type get_allocator() const noexcept
+    {
+        return data_.ref_to_alloc();
+    }
+
+    //
+    // ---- ITERATORS ---------------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    iterator begin() noexcept
+    {
+        return iterator(data_.table_first_, 0);
+    }
+
+    SFL_NODISCARD
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(data_.table_first_, 0);
+    }
+
+    SFL_NODISCARD
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(data_.table_first_, 0);
+    }
+
+    SFL_NODISCARD
+    iterator end() noexcept
+    {
+        return iterator(data_.table_first_, data_.size_);
+    }
+
+    SFL_NODISCARD
+    const_iterator end() const noexcept
+    {
+        return const_iterator(data_.table_first_, data_.size_);
+    }
+
+    SFL_NODISCARD
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(data_.table_first_, data_.size_);
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+
+    SFL_NODISCARD
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    SFL_NODISCARD
+    iterator nth(size_type pos) noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return iterator(data_.table_first_, pos);
+    }
+
+    SFL_NODISCARD
+    const_iterator nth(size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos <= size());
+        return const_iterator(data_.table_first_, pos);
+    }
+
+    SFL_NODISCARD
+    size_type index_of(const_iterator pos) const noexcept
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return pos.index_;
+    }
+
+    //
+    // ---- SIZE AND CAPACITY -------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    bool empty() const noexcept
+    {
+        return data_.size_ == 0;
+    }
+
+    SFL_NODISCARD
+    size_type size() const noexcept
+    {
+        return data_.size_;
+    }
+
+    SFL_NODISCARD
+    size_type max_size() const noexcept
+    {
+        return std::min<size_type>
+        (
+            sfl::dtl::allocator_traits<allocator_type>::max_size(data_.ref_to_alloc()),
+            std::numeric_limits<difference_type>::max() / sizeof(value_type)
+        );
+    }
+
+    SFL_NODISCARD
+    size_type capacity() const noexcept
+    {
+        return std::distance(data_.table_first_, data_.table_last_) * N;
+    }
+
+    SFL_NODISCARD
+    size_type available() const noexcept
+    {
+        return capacity() - size();
+    }
+
+    void reserve(size_type new_capacity)
+    {
+        if (new_capacity > capacity())
+        {
+            grow_storage(new_capacity);
+        }
+    }
+
+    void shrink_to_fit()
+    {
+        shrink_storage();
+    }
+
+    //
+    // ---- ELEMENT ACCESS ----------------------------------------------------
+    //
+
+    SFL_NODISCARD
+    reference at(size_type pos)
+    {
+        if (pos >= size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::tiered_vector::at");
+        }
+
+        return *element(pos);
+    }
+
+    SFL_NODISCARD
+    const_reference at(size_type pos) const
+    {
+        if (pos >= size())
+        {
+            sfl::dtl::throw_out_of_range("sfl::tiered_vector::at");
+        }
+
+        return *element(pos);
+    }
+
+    SFL_NODISCARD
+    reference operator[](size_type pos) noexcept
+    {
+        SFL_ASSERT(pos < size());
+        return *element(pos);
+    }
+
+    SFL_NODISCARD
+    const_reference operator[](size_type pos) const noexcept
+    {
+        SFL_ASSERT(pos < size());
+        return *element(pos);
+    }
+
+    SFL_NODISCARD
+    reference front() noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *element(0);
+    }
+
+    SFL_NODISCARD
+    const_reference front() const noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *element(0);
+    }
+
+    SFL_NODISCARD
+    reference back() noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *element(data_.size_ - 1);
+    }
+
+    SFL_NODISCARD
+    const_reference back() const noexcept
+    {
+        SFL_ASSERT(!empty());
+        return *element(data_.size_ - 1);
+    }
+
+    //
+    // ---- MODIFIERS ---------------------------------------------------------
+    //
+
+    void clear() noexcept
+    {
+        destroy_back(data_.size_);
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+
+        const size_type p = pos.index_;
+
+        if (p == data_.size_)
+        {
+            emplace_back(std::forward<Args>(args)...);
+        }
+        else
+        {
+            // The order of operations is critical. First we will construct
+            // temporary value because arguments `args...` can contain
+            // reference to element in this container and after that
+            // we will move elements and insert new element.
+
+            value_type tmp(std::forward<Args>(args)...);
+
+            if (data_.size_ == capacity())
+            {
+                grow_storage(data_.size_ + 1);
+            }
+
+            // Segment that contains position `pos`.
+            const segment_pointer seg_p = data_.table_first_ + p / N;
+
+            // Segment that will contain the new last element.
+            segment_pointer seg = data_.table_first_ + data_.size_ / N;
+
+            if (seg == seg_p)
+            {
+                const size_type count = data_.size_ - (p / N) * N;
+
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    element(seg, count),
+                    std::move(*element(seg, count - 1))
+                );
+
+                ++data_.size_;
+
+                shift_right(seg, p % N, count - 1);
+            }
+            else
+            {
+                // The last element of the previous segment becomes
+                // the first element of the last segment.
+
+                if (data_.size_ % N == 0)
+                {
+                    seg->head_ = 0;
+                }
+
+                rotate_head_backward(seg);
+
+                sfl::dtl::construct_at_a
+                (
+                    data_.ref_to_alloc(),
+                    element(seg, 0),
+                    std::move(*element(seg - 1, N - 1))
+                );
+
+                ++data_.size_;
+
+                --seg;
+
+                // Each full segment between `pos` and the last segment
+                // gives its last element to the next segment and takes
+                // the last element of the previous segment.
+
+                while (seg != seg_p)
+                {
+                    rotate_head_backward(seg);
+
+                    *element(seg, 0) = std::move(*element(seg - 1, N - 1));
+
+                    --seg;
+                }
+
+                shift_right(seg_p, p % N, N - 1);
+            }
+
+            *element(seg_p, p % N) = std::move(tmp);
+        }
+
+        return nth(p);
+    }
+
+    iterator insert(const_iterator pos, const T& value)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type n, const T& value)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return insert_fill_n(pos, n, value);
+    }
+
+    template <typename InputIt,
+              sfl::dtl::enable_if_t<sfl::dtl::is_input_iterator<InputIt>::value>* = nullptr>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return insert_range(pos, first, last);
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> ilist)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        return insert_range(pos, ilist.begin(), ilist.end());
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    iterator insert_range(const_iterator pos, Range&& range)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+
+        if constexpr (std::ranges::forward_range<Range>)
+        {
+            return insert_range(pos, std::ranges::begin(range), std::ranges::end(range), std::forward_iterator_tag());
+        }
+        else
+        {
+            return insert_range(pos, std::ranges::begin(range), std::ranges::end(range), std::input_iterator_tag());
+        }
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    iterator insert_range(const_iterator pos, Range&& range)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos <= cend());
+        using std::begin;
+        using std::end;
+        return insert_range(pos, begin(range), end(range));
+    }
+
+#endif // before C++20
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)
+    {
+        if (data_.size_ == capacity())
+        {
+            grow_storage(data_.size_ + 1);
+        }
+
+        const segment_pointer seg = data_.table_first_ + data_.size_ / N;
+
+        const size_type j = data_.size_ % N;
+
+        if (j == 0)
+        {
+            seg->head_ = 0;
+        }
+
+        const pointer p = element(seg, j);
+
+        sfl::dtl::construct_at_a
+        (
+            data_.ref_to_alloc(),
+            p,
+            std::forward<Args>(args)...
+        );
+
+        ++data_.size_;
+
+        return *p;
+    }
+
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void append_range(Range&& range)
+    {
+        insert_range(end(), std::forward<Range>(range));
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    void append_range(Range&& range)
+    {
+        insert_range(end(), std::forward<Range>(range));
+    }
+
+#endif // before C++20
+
+    void pop_back()
+    {
+        SFL_ASSERT(!empty());
+        destroy_back(1);
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        SFL_ASSERT(cbegin() <= pos && pos < cend());
+
+        const size_type p = pos.index_;
+
+        // Segment that contains position `pos`.
+        const segment_pointer seg_p = data_.table_first_ + p / N;
+
+        // Segment that contains the last element.
+        const segment_pointer seg_last = data_.table_first_ + (data_.size_ - 1) / N;
+
+        if (seg_p == seg_last)
+        {
+            shift_left(seg_p, p % N, data_.size_ - (p / N) * N - 1);
+        }
+        else
+        {
+            shift_left(seg_p, p % N, N - 1);
+
+            *element(seg_p, N - 1) = std::move(*element(seg_p + 1, 0));
+
+            // Each full segment between `pos` and the last segment gives
+            // its first element to the previous segment and takes the
+            // first element of the next segment.
+
+            segment_pointer seg = seg_p + 1;
+
+            while (seg != seg_last)
+            {
+                rotate_head_forward(seg);
+
+                *element(seg, N - 1) = std::move(*element(seg + 1, 0));
+
+                ++seg;
+            }
+
+            // The first element of the last segment was moved to the
+            // previous segment. The last segment loses its first element.
+
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), element(seg, 0));
+
+            rotate_head_forward(seg);
+
+            --data_.size_;
+
+            return nth(p);
+        }
+
+        destroy_back(1);
+
+        return nth(p);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        SFL_ASSERT(cbegin() <= first && first <= last && last <= cend());
+
+        const size_type p = first.index_;
+        const size_type n = last.index_ - first.index_;
+
+        if (n == 1)
+        {
+            return erase(first);
+        }
+
+        if (n != 0)
+        {
+            std::move(nth(p + n), end(), nth(p));
+
+            destroy_back(n);
+        }
+
+        return nth(p);
+    }
+
+    void resize(size_type n)
+    {
+        if (n <= data_.size_)
+        {
+            destroy_back(data_.size_ - n);
+        }
+        else
+        {
+            reserve(n);
+
+            const size_type old_size = data_.size_;
+
+            SFL_TRY
+            {
+                while (data_.size_ != n)
+                {
+                    emplace_back();
+                }
+            }
+            SFL_CATCH (...)
+            {
+                destroy_back(data_.size_ - old_size);
+                SFL_RETHROW;
+            }
+        }
+    }
+
+    void resize(size_type n, const T& value)
+    {
+        if (n <= data_.size_)
+        {
+            destroy_back(data_.size_ - n);
+        }
+        else
+        {
+            insert_fill_n(cend(), n - data_.size_, value);
+        }
+    }
+
+    void swap(tiered_vector& other) noexcept
+    {
+        SFL_ASSERT
+        (
+            sfl::dtl::allocator_traits<allocator_type>::propagate_on_container_swap::value ||
+            this->data_.ref_to_alloc() == other.data_.ref_to_alloc()
+        );
+
+        if (this == &other)
+        {
+            return;
+        }
+
+        using std::swap;
+
+        if (sfl::dtl::allocator_traits<allocator_type>::propagate_on_container_swap::value)
+        {
+            swap(this->data_.ref_to_alloc(), other.data_.ref_to_alloc());
+        }
+
+        swap(this->data_.ref_to_storage(), other.data_.ref_to_storage());
+    }
+
+private:
+
+    // Returns pointer to the element with logical index `j` in given segment.
+    //
+    static pointer element(segment_pointer seg, size_type j) noexcept
+    {
+        size_type k = seg->head_ + j;
+
+        if (k >= N)
+        {
+            k -= N;
+        }
+
+        return seg->elements_ + k;
+    }
+
+    // Returns pointer to the element at given position.
+    //
+    pointer element(size_type pos) const noexcept
+    {
+        return element(data_.table_first_ + pos / N, pos % N);
+    }
+
+    // The last element of full segment becomes its first element.
+    //
+    static void rotate_head_backward(segment_pointer seg) noexcept
+    {
+        seg->head_ = (seg->head_ == 0) ? N - 1 : seg->head_ - 1;
+    }
+
+    // The first element of full segment becomes its last element.
+    //
+    static void rotate_head_forward(segment_pointer seg) noexcept
+    {
+        seg->head_ = (seg->head_ == N - 1) ? 0 : seg->head_ + 1;
+    }
+
+    // Moves elements with logical indexes [first, last) in given segment
+    // one position to the right. Element at index `first` is left in
+    // moved-from state.
+    //
+    static void shift_right(segment_pointer seg, size_type first, size_type last)
+    {
+        while (last != first)
+        {
+            *element(seg, last) = std::move(*element(seg, last - 1));
+            --last;
+        }
+    }
+
+    // Moves elements with logical indexes (first, last] in given segment
+    // one position to the left. Element at index `last` is left in
+    // moved-from state.
+    //
+    static void shift_left(segment_pointer seg, size_type first, size_type last)
+    {
+        while (first != last)
+        {
+            *element(seg, first) = std::move(*element(seg, first + 1));
+            ++first;
+        }
+    }
+
+    // Destroys the last `n` elements.
+    //
+    void destroy_back(size_type n) noexcept
+    {
+        SFL_ASSERT(n <= data_.size_);
+
+        while (n != 0)
+        {
+            --data_.size_;
+            sfl::dtl::destroy_at_a(data_.ref_to_alloc(), element(data_.size_));
+            --n;
+        }
+    }
+
+    // Allocates table for at least given number of elements (segments).
+    // It does not construct any element (segment).
+    // It only allocates memory for table.
+    //
+    sfl::dtl::allocation_result<segment_pointer, size_type> allocate_table(size_type n)
+    {
+        segment_allocator seg_alloc(data_.ref_to_alloc());
+        return sfl::dtl::allocate_at_least(seg_alloc, n);
+    }
+
+    // Deallocates table.
+    // It does not destroy_a any element (segment).
+    // It only deallocates memory used by table.
+    //
+    void deallocate_table(segment_pointer p, size_type n) noexcept
+    {
+        segment_allocator seg_alloc(data_.ref_to_alloc());
+        sfl::dtl::deallocate(seg_alloc, p, n);
+    }
+
+    // Allocates memory for multiple segments.
+    // It does not construct any element.
+    // It only allocates memory for segments.
+    //
+    void allocate_segments(segment_pointer first, segment_pointer last)
+    {
+        segment_pointer curr = first;
+
+        SFL_TRY
+        {
+            while (curr != last)
+            {
+                curr->elements_ = sfl::dtl::allocate(data_.ref_to_alloc(), N);
+                curr->head_ = 0;
+                ++curr;
+            }
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_segments(first, curr);
+            SFL_RETHROW;
+        }
+    }
+
+    // Deallocates memory used by multiple segments.
+    // It does not destroy_a any element.
+    // It only deallocates memory used by segments.
+    //
+    void deallocate_segments(segment_pointer first, segment_pointer last) noexcept
+    {
+        while (first != last)
+        {
+            sfl::dtl::deallocate(data_.ref_to_alloc(), first->elements_, N);
+            ++first;
+        }
+    }
+
+    static constexpr size_type min_table_capacity() noexcept
+    {
+        return 8;
+    }
+
+    // Deallocates storage.
+    // It does not destroy_a any element.
+    // It only deallocates memory.
+    //
+    void deallocate_storage() noexcept
+    {
+        deallocate_segments
+        (
+            data_.table_first_,
+            data_.table_last_
+        );
+
+        deallocate_table
+        (
+            data_.table_first_,
+            std::distance(data_.table_first_, data_.table_eos_)
+        );
+    }
+
+    // Sets pointers to null. It must be called after `deallocate_storage`.
+    //
+    void reset_storage() noexcept
+    {
+        data_.table_first_ = nullptr;
+        data_.table_last_  = nullptr;
+        data_.table_eos_   = nullptr;
+    }
+
+    // Increases capacity so that it is at least given number of elements.
+    // It does not construct any element.
+    // It only allocates memory.
+    //
+    void grow_storage(size_type new_capacity)
+    {
+        if (new_capacity > max_size())
+        {
+            sfl::dtl::throw_length_error("sfl::tiered_vector::grow_storage");
+        }
+
+        // Required size of table
+        const size_type table_required =
+            new_capacity / N + (new_capacity % N == 0 ? 0 : 1);
+
+        const size_type table_size =
+            std::distance(data_.table_first_, data_.table_last_);
+
+        const size_type table_capacity =
+            std::distance(data_.table_first_, data_.table_eos_);
+
+        // Increase table capacity if neccessary
+        if (table_required > table_capacity)
+        {
+            const size_type new_table_capacity = std::max
+            ({
+                table_capacity + table_capacity / 2,
+                table_required,
+                min_table_capacity()
+            });
+
+            // Allocate new table. No effects if allocation fails.
+            const auto new_table = allocate_table(new_table_capacity);
+
+            const segment_pointer new_table_first = new_table.ptr;
+
+            // Initialize LAST element in new table (noexecept).
+            const segment_pointer new_table_last = sfl::dtl::copy
+            (
+                data_.table_first_,
+                data_.table_last_,
+                new_table_first
+            );
+
+            // Deallocate old table (noexecept).
+            deallocate_table(data_.table_first_, table_capacity);
+
+            // Update pointers (noexcept).
+            data_.table_first_ = new_table_first;
+            data_.table_last_  = new_table_last;
+            data_.table_eos_   = new_table_first + new_table.count;
+        }
+
+        const segment_pointer new_table_last =
+            data_.table_first_ + std::max(table_size, table_required);
+
+        // Allocate additional segments. No effects if allocation fails.
+        allocate_segments(data_.table_last_, new_table_last);
+
+        // Update table (noexcept).
+        data_.table_last_ = new_table_last;
+    }
+
+    // Removes unused capacity.
+    // It does not destroy_a any element.
+    // It only deallocates memory.
+    //
+    void shrink_storage()
+    {
+        const size_type table_size =
+            data_.size_ / N + (data_.size_ % N == 0 ? 0 : 1);
+
+        // Deallocate empty segments.
+        {
+            const segment_pointer new_table_last = data_.table_first_ + table_size;
+
+            deallocate_segments(new_table_last, data_.table_last_);
+
+            data_.table_last_ = new_table_last;
+        }
+
+        // Shrink table.
+        {
+            const size_type table_capacity =
+                std::distance(data_.table_first_, data_.table_eos_);
+
+            if (table_size == table_capacity)
+            {
+                return;
+            }
+
+            // Allocate new table. No effects if allocation fails.
+            const auto new_table = allocate_table(table_size);
+
+            const segment_pointer new_table_first = new_table.ptr;
+
+            // Initialize LAST element in new table (noexecept).
+            const segment_pointer new_table_last = sfl::dtl::copy
+            (
+                data_.table_first_,
+                data_.table_last_,
+                new_table_first
+            );
+
+            // Deallocate old table (noexecept).
+            deallocate_table(data_.table_first_, table_capacity);
+
+            // Update pointers (noexcept).
+            data_.table_first_ = new_table_first;
+            data_.table_last_  = new_table_last;
+            data_.table_eos_   = new_table_first + new_table.count;
+        }
+    }
+
+    void initialize_default_n(size_type n)
+    {
+        SFL_TRY
+        {
+            resize(n);
+        }
+        SFL_CATCH (...)
+        {
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    void initialize_fill_n(size_type n, const T& value)
+    {
+        SFL_TRY
+        {
+            reserve(n);
+
+            while (data_.size_ != n)
+            {
+                emplace_back(value);
+            }
+        }
+        SFL_CATCH (...)
+        {
+            clear();
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+    template <typename InputIt>
+    void initialize_range(InputIt first, InputIt last)
+    {
+        initialize_range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    template <typename InputIt, typename Sentinel, typename IteratorTag>
+    void initialize_range(InputIt first, Sentinel last, IteratorTag tag)
+    {
+        SFL_TRY
+        {
+            append(std::move(first), last, tag);
+        }
+        SFL_CATCH (...)
+        {
+            clear();
+            deallocate_storage();
+            SFL_RETHROW;
+        }
+    }
+
+#if SFL_CPP_VERSION >= SFL_CPP_20
+
+    template <sfl::dtl::container_compatible_range<value_type> Range>
+    void initialize_range(Range&& range)
+    {
+        if constexpr (std::ranges::forward_range<Range>)
+        {
+            initialize_range(std::ranges::begin(range), std::ranges::end(range), std::forward_iterator_tag());
+        }
+        else
+        {
+            initialize_range(std::ranges::begin(range), std::ranges::end(range), std::input_iterator_tag());
+        }
+    }
+
+#else // before C++20
+
+    template <typename Range>
+    void initialize_range(Range&& range)
+    {
+        using std::begin;
+        using std::end;
+        initialize_range(begin(range), end(range));
+    }
+
+#endif // before C++20
+
+    void initialize_move(tiered_vector& other)
+    {
+        if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            using std::swap;
+            swap(data_.ref_to_storage(), other.data_.ref_to_storage());
+        }
+        else
+        {
+            initialize_range
+            (
+                std::make_move_iterator(other.begin()),
+                std::make_move_iterator(other.end())
+            );
+        }
+    }
+
+    // Appends elements from range [first, last).
+    //
+    template <typename InputIt, typename Sentinel>
+    void append(InputIt first, Sentinel last, std::input_iterator_tag)
+    {
+        while (first != last)
+        {
+            emplace_back(*first);
+            ++first;
+        }
+    }
+
+    template <typename ForwardIt, typename Sentinel>
+    void append(ForwardIt first, Sentinel last, std::forward_iterator_tag)
+    {
+        const size_type n = std::distance(first, last);
+
+        if (n > max_size() - data_.size_)
+        {
+            sfl::dtl::throw_length_error("sfl::tiered_vector::append");
+        }
+
+        reserve(data_.size_ + n);
+
+        while (first != last)
+        {
+            emplace_back(*first);
+            ++first;
+        }
+    }
+
+    void assign_fill_n(size_type n, const T& value)
+    {
+        const size_type size = this->size();
+
+        for (size_type i = 0; i < n && i < size; ++i)
+        {
+            *element(i) = value;
+        }
+
+        resize(n, value);
+    }
+
+    template <typename InputIt>
+    void assign_range(InputIt first, InputIt last)
+    {
+        assign_range(first, last, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    template <typename InputIt, typename Sentinel, typename IteratorTag>
+    void assign_range(InputIt first, Sentinel last, IteratorTag tag)
+    {
+        size_type i = 0;
+
+        while (first != last && i != data_.size_)
+        {
+            *element(i) = *first;
+            ++first;
+            ++i;
+        }
+
+        if (first != last)
+        {
+            append(std::move(first), last, tag);
+        }
+        else
+        {
+            destroy_back(data_.size_ - i);
+        }
+    }
+
+    void assign_copy(const tiered_vector& other)
+    {
+        if (this != &other)
+        {
+            if (sfl::dtl::allocator_traits<allocator_type>::propagate_on_container_copy_assignment::value)
+            {
+                if (data_.ref_to_alloc() != other.data_.ref_to_alloc())
+                {
+                    // Clear and deallocate current storage (noexcept).
+                    clear();
+                    deallocate_storage();
+                    reset_storage();
+                }
+
+                // Propagate allocator (noexcept).
+                data_.ref_to_alloc() = other.data_.ref_to_alloc();
+            }
+
+            assign_range(other.begin(), other.end());
+        }
+    }
+
+    void assign_move(tiered_vector& other)
+    {
+        if (data_.ref_to_alloc() == other.data_.ref_to_alloc())
+        {
+            // Clear and deallocate current storage (noexcept).
+            clear();
+            deallocate_storage();
+            reset_storage();
+
+            // Take storage of "other". After that "other" has no allocated
+            // storage (pointers are null) and it is empty.
+            using std::swap;
+            swap(data_.ref_to_storage(), other.data_.ref_to_storage());
+
+            if (sfl::dtl::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value)
+            {
+                // Propagate allocator (noexcept).
+                data_.ref_to_alloc() = std::move(other.data_.ref_to_alloc());
+            }
+        }
+        else
+        {
+            if (sfl::dtl::allocator_traits<allocator_type>::propagate_on_container_move_assignment::value)
+            {
+                // Clear and deallocate current storage (noexcept).
+                clear();
+                deallocate_storage();
+                reset_storage();
+
+                // Propagate allocator (noexcept).
+                data_.ref_to_alloc() = std::move(other.data_.ref_to_alloc());
+            }
+
+            // Move elements one-by-one from "other" to "this" (can throw)
+            assign_range
+            (
+                std::make_move_iterator(other.begin()),
+                std::make_move_iterator(other.end())
+            );
+        }
+    }
+
+    iterator insert_fill_n(const_iterator pos, size_type n, const T& value)
+    {
+        const size_type p = pos.index_;
+
+        if (n == 1)
+        {
+            return emplace(pos, value);
+        }
+
+        if (n != 0)
+        {
+            if (n > max_size() - data_.size_)
+            {
+                sfl::dtl::throw_length_error("sfl::tiered_vector::insert_fill_n");
+            }
+
+            const value_type tmp(value);
+
+            const size_type old_size = data_.size_;
+
+            reserve(old_size + n);
+
+            SFL_TRY
+            {
+                while (data_.size_ != old_size + n)
+                {
+                    emplace_back(tmp);
+                }
+            }
+            SFL_CATCH (...)
+            {
+                destroy_back(data_.size_ - old_size);
+                SFL_RETHROW;
+            }
+
+            std::rotate(nth(p), nth(old_size), end());
+        }
+
+        return nth(p);
+    }
+
+    template <typename InputIt>
+    iterator insert_range(const_iterator pos, InputIt first, InputIt last)
+    {
+        return insert_range(pos, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+    }
+
+    template <typename InputIt, typename Sentinel, typename IteratorTag>
+    iterator insert_range(const_iterator pos, InputIt first, Sentinel last, IteratorTag tag)
+    {
+        const size_type p = pos.index_;
+
+        const size_type old_size = data_.size_;
+
+        SFL_TRY
+        {
+            append(std::move(first), last, tag);
+        }
+        SFL_CATCH (...)
+        {
+            destroy_back(data_.size_ - old_size);
+            SFL_RETHROW;
+        }
+
+        if (data_.size_ - old_size == 1)
+        {
+            // Single element is moved to its position using the same
+            // algorithm as in `emplace`.
+            value_type tmp(std::move(back()));
+            pop_back();
+            return emplace(nth(p), std::move(tmp));
+        }
+
+        std::rotate(nth(p), nth(old_size), end());
+
+        return nth(p);
+    }
+};
+
+//
+// ---- NON-MEMBER FUNCTIONS --------------------------------------------------
+//
+
+template <typename T, std::size_t N, typename A>
+SFL_NODISCARD
+bool operator==
+(
+    const tiered_vector<T, N, A>& x,
+    const tiered_vector<T, N, A>& y
+)
+{
+    return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
+}
+
+template <typename T, std::size_t N, typename A>
+SFL_NODISCARD
+bool operator!=
+(
+    const tiered_vector<T, N, A>& x,
+    const tiered_vector<T, N, A>& y
+)
+{
+    return !(x == y);
+}
+
+template <typename T, std::size_t N, typename A>
+SFL_NODISCARD
+bool operator<
+(
+    const tiered_vector<T, N, A>& x,
+    const tiered_vector<T, N, A>& y
+)
+{
+    return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
+}
+
+template <typename T, std::size_t N, typename A>
+SFL_NODISCARD
+bool operator>
+(
+    const tiered_vector<T, N, A>& x,
+    const tiered_vector<T, N, A>& y
+)
+{
+    return y < x;
+}
+
+template <typename T, std::size_t N, typename A>
+SFL_NODISCARD
+bool operator<=
+(
+    const tiered_vector<T, N, A>& x,
+    const tiered_vector<T, N, A>& y
+)
+{
+    return !(y < x);
+}
+
+template <typename T, std::size_t N, typename A>
+SFL_NODISCARD
+bool operator>=
+(
+    const tiered_vector<T, N, A>& x,
+    const tiered_vector<T, N, A>& y
+)
+{
+    return !(x < y);
+}
+
+template <typename T, std::size_t N, typename A>
+void swap
+(
+    tiered_vector<T, N, A>& x,
+    tiered_vector<T, N, A>& y
+)
+{
+    x.swap(y);
+}
+
+template <typename T, std::size_t N, typename A, typename U>
+typename tiered_vector<T, N, A>::size_type
+    erase(tiered_vector<T, N, A>& c, const U& value)
+{
+    auto it = std::remove(c.begin(), c.end(), value);
+    auto r = std::distance(it, c.end());
+    c.erase(it, c.end());
+    return r;
+}
+
+template <typename T, std::size_t N, typename A, typename Predicate>
+typename tiered_vector<T, N, A>::size_type
+    erase_if(tiered_vector<T, N, A>& c, Predicate pred)
+{
+    auto it = std::remove_if(c.begin(), c.end(), pred);
+    auto r = std::distance(it, c.end());
+    c.erase(it, c.end());
+    return r;
+}
+
+} // namespace sfl
+
+#endif // SFL_TIERED_VECTOR_HPP_INCLUDED
@@ -40,10 +40,15 @@
 namespace sfl
 {
 
+template <typename Key, typename Hash, typename KeyEqual, typename Allocator, bool StoreHash, bool IncrementalRehash>
+class unordered_multiset;
+
 template < typename Key,
            typename Hash = std::hash<Key>,
            typename KeyEqual = std::equal_to<Key>,
-           typename Allocator = std::allocator<Key> >
+           typename Allocator = std::allocator<Key>,
+           bool StoreHash = false,
+           bool IncrementalRehash = false >
 class unordered_set
 {
 public:
@@ -76,7 +81,9 @@ private:
         node_allocator_type,
         bucket_allocator_type,
         bucket_count_policy,
-        max_load_policy
+        max_load_policy,
+        StoreHash,
+        IncrementalRehash
     >;
 
     hash_table hash_table_;
@@ -91,6 +98,8 @@ public:
     using const_iterator       = typename hash_table::const_iterator;
     using local_iterator       = typename hash_table::const_local_iterator; // MUST BE const
     using const_local_iterator = typename hash_table::const_local_iterator;
+    using node_type            = sfl::dtl::set_node_handle<Key, allocator_type, typename hash_table::node_handle_node_type>;
+    using insert_return_type   = sfl::dtl::node_insert_return_type<iterator, node_type>;
 
 private:
 
@@ -531,6 +540,16 @@ public:
         insert_range_aux(ilist.begin(), ilist.end());
     }
 
+    insert_return_type insert(node_type&& nh)
+    {
+        return hash_table_.template insert_node_handle_unique<insert_return_type>(std::move(nh));
+    }
+
+    iterator insert(const_iterator hint, node_type&& nh)
+    {
+        return hash_table_.insert_node_handle_hint_unique(hint, std::move(nh));
+    }
+
 #if SFL_CPP_VERSION >= SFL_CPP_20
 
     template <sfl::dtl::container_compatible_range<value_type> Range>
@@ -579,6 +598,50 @@ public:
         hash_table_.swap(other.hash_table_);
     }
 
+    node_type extract(const_iterator pos)
+    {
+        return hash_table_.template extract_unique<node_type>(pos);
+    }
+
+    node_type extract(const Key& key)
+    {
+        return hash_table_.template extract_key_unique<node_type>(key);
+    }
+
+    template <typename K,
+              sfl::dtl::enable_if_t< sfl::dtl::has_is_transparent<Hash, K>::value &&
+                                     sfl::dtl::has_is_transparent<KeyEqual, K>::value &&
+                                     !std::is_convertible<K&&, const_iterator>::value &&
+                                     !std::is_convertible<K&&, iterator>::value >* = nullptr>
+    node_type extract(K&& x)
+    {
+        return hash_table_.template extract_key_unique<node_type>(x);
+    }
+
+    template <typename Hash2, typename KeyEqual2, bool IncrementalRehash2>
+    void merge(unordered_set<Key, Hash2, KeyEqual2, Allocator, StoreHash, IncrementalRehash2>& source)
+    {
+        hash_table_.merge_unique(source.hash_table_);
+    }
+
+    template <typename Hash2, typename KeyEqual2, bool IncrementalRehash2>
+    void merge(unordered_set<Key, Hash2, KeyEqual2, Allocator, StoreHash, IncrementalRehash2>&& source)
+    {
+        hash_table_.merge_unique(source.hash_table_);
+    }
+
+    template <typename Hash2, typename KeyEqual2, bool IncrementalRehash2>
+    void merge(unordered_multiset<Key, Hash2, KeyEqual2, Allocator, StoreHash, IncrementalRehash2>& source)
+    {
+        hash_table_.merge_unique(source.hash_table_);
+    }
+
+    template <typename Hash2, typename KeyEqual2, bool IncrementalRehash2>
+    void merge(unordered_multiset<Key, Hash2, KeyEqual2, Allocator, StoreHash, IncrementalRehash2>&& source)
+    {
+        hash_table_.merge_unique(source.hash_table_);
+    }
+
     //
     // ---- LOOKUP ------------------------------------------------------------
     //
@@ -673,12 +736,30 @@ public:
         return hash_table_.contains(x);
     }
 
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+    {
+        return hash_table_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return hash_table_.find_batch(first, last, out);
+    }
+
+    template <typename ForwardIt, typename OutputIt>
+    OutputIt contains_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+    {
+        return hash_table_.contains_batch(first, last, out);
+    }
+
     //
     // ---- BUCKET INTERFACE --------------------------------------------------
     //
 
     SFL_NODISCARD
-    local_iterator begin(size_type n) noexcept
+    local_iterator begin(size_type n) noexcept(!IncrementalRehash)
     {
         return hash_table_.begin(n);
     }
@@ -725,6 +806,12 @@ public:
         return hash_table_.max_bucket_count();
     }
 
+    SFL_NODISCARD
+    size_type bucket_size(size_type n)
+    {
+        return hash_table_.bucket_size(n);
+    }
+
     SFL_NODISCARD
     size_type bucket_size(size_type n) const
     {
@@ -789,52 +876,58 @@ private:
         }
     }
 
-    template <typename K2, typename H2, typename E2, typename A2>
-    friend bool operator==(const unordered_set<K2, H2, E2, A2>& x, const unordered_set<K2, H2, E2, A2>& y);
+    template <typename, typename, typename, typename, bool, bool>
+    friend class unordered_set;
+
+    template <typename, typename, typename, typename, bool, bool>
+    friend class unordered_multiset;
+
+    template <typename K2, typename H2, typename E2, typename A2, bool S2, bool R2>
+    friend bool operator==(const unordered_set<K2, H2, E2, A2, S2, R2>& x, const unordered_set<K2, H2, E2, A2, S2, R2>& y);
 
-    template <typename K2, typename H2, typename E2, typename A2>
-    friend bool operator!=(const unordered_set<K2, H2, E2, A2>& x, const unordered_set<K2, H2, E2, A2>& y);
+    template <typename K2, typename H2, typename E2, typename A2, bool S2, bool R2>
+    friend bool operator!=(const unordered_set<K2, H2, E2, A2, S2, R2>& x, const unordered_set<K2, H2, E2, A2, S2, R2>& y);
 };
 
 //
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename K, typename H, typename E, typename A>
+template <typename K, typename H, typename E, typename A, bool S, bool R>
 SFL_NODISCARD
 bool operator==
 (
-    const unordered_set<K, H, E, A>& x,
-    const unordered_set<K, H, E, A>& y
+    const unordered_set<K, H, E, A, S, R>& x,
+    const unordered_set<K, H, E, A, S, R>& y
 )
 {
     return x.hash_table_ == y.hash_table_;
 }
 
-template <typename K, typename H, typename E, typename A>
+template <typename K, typename H, typename E, typename A, bool S, bool R>
 SFL_NODISCARD
 bool operator!=
 (
-    const unordered_set<K, H, E, A>& x,
-    const unordered_set<K, H, E, A>& y
+    const unordered_set<K, H, E, A, S, R>& x,
+    const unordered_set<K, H, E, A, S, R>& y
 )
 {
     return x.hash_table_ != y.hash_table_;
 }
 
-template <typename K, typename H, typename E, typename A>
+template <typename K, typename H, typename E, typename A, bool S, bool R>
 void swap
 (
-    unordered_set<K, H, E, A>& x,
-    unordered_set<K, H, E, A>& y
+    unordered_set<K, H, E, A, S, R>& x,
+    unordered_set<K, H, E, A, S, R>& y
 )
 {
     x.swap(y);
 }
 
-template <typename K, typename H, typename E, typename A, typename Predicate>
-typename unordered_set<K, H, E, A>::size_type
-    erase_if(unordered_set<K, H, E, A>& c, Predicate pred)
+template <typename K, typename H, typename E, typename A, bool S, bool R, typename Predicate>
+typename unordered_set<K, H, E, A, S, R>::size_type
+    erase_if(unordered_set<K, H, E, A, S, R>& c, Predicate pred)
 {
     auto old_size = c.size();
 
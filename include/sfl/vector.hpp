@@ -23,7 +23,6 @@
 
 #include <sfl/detail/algorithm/copy.hpp>
 #include <sfl/detail/algorithm/fill.hpp>
-#include <sfl/detail/algorithm/move.hpp>
 #include <sfl/detail/algorithm/move_backward.hpp>
 #include <sfl/detail/concepts/container_compatible_range.hpp>
 #include <sfl/detail/memory/allocate.hpp>
@@ -32,19 +31,22 @@
 #include <sfl/detail/memory/destroy_a.hpp>
 #include <sfl/detail/memory/destroy_at_a.hpp>
 #include <sfl/detail/memory/destroy_n_a.hpp>
+#include <sfl/detail/memory/relocate_a.hpp>
 #include <sfl/detail/memory/to_address.hpp>
 #include <sfl/detail/memory/uninitialized_copy_a.hpp>
 #include <sfl/detail/memory/uninitialized_default_construct_n_a.hpp>
+#include <sfl/detail/memory/uninitialized_default_init_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_fill_a.hpp>
 #include <sfl/detail/memory/uninitialized_fill_n_a.hpp>
 #include <sfl/detail/memory/uninitialized_move_a.hpp>
-#include <sfl/detail/memory/uninitialized_move_if_noexcept_a.hpp>
+#include <sfl/detail/tags/default_init_t.hpp>
 #include <sfl/detail/tags/from_range_t.hpp>
 #include <sfl/detail/type_traits/enable_if_t.hpp>
 #include <sfl/detail/type_traits/is_input_iterator.hpp>
 #include <sfl/detail/allocator_traits.hpp>
 #include <sfl/detail/cpp.hpp>
 #include <sfl/detail/exceptions.hpp>
+#include <sfl/detail/growth_policy.hpp>
 #include <sfl/detail/normal_iterator.hpp>
 
 #include <algorithm>        // copy, move, swap, swap_ranges
@@ -58,12 +60,15 @@
 namespace sfl
 {
 
-template <typename T, typename Allocator = std::allocator<T>>
+template < typename T,
+           typename Allocator = std::allocator<T>,
+           typename GrowthPolicy = sfl::growth_factor_1_5 >
 class vector
 {
 public:
 
     using allocator_type         = Allocator;
+    using growth_policy          = GrowthPolicy;
     using value_type             = T;
     using size_type              = typename sfl::dtl::allocator_traits<allocator_type>::size_type;
     using difference_type        = typename sfl::dtl::allocator_traits<allocator_type>::difference_type;
@@ -488,13 +493,14 @@ public:
 
         if (new_cap > capacity())
         {
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_first = new_storage.ptr;
             pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
+            pointer new_eos   = new_first + new_storage.count;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -508,13 +514,13 @@ public:
                 (
                     data_.ref_to_alloc(),
                     new_first,
-                    new_cap
+                    std::distance(new_first, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -540,13 +546,14 @@ public:
 
         if (new_cap < capacity())
         {
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_first = new_storage.ptr;
             pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
+            pointer new_eos   = new_first + new_storage.count;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -560,13 +567,13 @@ public:
                 (
                     data_.ref_to_alloc(),
                     new_first,
-                    new_cap
+                    std::distance(new_first, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -708,27 +715,13 @@ public:
                 // create new element now as a temporary value.
                 value_type tmp(std::forward<Args>(args)...);
 
-                const pointer p2 = data_.last_ - 1;
-
-                const pointer old_last = data_.last_;
-
-                sfl::dtl::construct_at_a
+                sfl::dtl::insert_shift_a
                 (
                     data_.ref_to_alloc(),
-                    data_.last_,
-                    std::move(*p2)
-                );
-
-                ++data_.last_;
-
-                sfl::dtl::move_backward
-                (
                     p1,
-                    p2,
-                    old_last
+                    data_.last_,
+                    std::move(tmp)
                 );
-
-                *p1 = std::move(tmp);
             }
 
             return iterator(p1);
@@ -739,9 +732,10 @@ public:
 
             const size_type new_cap = calculate_new_capacity(1, "sfl::vector::emplace");
 
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_first = new_storage.ptr;
             pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
+            pointer new_eos   = new_first + new_storage.count;
 
             const pointer p = new_first + offset;
 
@@ -756,7 +750,7 @@ public:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -766,7 +760,7 @@ public:
 
                 ++new_last;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -798,13 +792,13 @@ public:
                 (
                     data_.ref_to_alloc(),
                     new_first,
-                    new_cap
+                    std::distance(new_first, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -909,9 +903,10 @@ public:
         {
             const size_type new_cap = calculate_new_capacity(1, "sfl::vector::emplace_back");
 
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_first = new_storage.ptr;
             pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
+            pointer new_eos   = new_first + new_storage.count;
 
             const pointer p = new_first + size();
 
@@ -926,7 +921,7 @@ public:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -955,13 +950,13 @@ public:
                 (
                     data_.ref_to_alloc(),
                     new_first,
-                    new_cap
+                    std::distance(new_first, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -1026,9 +1021,7 @@ public:
 
         const pointer p = pos.base();
 
-        data_.last_ = sfl::dtl::move(p + 1, data_.last_, p);
-
-        sfl::dtl::destroy_at_a(data_.ref_to_alloc(), data_.last_);
+        data_.last_ = sfl::dtl::erase_shift_a(data_.ref_to_alloc(), p, p + 1, data_.last_);
 
         return iterator(p);
     }
@@ -1045,11 +1038,7 @@ public:
         const pointer p1 = first.base();
         const pointer p2 = last.base();
 
-        const pointer new_last = sfl::dtl::move(p2, data_.last_, p1);
-
-        sfl::dtl::destroy_a(data_.ref_to_alloc(), new_last, data_.last_);
-
-        data_.last_ = new_last;
+        data_.last_ = sfl::dtl::erase_shift_a(data_.ref_to_alloc(), p1, p2, data_.last_);
 
         return iterator(p1);
     }
@@ -1079,9 +1068,10 @@ public:
 
             if (n > capacity())
             {
-                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+                pointer new_first = new_storage.ptr;
                 pointer new_last  = new_first;
-                pointer new_eos   = new_first + n;
+                pointer new_eos   = new_first + new_storage.count;
 
                 const pointer p = new_first + size;
 
@@ -1096,7 +1086,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1131,13 +1121,13 @@ public:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        n
+                        std::distance(new_first, new_eos)
                     );
 
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1167,6 +1157,41 @@ public:
         }
     }
 
+    void resize(size_type n, sfl::default_init_t)
+    {
+        check_size(n, "sfl::vector::resize");
+
+        const size_type size = this->size();
+
+        if (n < size)
+        {
+            const pointer new_last = data_.first_ + n;
+
+            sfl::dtl::destroy_a
+            (
+                data_.ref_to_alloc(),
+                new_last,
+                data_.last_
+            );
+
+            data_.last_ = new_last;
+        }
+        else if (n > size)
+        {
+            if (n > capacity())
+            {
+                reserve(n);
+            }
+
+            data_.last_ = sfl::dtl::uninitialized_default_init_n_a
+            (
+                data_.ref_to_alloc(),
+                data_.last_,
+                n - size
+            );
+        }
+    }
+
     void resize(size_type n, const T& value)
     {
         check_size(n, "sfl::vector::resize");
@@ -1192,9 +1217,10 @@ public:
 
             if (n > capacity())
             {
-                pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+                const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+                pointer new_first = new_storage.ptr;
                 pointer new_last  = new_first;
-                pointer new_eos   = new_first + n;
+                pointer new_eos   = new_first + new_storage.count;
 
                 const pointer p = new_first + size;
 
@@ -1210,7 +1236,7 @@ public:
 
                     new_last = nullptr;
 
-                    new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                    new_last = sfl::dtl::uninitialized_relocate_a
                     (
                         data_.ref_to_alloc(),
                         data_.first_,
@@ -1245,13 +1271,13 @@ public:
                     (
                         data_.ref_to_alloc(),
                         new_first,
-                        n
+                        std::distance(new_first, new_eos)
                     );
 
                     SFL_RETHROW;
                 }
 
-                sfl::dtl::destroy_a
+                sfl::dtl::destroy_relocated_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1282,6 +1308,47 @@ public:
         }
     }
 
+    T* append_uninitialized(size_type n)
+    {
+        const size_type size = this->size();
+
+        if (n > available())
+        {
+            reserve(calculate_new_capacity(n, "sfl::vector::append_uninitialized"));
+        }
+
+        resize(size + n, sfl::default_init_t());
+
+        return data() + size;
+    }
+
+    template <typename Operation>
+    void resize_and_overwrite(size_type n, Operation op)
+    {
+        const size_type size = this->size();
+
+        if (n > capacity())
+        {
+            reserve(calculate_new_capacity(n - size, "sfl::vector::resize_and_overwrite"));
+        }
+
+        resize(n, sfl::default_init_t());
+
+        SFL_TRY
+        {
+            const size_type new_size = std::move(op)(data(), n);
+
+            SFL_ASSERT(new_size <= n);
+
+            resize(new_size, sfl::default_init_t());
+        }
+        SFL_CATCH (...)
+        {
+            resize(std::min(size, n), sfl::default_init_t());
+            SFL_RETHROW;
+        }
+    }
+
     void swap(vector& other)
     {
         if (this == &other)
@@ -1332,18 +1399,13 @@ private:
         {
             sfl::dtl::throw_length_error(msg);
         }
-        else if (max_size - capacity < capacity / 2)
-        {
-            return max_size;
-        }
-        else if (size + num_additional_elements < capacity + capacity / 2)
-        {
-            return capacity + capacity / 2;
-        }
-        else
-        {
-            return size + num_additional_elements;
-        }
+
+        return GrowthPolicy::template new_capacity<T>
+        (
+            capacity,
+            size_type(size + num_additional_elements),
+            max_size
+        );
     }
 
     void reset(size_type new_cap = 0)
@@ -1371,9 +1433,10 @@ private:
         // first_, last_ and eos_ won't be dangling pointers.
         if (new_cap > 0)
         {
-            data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            data_.first_ = storage.ptr;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.first_ + new_cap;
+            data_.eos_   = data_.first_ + storage.count;
         }
     }
 
@@ -1381,9 +1444,10 @@ private:
     {
         check_size(n, "sfl::vector::initialize_default_n");
 
-        data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.first_ = storage.ptr;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.first_ + n;
+        data_.eos_   = data_.first_ + storage.count;
 
         SFL_TRY
         {
@@ -1396,7 +1460,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1405,9 +1469,10 @@ private:
     {
         check_size(n, "sfl::vector::initialize_fill_n");
 
-        data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.first_ = storage.ptr;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.first_ + n;
+        data_.eos_   = data_.first_ + storage.count;
 
         SFL_TRY
         {
@@ -1421,7 +1486,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1470,9 +1535,10 @@ private:
 
         check_size(n, "sfl::vector::initialize_range");
 
-        data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.first_ = storage.ptr;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.first_ + n;
+        data_.eos_   = data_.first_ + storage.count;
 
         SFL_TRY
         {
@@ -1486,7 +1552,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1524,9 +1590,10 @@ private:
 
         check_size(n, "sfl::vector::initialize_copy");
 
-        data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+        const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+        data_.first_ = storage.ptr;
         data_.last_  = data_.first_;
-        data_.eos_   = data_.first_ + n;
+        data_.eos_   = data_.first_ + storage.count;
 
         SFL_TRY
         {
@@ -1540,7 +1607,7 @@ private:
         }
         SFL_CATCH (...)
         {
-            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+            sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
             SFL_RETHROW;
         }
     }
@@ -1563,9 +1630,10 @@ private:
 
             check_size(n, "sfl::vector::initialize_move");
 
-            data_.first_ = sfl::dtl::allocate(data_.ref_to_alloc(), n);
+            const auto storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), n);
+            data_.first_ = storage.ptr;
             data_.last_  = data_.first_;
-            data_.eos_   = data_.first_ + n;
+            data_.eos_   = data_.first_ + storage.count;
 
             SFL_TRY
             {
@@ -1579,7 +1647,7 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, n);
+                sfl::dtl::deallocate(data_.ref_to_alloc(), data_.first_, std::distance(data_.first_, data_.eos_));
                 SFL_RETHROW;
             }
         }
@@ -1878,9 +1946,10 @@ private:
 
             const size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_fill_n");
 
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_first = new_storage.ptr;
             pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
+            pointer new_eos   = new_first + new_storage.count;
 
             const pointer p = new_first + offset;
 
@@ -1900,7 +1969,7 @@ private:
 
                 new_last = nullptr;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_,
@@ -1910,7 +1979,7 @@ private:
 
                 new_last += n;
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -1943,13 +2012,13 @@ private:
                 (
                     data_.ref_to_alloc(),
                     new_first,
-                    new_cap
+                    std::distance(new_first, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2073,31 +2142,39 @@ private:
 
             const size_type new_cap = calculate_new_capacity(n, "sfl::vector::insert_range");
 
-            pointer new_first = sfl::dtl::allocate(data_.ref_to_alloc(), new_cap);
+            const auto new_storage = sfl::dtl::allocate_at_least(data_.ref_to_alloc(), new_cap);
+            pointer new_first = new_storage.ptr;
             pointer new_last  = new_first;
-            pointer new_eos   = new_first + new_cap;
+            pointer new_eos   = new_first + new_storage.count;
 
             const pointer p = new_first + offset;
 
             SFL_TRY
             {
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                // First we will copy new elements and after that we
+                // can relocate existing elements.
+
+                sfl::dtl::uninitialized_copy_a
                 (
                     data_.ref_to_alloc(),
-                    data_.first_,
-                    data_.first_ + offset,
-                    new_first
+                    first,
+                    last,
+                    p
                 );
 
-                new_last = sfl::dtl::uninitialized_copy_a
+                new_last = nullptr;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
-                    first,
-                    last,
-                    new_last
+                    data_.first_,
+                    data_.first_ + offset,
+                    new_first
                 );
 
-                new_last = sfl::dtl::uninitialized_move_if_noexcept_a
+                new_last += n;
+
+                new_last = sfl::dtl::uninitialized_relocate_a
                 (
                     data_.ref_to_alloc(),
                     data_.first_ + offset,
@@ -2107,24 +2184,36 @@ private:
             }
             SFL_CATCH (...)
             {
-                sfl::dtl::destroy_a
-                (
-                    data_.ref_to_alloc(),
-                    new_first,
-                    new_last
-                );
+                if (new_last == nullptr)
+                {
+                    sfl::dtl::destroy_n_a
+                    (
+                        data_.ref_to_alloc(),
+                        p,
+                        n
+                    );
+                }
+                else
+                {
+                    sfl::dtl::destroy_a
+                    (
+                        data_.ref_to_alloc(),
+                        new_first,
+                        new_last
+                    );
+                }
 
                 sfl::dtl::deallocate
                 (
                     data_.ref_to_alloc(),
                     new_first,
-                    new_cap
+                    std::distance(new_first, new_eos)
                 );
 
                 SFL_RETHROW;
             }
 
-            sfl::dtl::destroy_a
+            sfl::dtl::destroy_relocated_a
             (
                 data_.ref_to_alloc(),
                 data_.first_,
@@ -2151,85 +2240,85 @@ private:
 // ---- NON-MEMBER FUNCTIONS --------------------------------------------------
 //
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator==
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return x.size() == y.size() && std::equal(x.begin(), x.end(), y.begin());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator!=
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return !(x == y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return std::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end());
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return y < x;
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator<=
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return !(y < x);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 SFL_NODISCARD
 bool operator>=
 (
-    const vector<T, A>& x,
-    const vector<T, A>& y
+    const vector<T, A, G>& x,
+    const vector<T, A, G>& y
 )
 {
     return !(x < y);
 }
 
-template <typename T, typename A>
+template <typename T, typename A, typename G>
 void swap
 (
-    vector<T, A>& x,
-    vector<T, A>& y
+    vector<T, A, G>& x,
+    vector<T, A, G>& y
 )
 {
     x.swap(y);
 }
 
-template <typename T, typename A, typename U>
-typename vector<T, A>::size_type
-    erase(vector<T, A>& c, const U& value)
+template <typename T, typename A, typename G, typename U>
+typename vector<T, A, G>::size_type
+    erase(vector<T, A, G>& c, const U& value)
 {
     auto it = std::remove(c.begin(), c.end(), value);
     auto r = std::distance(it, c.end());
@@ -2237,9 +2326,9 @@ typename vector<T, A>::size_type
     return r;
 }
 
-template <typename T, typename A, typename Predicate>
-typename vector<T, A>::size_type
-    erase_if(vector<T, A>& c, Predicate pred)
+template <typename T, typename A, typename G, typename Predicate>
+typename vector<T, A, G>::size_type
+    erase_if(vector<T, A, G>& c, Predicate pred)
 {
     auto it = std::remove_if(c.begin(), c.end(), pred);
     auto r = std::distance(it, c.end());
@@ -0,0 +1,203 @@
+#ifndef SFL_TEST_AT_LEAST_ALLOC_HPP
+#define SFL_TEST_AT_LEAST_ALLOC_HPP
+
+#include <sfl/detail/allocator_traits.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+
+namespace sfl
+{
+namespace test
+{
+
+// Stateless allocator that rounds every request up to a multiple of
+// `granularity` objects (similar to size classes of jemalloc or mimalloc)
+// and reports the real size of allocated block via `allocate_at_least`.
+template<typename T>
+class at_least_alloc
+{
+public:
+
+    using value_type      = T;
+    using pointer         = T*;
+    using const_pointer   = const T*;
+    using reference       = T&;
+    using const_reference = const T&;
+    using size_type       = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    static constexpr size_type granularity = 8;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = at_least_alloc<U>;
+    };
+
+    //
+    // ---- CONSTRUCTION AND DESTRUCTION --------------------------------------
+    //
+
+    at_least_alloc() noexcept
+    {}
+
+    at_least_alloc(const at_least_alloc& /*other*/) noexcept
+    {}
+
+    template <typename U>
+    at_least_alloc(const at_least_alloc<U>& /*other*/) noexcept
+    {}
+
+    at_least_alloc(at_least_alloc&& /*other*/) noexcept
+    {}
+
+    template <typename U>
+    at_least_alloc(at_least_alloc<U>&& /*other*/) noexcept
+    {}
+
+    ~at_least_alloc() noexcept
+    {}
+
+    //
+    // ---- ASSIGNMENT --------------------------------------------------------
+    //
+
+    at_least_alloc& operator=(const at_least_alloc& /*other*/) noexcept
+    {
+        return *this;
+    }
+
+    at_least_alloc& operator=(at_least_alloc&& /*other*/) noexcept
+    {
+        return *this;
+    }
+
+    //
+    // ---- ALLOCATE AND DEALLOACTE -------------------------------------------
+    //
+
+    T* allocate(size_type n, const void* = nullptr)
+    {
+        if (n > max_size())
+        {
+            #ifdef SFL_NO_EXCEPTIONS
+            assert(!"n > max_size()");
+            std::abort();
+            #else
+            throw std::bad_alloc();
+            #endif
+        }
+
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    sfl::dtl::allocation_result<T*, size_type> allocate_at_least(size_type n)
+    {
+        const size_type count = (n + granularity - 1) / granularity * granularity;
+        return {allocate(count), count};
+    }
+
+    void deallocate(T* p, size_type n)
+    {
+        // Container must give back the size returned by `allocate_at_least`.
+        if (n % granularity != 0)
+        {
+            assert(!"n % granularity != 0");
+            std::abort();
+        }
+
+        ::operator delete(p);
+    }
+
+    //
+    // ---- CONSTRUCT AND DESTROY ---------------------------------------------
+    //
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args) noexcept(
+        std::is_nothrow_constructible<U, Args...>::value
+    )
+    {
+        ::new ((void *)p) U(std::forward<Args>(args)...);
+    }
+
+    template <typename U>
+    void destroy(U* p) noexcept(std::is_nothrow_destructible<U>::value)
+    {
+        p->~U();
+    }
+
+    //
+    // ---- ADDRESS -----------------------------------------------------------
+    //
+
+    pointer address(reference x) const noexcept
+    {
+        return std::addressof(x);
+    }
+
+    const_pointer address(const_reference x) const noexcept
+    {
+        return std::addressof(x);
+    }
+
+    //
+    // ---- MAX SIZE ----------------------------------------------------------
+    //
+
+    size_type max_size() const noexcept
+    {
+        return std::size_t(PTRDIFF_MAX) / sizeof(T);
+    }
+
+    //
+    // ---- COMPARISONS -------------------------------------------------------
+    //
+
+    template <typename T1, typename T2>
+    friend bool operator==
+    (
+        const at_least_alloc<T1>& /*x*/,
+        const at_least_alloc<T2>& /*y*/
+    ) noexcept;
+
+    template <typename T1, typename T2>
+    friend bool operator!=
+    (
+        const at_least_alloc<T1>& /*x*/,
+        const at_least_alloc<T2>& /*y*/
+    ) noexcept;
+};
+
+template <typename T1, typename T2>
+bool operator==
+(
+    const at_least_alloc<T1>& /*x*/,
+    const at_least_alloc<T2>& /*y*/
+) noexcept
+{
+    return true;
+}
+
+template <typename T1, typename T2>
+bool operator!=
+(
+    const at_least_alloc<T1>& /*x*/,
+    const at_least_alloc<T2>& /*y*/
+) noexcept
+{
+    return false;
+}
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_AT_LEAST_ALLOC_HPP
@@ -0,0 +1,90 @@
+#ifndef SFL_TEST_COUNTING_ALLOC_HPP
+#define SFL_TEST_COUNTING_ALLOC_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace sfl
+{
+namespace test
+{
+
+// Allocator that counts how many times memory has been allocated and how
+// many elements have been constructed and destroyed through its member
+// functions `construct` and `destroy`.
+template <typename T>
+class counting_alloc
+{
+public:
+
+    using value_type = T;
+
+    static std::size_t& num_allocations()
+    {
+        static std::size_t n = 0;
+        return n;
+    }
+
+    static std::size_t& num_constructed()
+    {
+        static std::size_t n = 0;
+        return n;
+    }
+
+    static std::size_t& num_destroyed()
+    {
+        static std::size_t n = 0;
+        return n;
+    }
+
+    counting_alloc() noexcept
+    {}
+
+    template <typename U>
+    counting_alloc(const counting_alloc<U>& /*other*/) noexcept
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        ++num_allocations();
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T* p, std::size_t)
+    {
+        ::operator delete(p);
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new ((void *)p) U(std::forward<Args>(args)...);
+        ++num_constructed();
+    }
+
+    template <typename U>
+    void destroy(U* p)
+    {
+        p->~U();
+        ++num_destroyed();
+    }
+};
+
+template <typename T1, typename T2>
+bool operator==(const counting_alloc<T1>& /*x*/, const counting_alloc<T2>& /*y*/) noexcept
+{
+    return true;
+}
+
+template <typename T1, typename T2>
+bool operator!=(const counting_alloc<T1>& /*x*/, const counting_alloc<T2>& /*y*/) noexcept
+{
+    return false;
+}
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_COUNTING_ALLOC_HPP
@@ -0,0 +1,34 @@
+#ifndef SFL_TEST_COUNTING_EQUAL_HPP
+#define SFL_TEST_COUNTING_EQUAL_HPP
+
+#include <cstddef>
+#include <functional>
+
+namespace sfl
+{
+
+namespace test
+{
+
+// Key comparison function that counts how many times it has been invoked.
+template <typename Key>
+struct counting_equal
+{
+    static std::size_t& num_calls()
+    {
+        static std::size_t n = 0;
+        return n;
+    }
+
+    bool operator()(const Key& x, const Key& y) const
+    {
+        ++num_calls();
+        return std::equal_to<Key>()(x, y);
+    }
+};
+
+} // namespace test
+
+} // namespace sfl
+
+#endif // SFL_TEST_COUNTING_EQUAL_HPP
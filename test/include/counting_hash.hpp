@@ -0,0 +1,34 @@
+#ifndef SFL_TEST_COUNTING_HASH_HPP
+#define SFL_TEST_COUNTING_HASH_HPP
+
+#include <cstddef>
+#include <functional>
+
+namespace sfl
+{
+
+namespace test
+{
+
+// Hash function that counts how many times it has been invoked.
+template <typename Key>
+struct counting_hash
+{
+    static std::size_t& num_calls()
+    {
+        static std::size_t n = 0;
+        return n;
+    }
+
+    std::size_t operator()(const Key& key) const
+    {
+        ++num_calls();
+        return std::hash<Key>()(key);
+    }
+};
+
+} // namespace test
+
+} // namespace sfl
+
+#endif // SFL_TEST_COUNTING_HASH_HPP
@@ -0,0 +1,80 @@
+#ifndef SFL_TEST_FAILING_ALLOC_HPP
+#define SFL_TEST_FAILING_ALLOC_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace sfl
+{
+namespace test
+{
+
+// State shared by all rebound copies of `failing_alloc`.
+class failing_alloc_base
+{
+public:
+
+    static bool& fail()
+    {
+        static bool b = false;
+        return b;
+    }
+
+    static std::size_t& num_allocated()
+    {
+        static std::size_t n = 0;
+        return n;
+    }
+};
+
+// Allocator that throws std::bad_alloc while `fail()` is true. It also
+// counts allocations that have not been deallocated yet.
+template <typename T>
+class failing_alloc : public failing_alloc_base
+{
+public:
+
+    using value_type = T;
+
+    failing_alloc() noexcept
+    {}
+
+    template <typename U>
+    failing_alloc(const failing_alloc<U>& /*other*/) noexcept
+    {}
+
+    T* allocate(std::size_t n)
+    {
+        if (fail())
+        {
+            throw std::bad_alloc();
+        }
+
+        T* p = static_cast<T*>(::operator new(n * sizeof(T)));
+        ++num_allocated();
+        return p;
+    }
+
+    void deallocate(T* p, std::size_t)
+    {
+        ::operator delete(p);
+        --num_allocated();
+    }
+};
+
+template <typename T1, typename T2>
+bool operator==(const failing_alloc<T1>& /*x*/, const failing_alloc<T2>& /*y*/) noexcept
+{
+    return true;
+}
+
+template <typename T1, typename T2>
+bool operator!=(const failing_alloc<T1>& /*x*/, const failing_alloc<T2>& /*y*/) noexcept
+{
+    return false;
+}
+
+} // namespace test
+} // namespace sfl
+
+#endif // SFL_TEST_FAILING_ALLOC_HPP
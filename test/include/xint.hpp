@@ -165,7 +165,7 @@ namespace std
 template <>
 struct hash<sfl::test::xint>
 {
-    std::size_t operator()(const sfl::test::xint& x)
+    std::size_t operator()(const sfl::test::xint& x) const
     {
         return static_cast<std::size_t>(*x.value_);
     }
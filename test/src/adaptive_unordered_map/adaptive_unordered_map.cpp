@@ -0,0 +1,190 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/adaptive_unordered_map.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "nth.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+void test_adaptive_unordered_map_1()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "adaptive_unordered_map.inc"
+}
+
+void test_adaptive_unordered_map_2()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "adaptive_unordered_map.inc"
+}
+
+void test_adaptive_unordered_map_3()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "adaptive_unordered_map.inc"
+}
+
+void test_adaptive_unordered_map_4()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "adaptive_unordered_map.inc"
+}
+
+void test_adaptive_unordered_map_5()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "adaptive_unordered_map.inc"
+}
+
+// Keys are moved between linear search and hash table many times. Every
+// step compares the map with `std::unordered_map`.
+void test_adaptive_unordered_map_threshold()
+{
+    PRINT("Test threshold");
+    {
+        using map_type = sfl::adaptive_unordered_map<std::string, int, 16>;
+
+        using reference_type = std::unordered_map<std::string, int>;
+
+        auto check_same = [](const map_type& map, const reference_type& ref)
+        {
+            CHECK(map.size() == ref.size());
+
+            for (const auto& value : ref)
+            {
+                CHECK(map.find(value.first) != map.end());
+                CHECK(map.find(value.first)->second == value.second);
+            }
+
+            for (int i = 0; i < 80; ++i)
+            {
+                const std::string key = "key" + std::to_string(i);
+                CHECK(map.count(key) == ref.count(key));
+            }
+        };
+
+        std::mt19937 gen(4321);
+
+        map_type map;
+        reference_type ref;
+
+        for (int step = 0; step < 4000; ++step)
+        {
+            // Grow the map for a while, then shrink it for a while, so the
+            // size crosses the threshold in both directions many times.
+            const bool grow = (step / 250) % 2 == 0;
+
+            const std::string key = "key" + std::to_string(gen() % 64);
+
+            switch (gen() % 8)
+            {
+            case 0:
+            case 1:
+            case 2:
+                if (grow)
+                {
+                    CHECK(map.insert_or_assign(key, step).second == (ref.count(key) == 0));
+                    ref[key] = step;
+                }
+                else
+                {
+                    CHECK(map.erase(key) == ref.erase(key));
+                }
+                break;
+            case 3:
+                if (grow)
+                {
+                    CHECK(map.emplace(key, step).second == ref.emplace(key, step).second);
+                }
+                else if (!map.empty())
+                {
+                    auto it = map.nth(gen() % map.size());
+                    ref.erase(it->first);
+                    map.erase(it);
+                }
+                break;
+            case 4:
+                if (!grow && !map.empty())
+                {
+                    const std::size_t i = gen() % map.size();
+                    const std::size_t j = i + gen() % (std::min)(map.size() - i + 1, std::size_t(8));
+
+                    for (auto it = map.nth(i); it != map.nth(j); ++it)
+                    {
+                        ref.erase(it->first);
+                    }
+
+                    map.erase(map.nth(i), map.nth(j));
+                }
+                break;
+            case 5:
+                if (map.find(key) != map.end())
+                {
+                    map.find(key)->second = -step;
+                    ref[key] = -step;
+                }
+                break;
+            case 6:
+                {
+                    map_type copy(map);
+                    check_same(copy, ref);
+                    map_type moved(std::move(copy));
+                    check_same(moved, ref);
+                    map.swap(moved);
+                }
+                break;
+            default:
+                if (gen() % 50 == 0)
+                {
+                    map.clear();
+                    ref.clear();
+                }
+                break;
+            }
+
+            check_same(map, ref);
+        }
+    }
+
+    PRINT("Test hash_function()");
+    {
+        sfl::adaptive_unordered_map<std::string, int, 4> map;
+
+        auto hash_function = map.hash_function();
+
+        CHECK(hash_function("key") == std::hash<std::string>()("key"));
+    }
+}
+
+int main()
+{
+    test_adaptive_unordered_map_1();
+    test_adaptive_unordered_map_2();
+    test_adaptive_unordered_map_3();
+    test_adaptive_unordered_map_4();
+    test_adaptive_unordered_map_5();
+    test_adaptive_unordered_map_threshold();
+}
@@ -5,6 +5,7 @@
 
 #include "sfl/detail/functional/first.hpp"
 #include "sfl/detail/functional/identity.hpp"
+#include "sfl/static_vector.hpp"
 #include "sfl/vector.hpp"
 
 #include "check.hpp"
@@ -17,6 +18,7 @@
 #include "xint.hpp"
 #include "xobj.hpp"
 
+#include "counting_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -4,6 +4,7 @@
 #include "sfl/detail/bit/bit_log2.hpp"
 #include "sfl/detail/bit/bit_width.hpp"
 #include "sfl/detail/bit/countl_zero.hpp"
+#include "sfl/detail/bit/countr_zero.hpp"
 #include "sfl/detail/bit/has_single_bit.hpp"
 
 #include <cstdint>
@@ -104,6 +105,46 @@ static_assert(sfl::dtl::countl_zero(static_cast<std::uint8_t>(6)) == 8 - 3, "");
 static_assert(sfl::dtl::countl_zero(static_cast<std::uint8_t>(7)) == 8 - 3, "");
 static_assert(sfl::dtl::countl_zero(static_cast<std::uint8_t>(8)) == 8 - 4, "");
 
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(0)) == 64, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(1)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(2)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(3)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(4)) == 2, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(5)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(6)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(7)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint64_t>(8)) == 3, "");
+
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(0)) == 32, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(1)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(2)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(3)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(4)) == 2, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(5)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(6)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(7)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint32_t>(8)) == 3, "");
+
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(0)) == 16, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(1)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(2)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(3)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(4)) == 2, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(5)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(6)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(7)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint16_t>(8)) == 3, "");
+
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(0)) == 8, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(1)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(2)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(3)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(4)) == 2, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(5)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(6)) == 1, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(7)) == 0, "");
+static_assert(sfl::dtl::countr_zero(static_cast<std::uint8_t>(8)) == 3, "");
+
 static_assert(sfl::dtl::has_single_bit(0u) == false, "");
 static_assert(sfl::dtl::has_single_bit(1u) == true, "");
 static_assert(sfl::dtl::has_single_bit(2u) == true, "");
@@ -0,0 +1,82 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#define SFL_TEST_BTREE
+#include "sfl/detail/btree.hpp"
+
+#include "sfl/detail/functional/first.hpp"
+#include "sfl/detail/functional/identity.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+#include "partially_propagable_alloc.hpp"
+
+#include <array>
+#include <cstdlib>
+#include <set>
+#include <vector>
+
+template <>
+void test_btree<1>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<2>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<3>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<4>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<5>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "btree.inc"
+}
+
+template <>
+void test_btree<6>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::partially_propagable_alloc
+    #include "btree.inc"
+}
+
+int main()
+{
+    test_btree<1>();
+    test_btree<2>();
+    test_btree<3>();
+    test_btree<4>();
+    test_btree<5>();
+    test_btree<6>();
+}
@@ -14,6 +14,7 @@
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <memory>
 #include <sstream>
 #include <vector>
 
@@ -52,6 +53,64 @@ void test_compact_vector_5()
     #include "compact_vector.inc"
 }
 
+void test_compact_vector_trivially_relocatable()
+{
+    using sfl::test::xint;
+
+    static_assert(sfl::is_trivially_relocatable<std::unique_ptr<xint>>::value, "");
+
+    PRINT("Test relocation of std::unique_ptr");
+    {
+        sfl::compact_vector<std::unique_ptr<xint>> vec;
+
+        for (int i = 0; i < 5; ++i)
+        {
+            vec.emplace_back(new xint(10 * (i + 1)));
+        }
+
+        vec.emplace(vec.nth(1), new xint(15));
+
+        CHECK(vec.size() == 6);
+        CHECK(vec.capacity() == 6);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[1] == 15);
+        CHECK(*vec[2] == 20);
+        CHECK(*vec[5] == 50);
+
+        vec.erase(vec.nth(1));
+        vec.erase(vec.nth(1), vec.nth(3));
+
+        CHECK(vec.size() == 3);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[1] == 40);
+        CHECK(*vec[2] == 50);
+
+        vec.resize(5);
+
+        CHECK(vec.size() == 5);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[2] == 50);
+        CHECK(vec[3] == nullptr);
+        CHECK(vec[4] == nullptr);
+
+        vec.resize(2);
+
+        CHECK(vec.size() == 2);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[1] == 40);
+
+        std::unique_ptr<xint> arr[2] = {std::unique_ptr<xint>(new xint(1)), std::unique_ptr<xint>(new xint(2))};
+
+        vec.insert(vec.nth(1), std::make_move_iterator(arr), std::make_move_iterator(arr + 2));
+
+        CHECK(vec.size() == 4);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[1] == 1);
+        CHECK(*vec[2] == 2);
+        CHECK(*vec[3] == 40);
+    }
+}
+
 int main()
 {
     test_compact_vector_1();
@@ -59,4 +118,5 @@ int main()
     test_compact_vector_3();
     test_compact_vector_4();
     test_compact_vector_5();
+    test_compact_vector_trivially_relocatable();
 }
@@ -0,0 +1,216 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/concurrent_segmented_vector.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+
+#include "failing_alloc.hpp"
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+void test_concurrent_segmented_vector_N_1_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_1_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_1_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_1_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_3_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_3_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_3_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_3_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_64_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 64
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_64_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 64
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_64_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 64
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_N_64_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 64
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "concurrent_segmented_vector.inc"
+}
+
+void test_concurrent_segmented_vector_allocation_failure()
+{
+    #if !defined(SFL_NO_EXCEPTIONS)
+    using sfl::test::xint;
+
+    PRINT("Test emplace_back(Args&&...) when allocation fails");
+    {
+        using alloc_type = sfl::test::failing_alloc<xint>;
+
+        alloc_type::fail() = false;
+        alloc_type::num_allocated() = 0;
+
+        {
+            sfl::concurrent_segmented_vector<xint, 1, alloc_type> vec;
+
+            vec.emplace_back(10);
+
+            // Positions 1 and 2 belong to block 1. Allocation of that block
+            // fails, so block 1 is missing and block 2 is allocated next.
+            alloc_type::fail() = true;
+
+            for (int i = 0; i < 2; ++i)
+            {
+                bool caught_exception = false;
+
+                try
+                {
+                    vec.emplace_back(20);
+                }
+                catch (const std::bad_alloc&)
+                {
+                    caught_exception = true;
+                }
+
+                CHECK(caught_exception == true);
+            }
+
+            alloc_type::fail() = false;
+
+            vec.emplace_back(40);
+
+            CHECK(vec.size() == 4);
+            CHECK(vec.is_published(0) == true);
+            CHECK(vec.is_published(1) == false);
+            CHECK(vec.is_published(2) == false);
+            CHECK(vec.is_published(3) == true);
+            CHECK(vec[0] == 10);
+            CHECK(vec[3] == 40);
+
+            // Segments 0 and 3 are allocated.
+            CHECK(vec.capacity() == 2);
+        }
+
+        // Blocks after the missing one must be deallocated too.
+        CHECK(alloc_type::num_allocated() == 0);
+    }
+    #endif
+}
+
+int main()
+{
+    test_concurrent_segmented_vector_N_1_A_1();
+    test_concurrent_segmented_vector_N_1_A_2();
+    test_concurrent_segmented_vector_N_1_A_3();
+    test_concurrent_segmented_vector_N_1_A_4();
+    test_concurrent_segmented_vector_N_3_A_1();
+    test_concurrent_segmented_vector_N_3_A_2();
+    test_concurrent_segmented_vector_N_3_A_3();
+    test_concurrent_segmented_vector_N_3_A_4();
+    test_concurrent_segmented_vector_N_64_A_1();
+    test_concurrent_segmented_vector_N_64_A_2();
+    test_concurrent_segmented_vector_N_64_A_3();
+    test_concurrent_segmented_vector_N_64_A_4();
+    test_concurrent_segmented_vector_allocation_failure();
+}
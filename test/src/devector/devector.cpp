@@ -10,12 +10,17 @@
 
 #include "xint.hpp"
 
+#include "at_least_alloc.hpp"
+#include "counting_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <cstring>
+#include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
 template <>
@@ -58,6 +63,268 @@ void test_devector<5>()
     #include "devector.inc"
 }
 
+template <>
+void test_devector<6>()
+{
+    using sfl::test::xint;
+
+    static_assert(sfl::is_trivially_relocatable<std::unique_ptr<xint>>::value, "");
+
+    PRINT("Test relocation of std::unique_ptr");
+    {
+        sfl::devector<std::unique_ptr<xint>> vec;
+
+        for (int i = 0; i < 5; ++i)
+        {
+            vec.emplace_back(new xint(10 * (i + 1)));
+            vec.emplace_front(new xint(-10 * (i + 1)));
+        }
+
+        CHECK(vec.size() == 10);
+        CHECK(*vec[0] == -50);
+        CHECK(*vec[4] == -10);
+        CHECK(*vec[5] == 10);
+        CHECK(*vec[9] == 50);
+
+        // Insert with reallocation
+        vec.shrink_to_fit();
+        vec.emplace(vec.nth(2), new xint(-35));
+
+        CHECK(vec.size() == 11);
+        CHECK(*vec[0] == -50);
+        CHECK(*vec[1] == -40);
+        CHECK(*vec[2] == -35);
+        CHECK(*vec[3] == -30);
+        CHECK(*vec[10] == 50);
+
+        vec.shrink_to_fit();
+        vec.emplace(vec.nth(9), new xint(35));
+
+        CHECK(vec.size() == 12);
+        CHECK(*vec[8] == 30);
+        CHECK(*vec[9] == 35);
+        CHECK(*vec[10] == 40);
+        CHECK(*vec[11] == 50);
+
+        // Erase near front and near back
+        vec.erase(vec.nth(1));
+        vec.erase(vec.nth(9));
+        vec.erase(vec.nth(1), vec.nth(3));
+        vec.erase(vec.nth(5), vec.nth(7));
+
+        CHECK(vec.size() == 6);
+        CHECK(*vec[0] == -50);
+        CHECK(*vec[1] == -20);
+        CHECK(*vec[2] == -10);
+        CHECK(*vec[3] == 10);
+        CHECK(*vec[4] == 20);
+        CHECK(*vec[5] == 50);
+
+        vec.reserve_front(20);
+        vec.reserve_back(40);
+
+        CHECK(vec.size() == 6);
+        CHECK(*vec[0] == -50);
+        CHECK(*vec[5] == 50);
+
+        vec.shrink_to_fit();
+
+        std::unique_ptr<xint> arr[2] = {std::unique_ptr<xint>(new xint(1)), std::unique_ptr<xint>(new xint(2))};
+
+        vec.insert(vec.nth(3), std::make_move_iterator(arr), std::make_move_iterator(arr + 2));
+
+        CHECK(vec.size() == 8);
+        CHECK(*vec[0] == -50);
+        CHECK(*vec[2] == -10);
+        CHECK(*vec[3] == 1);
+        CHECK(*vec[4] == 2);
+        CHECK(*vec[5] == 10);
+        CHECK(*vec[7] == 50);
+    }
+}
+
+template <>
+void test_devector<7>()
+{
+    PRINT("Test GrowthPolicy");
+    {
+        sfl::devector<int, std::allocator<int>, sfl::growth_factor_2> vec;
+
+        vec.push_back(1);
+        CHECK(vec.capacity() == 1);
+
+        vec.push_back(2);
+        CHECK(vec.capacity() == 2);
+
+        vec.push_back(3);
+        CHECK(vec.capacity() == 4);
+        CHECK(vec.available_front() == 0);
+        CHECK(vec.available_back() == 1);
+
+        vec.push_front(0);
+        CHECK(vec.capacity() == 7);
+        CHECK(vec.available_front() == 2);
+        CHECK(vec.available_back() == 1);
+    }
+}
+
+template <>
+void test_devector<8>()
+{
+    using sfl::test::xint;
+
+    PRINT("Test allocate_at_least");
+    {
+        using alloc_type = sfl::test::at_least_alloc<xint>;
+
+        sfl::devector<xint, alloc_type> vec(3);
+        CHECK(vec.size() == 3);
+        CHECK(vec.capacity() == 8);
+        CHECK(vec.available_front() == 0);
+        CHECK(vec.available_back() == 5);
+
+        vec.emplace_front(-1);
+        CHECK(vec.size() == 4);
+        CHECK(vec.capacity() == 8);
+        CHECK(vec.available_front() == 0);
+        CHECK(vec.available_back() == 4);
+
+        vec.reserve_back(17);
+        CHECK(vec.capacity() == 24);
+        CHECK(vec.available_front() == 0);
+        CHECK(vec.available_back() == 20);
+
+        vec.reserve_front(5);
+        CHECK(vec.capacity() == 32);
+        CHECK(vec.available_front() == 8);
+        CHECK(vec.available_back() == 20);
+
+        vec.shrink_to_fit();
+        CHECK(vec.capacity() == 8);
+        CHECK(vec.available_front() == 0);
+        CHECK(vec.available_back() == 4);
+    }
+}
+
+template <>
+void test_devector<9>()
+{
+    using sfl::test::xint;
+
+    PRINT("Test resize_back(size_type, sfl::default_init_t)");
+    {
+        sfl::devector<xint> vec;
+
+        vec.resize_back(4, sfl::default_init_t());
+        CHECK(vec.size() == 4);
+        CHECK(*vec.nth(0) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(1) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(2) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(3) == SFL_TEST_XINT_DEFAULT_VALUE);
+
+        vec.resize_back(20, sfl::default_init_t());
+        CHECK(vec.size() == 20);
+        CHECK(*vec.nth(19) == SFL_TEST_XINT_DEFAULT_VALUE);
+
+        vec.resize_back(2, sfl::default_init_t());
+        CHECK(vec.size() == 2);
+    }
+
+    PRINT("Test resize_back(size_type, sfl::default_init_t) with Allocator::construct");
+    {
+        using alloc_type = sfl::test::counting_alloc<xint>;
+
+        alloc_type::num_constructed() = 0;
+        alloc_type::num_destroyed() = 0;
+
+        {
+            sfl::devector<xint, alloc_type> vec;
+
+            vec.resize_back(4, sfl::default_init_t());
+            CHECK(vec.size() == 4);
+            CHECK(alloc_type::num_constructed() == 4);
+
+            vec.resize_back(20, sfl::default_init_t());
+            CHECK(vec.size() == 20);
+
+            vec.resize_back(2, sfl::default_init_t());
+            CHECK(vec.size() == 2);
+        }
+
+        // Every element destroyed through the allocator was also
+        // constructed through it.
+        CHECK(alloc_type::num_constructed() == alloc_type::num_destroyed());
+    }
+
+    PRINT("Test append_uninitialized(size_type)");
+    {
+        sfl::devector<char> vec;
+
+        vec.push_back('a');
+
+        char* p = vec.append_uninitialized(3);
+        CHECK(vec.size() == 4);
+        CHECK(p == vec.data() + 1);
+
+        std::memcpy(p, "bcd", 3);
+
+        p = vec.append_uninitialized(30);
+        CHECK(vec.size() == 34);
+        CHECK(p == vec.data() + 4);
+
+        std::memset(p, 'e', 30);
+
+        CHECK(std::string(vec.begin(), vec.end()) == "abcd" + std::string(30, 'e'));
+    }
+
+    PRINT("Test resize_and_overwrite(size_type, Operation)");
+    {
+        sfl::devector<char> vec(2, 'x');
+
+        vec.resize_and_overwrite(10, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 10);
+            CHECK(p[0] == 'x');
+            CHECK(p[1] == 'x');
+            std::memcpy(p + 2, "abc", 3);
+            return 5;
+        });
+
+        CHECK(vec.size() == 5);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxabc");
+
+        vec.resize_and_overwrite(3, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 3);
+            p[2] = 'z';
+            return n;
+        });
+
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            vec.resize_and_overwrite(8, [](char*, std::size_t) -> std::size_t
+            {
+                throw 1;
+            });
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+        #endif
+    }
+}
+
 int main()
 {
     test_devector<1>();
@@ -65,4 +332,8 @@ int main()
     test_devector<3>();
     test_devector<4>();
     test_devector<5>();
+    test_devector<6>();
+    test_devector<7>();
+    test_devector<8>();
+    test_devector<9>();
 }
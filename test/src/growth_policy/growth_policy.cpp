@@ -0,0 +1,87 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/detail/growth_policy.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include <cstddef>
+
+struct page_sized_object
+{
+    char data[4096];
+};
+
+void test_growth_policy()
+{
+    PRINT("Test growth_factor_1_5");
+    {
+        using policy = sfl::growth_factor_1_5;
+
+        CHECK(policy::new_capacity<int>(std::size_t(0), std::size_t(1), std::size_t(100)) == 1);
+        CHECK(policy::new_capacity<int>(std::size_t(1), std::size_t(2), std::size_t(100)) == 2);
+        CHECK(policy::new_capacity<int>(std::size_t(2), std::size_t(3), std::size_t(100)) == 3);
+        CHECK(policy::new_capacity<int>(std::size_t(4), std::size_t(5), std::size_t(100)) == 6);
+        CHECK(policy::new_capacity<int>(std::size_t(10), std::size_t(11), std::size_t(100)) == 15);
+        CHECK(policy::new_capacity<int>(std::size_t(10), std::size_t(20), std::size_t(100)) == 20);
+        CHECK(policy::new_capacity<int>(std::size_t(80), std::size_t(81), std::size_t(100)) == 100);
+        CHECK(policy::new_capacity<int>(std::size_t(99), std::size_t(100), std::size_t(100)) == 100);
+    }
+
+    PRINT("Test growth_factor_2");
+    {
+        using policy = sfl::growth_factor_2;
+
+        CHECK(policy::new_capacity<int>(std::size_t(0), std::size_t(1), std::size_t(100)) == 1);
+        CHECK(policy::new_capacity<int>(std::size_t(1), std::size_t(2), std::size_t(100)) == 2);
+        CHECK(policy::new_capacity<int>(std::size_t(2), std::size_t(3), std::size_t(100)) == 4);
+        CHECK(policy::new_capacity<int>(std::size_t(4), std::size_t(5), std::size_t(100)) == 8);
+        CHECK(policy::new_capacity<int>(std::size_t(10), std::size_t(11), std::size_t(100)) == 20);
+        CHECK(policy::new_capacity<int>(std::size_t(10), std::size_t(30), std::size_t(100)) == 30);
+        CHECK(policy::new_capacity<int>(std::size_t(60), std::size_t(61), std::size_t(100)) == 100);
+        CHECK(policy::new_capacity<int>(std::size_t(99), std::size_t(100), std::size_t(100)) == 100);
+    }
+
+    PRINT("Test page_rounded_growth_4k");
+    {
+        using policy = sfl::page_rounded_growth_4k;
+
+        // Small buffers are not rounded.
+        CHECK(policy::new_capacity<int>(std::size_t(10), std::size_t(11), std::size_t(1000000)) == 15);
+        CHECK(policy::new_capacity<int>(std::size_t(600), std::size_t(601), std::size_t(1000000)) == 900);
+
+        // 1500 * 4 = 6000 bytes, rounded up to 8192 bytes.
+        CHECK(policy::new_capacity<int>(std::size_t(1000), std::size_t(1001), std::size_t(1000000)) == 2048);
+
+        // 3 * 4096 = 12288 bytes, already multiple of page size.
+        CHECK(policy::new_capacity<page_sized_object>(std::size_t(2), std::size_t(3), std::size_t(1000)) == 3);
+
+        // Rounded capacity is limited by max_size.
+        CHECK(policy::new_capacity<int>(std::size_t(1000), std::size_t(1001), std::size_t(1600)) == 1600);
+    }
+
+    PRINT("Test page_rounded_growth_2m");
+    {
+        using policy = sfl::page_rounded_growth_2m;
+
+        CHECK(policy::new_capacity<int>(std::size_t(1000), std::size_t(1001), std::size_t(10000000)) == 1500);
+
+        // 600000 * 4 = 2400000 bytes, rounded up to 4194304 bytes.
+        CHECK(policy::new_capacity<int>(std::size_t(400000), std::size_t(400001), std::size_t(10000000)) == 1048576);
+    }
+
+    PRINT("Test page_rounded_growth<4096, growth_factor_2>");
+    {
+        using policy = sfl::page_rounded_growth<4096, sfl::growth_factor_2>;
+
+        CHECK(policy::new_capacity<int>(std::size_t(10), std::size_t(11), std::size_t(1000000)) == 20);
+
+        // 1200 * 4 = 4800 bytes, rounded up to 8192 bytes.
+        CHECK(policy::new_capacity<int>(std::size_t(600), std::size_t(601), std::size_t(1000000)) == 2048);
+    }
+}
+
+int main()
+{
+    test_growth_policy();
+}
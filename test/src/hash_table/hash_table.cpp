@@ -20,6 +20,7 @@
 #include "stateless_fancy_alloc.hpp"
 #include "partially_propagable_alloc.hpp"
 
+#include <iterator> // back_inserter
 #include <numeric> // accumulate
 #include <random>
 #include <vector>
@@ -29,6 +30,10 @@ void test_hash_table<1>()
 {
     #undef   TPARAM_ALLOCATOR
     #define  TPARAM_ALLOCATOR std::allocator
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH false
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
     #include "hash_table.inc"
 }
 
@@ -37,6 +42,10 @@ void test_hash_table<2>()
 {
     #undef   TPARAM_ALLOCATOR
     #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH false
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
     #include "hash_table.inc"
 }
 
@@ -45,6 +54,10 @@ void test_hash_table<3>()
 {
     #undef   TPARAM_ALLOCATOR
     #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH false
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
     #include "hash_table.inc"
 }
 
@@ -53,6 +66,10 @@ void test_hash_table<4>()
 {
     #undef   TPARAM_ALLOCATOR
     #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH false
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
     #include "hash_table.inc"
 }
 
@@ -61,6 +78,10 @@ void test_hash_table<5>()
 {
     #undef   TPARAM_ALLOCATOR
     #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH false
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
     #include "hash_table.inc"
 }
 
@@ -69,6 +90,58 @@ void test_hash_table<6>()
 {
     #undef   TPARAM_ALLOCATOR
     #define  TPARAM_ALLOCATOR sfl::test::partially_propagable_alloc
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH false
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
+    #include "hash_table.inc"
+}
+
+template <>
+void test_hash_table<7>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH true
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
+    #include "hash_table.inc"
+}
+
+template <>
+void test_hash_table<8>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH true
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH false
+    #include "hash_table.inc"
+}
+
+template <>
+void test_hash_table<9>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH false
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH true
+    #include "hash_table.inc"
+}
+
+template <>
+void test_hash_table<10>()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #undef   TPARAM_STORE_HASH
+    #define  TPARAM_STORE_HASH true
+    #undef   TPARAM_INCREMENTAL_REHASH
+    #define  TPARAM_INCREMENTAL_REHASH true
     #include "hash_table.inc"
 }
 
@@ -85,4 +158,8 @@ int main()
     test_hash_table<4>();
     test_hash_table<5>();
     test_hash_table<6>();
+    test_hash_table<7>();
+    test_hash_table<8>();
+    test_hash_table<9>();
+    test_hash_table<10>();
 }
@@ -0,0 +1,65 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/order_statistic_set.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "nth.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xint_xint.hpp"
+#include "xobj.hpp"
+
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+
+#include <sstream>
+#include <vector>
+
+void test_order_statistic_set_1()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "order_statistic_set.inc"
+}
+
+void test_order_statistic_set_2()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "order_statistic_set.inc"
+}
+
+void test_order_statistic_set_3()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "order_statistic_set.inc"
+}
+
+void test_order_statistic_set_4()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "order_statistic_set.inc"
+}
+
+void test_order_statistic_set_5()
+{
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "order_statistic_set.inc"
+}
+
+int main()
+{
+    test_order_statistic_set_1();
+    test_order_statistic_set_2();
+    test_order_statistic_set_3();
+    test_order_statistic_set_4();
+    test_order_statistic_set_5();
+}
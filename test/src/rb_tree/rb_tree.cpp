@@ -20,6 +20,8 @@
 #include "stateless_fancy_alloc.hpp"
 #include "partially_propagable_alloc.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <vector>
 
 template <>
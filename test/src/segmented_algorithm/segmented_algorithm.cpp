@@ -0,0 +1,168 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/segmented_algorithm.hpp"
+#include "sfl/segmented_devector.hpp"
+#include "sfl/segmented_vector.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include "stateless_fancy_alloc.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+template <typename Container>
+void test_segmented_algorithm(int n)
+{
+    Container c;
+
+    for (int i = 0; i < n; ++i)
+    {
+        c.push_back(i % 7);
+    }
+
+    const Container& cc = c;
+
+    const std::vector<int> ref(cc.begin(), cc.end());
+
+    for (int i = 0; i <= n; ++i)
+    {
+        for (int j = i; j <= n; ++j)
+        {
+            const auto first = std::next(cc.begin(), i);
+            const auto last  = std::next(cc.begin(), j);
+
+            const auto ref_first = std::next(ref.begin(), i);
+            const auto ref_last  = std::next(ref.begin(), j);
+
+            // for_each_segment
+            {
+                using local_iterator = sfl::segmented::local_iterator_t<typename Container::const_iterator>;
+
+                std::vector<int> visited;
+
+                sfl::segmented::for_each_segment(first, last, [&visited](local_iterator p, local_iterator q)
+                {
+                    CHECK(p <= q);
+                    visited.insert(visited.end(), p, q);
+                });
+
+                CHECK(int(visited.size()) == j - i);
+                CHECK(std::equal(visited.begin(), visited.end(), ref_first));
+            }
+
+            // for_each
+            {
+                int sum = 0;
+                sfl::segmented::for_each(first, last, [&sum](int x) { sum += x; });
+                CHECK(sum == std::accumulate(ref_first, ref_last, 0));
+            }
+
+            // find, find_if, find_if_not
+            for (int v = 0; v < 8; ++v)
+            {
+                const auto is_v = [v](int x) { return x == v; };
+                const auto is_not_v = [v](int x) { return x != v; };
+
+                CHECK(std::distance(cc.begin(), sfl::segmented::find(first, last, v)) ==
+                      std::distance(ref.begin(), std::find(ref_first, ref_last, v)));
+
+                CHECK(std::distance(cc.begin(), sfl::segmented::find_if(first, last, is_v)) ==
+                      std::distance(ref.begin(), std::find_if(ref_first, ref_last, is_v)));
+
+                CHECK(std::distance(cc.begin(), sfl::segmented::find_if_not(first, last, is_not_v)) ==
+                      std::distance(ref.begin(), std::find_if_not(ref_first, ref_last, is_not_v)));
+
+                CHECK(sfl::segmented::all_of(first, last, is_v) == std::all_of(ref_first, ref_last, is_v));
+                CHECK(sfl::segmented::any_of(first, last, is_v) == std::any_of(ref_first, ref_last, is_v));
+                CHECK(sfl::segmented::none_of(first, last, is_v) == std::none_of(ref_first, ref_last, is_v));
+
+                CHECK(sfl::segmented::count(first, last, v) == std::count(ref_first, ref_last, v));
+                CHECK(sfl::segmented::count_if(first, last, is_v) == std::count_if(ref_first, ref_last, is_v));
+            }
+
+            // accumulate
+            {
+                CHECK(sfl::segmented::accumulate(first, last, 10) == std::accumulate(ref_first, ref_last, 10));
+
+                const auto op = [](long long acc, int x) { return 3 * acc + x; };
+
+                CHECK(sfl::segmented::accumulate(first, last, 1LL, op) == std::accumulate(ref_first, ref_last, 1LL, op));
+            }
+
+            // transform
+            {
+                std::vector<int> out;
+                sfl::segmented::transform(first, last, std::back_inserter(out), [](int x) { return 2 * x; });
+
+                CHECK(int(out.size()) == j - i);
+
+                for (int k = 0; k < int(out.size()); ++k)
+                {
+                    CHECK(out[k] == 2 * ref[i + k]);
+                }
+            }
+
+            // equal
+            {
+                CHECK(sfl::segmented::equal(first, last, ref_first));
+
+                if (i < j)
+                {
+                    std::vector<int> other(ref_first, ref_last);
+                    other.back() += 1;
+                    CHECK(!sfl::segmented::equal(first, last, other.begin()));
+                    other.back() -= 1;
+                    other.front() += 1;
+                    CHECK(!sfl::segmented::equal(first, last, other.begin()));
+                }
+            }
+        }
+    }
+
+    // Mutable iterators
+    {
+        using local_iterator = sfl::segmented::local_iterator_t<typename Container::iterator>;
+
+        sfl::segmented::for_each_segment(c.begin(), c.end(), [](local_iterator p, local_iterator q)
+        {
+            for (; p != q; ++p)
+            {
+                *p += 100;
+            }
+        });
+
+        for (int i = 0; i < n; ++i)
+        {
+            CHECK(*std::next(cc.begin(), i) == ref[i] + 100);
+        }
+
+        sfl::segmented::for_each(c.begin(), c.end(), [](int& x) { x -= 100; });
+
+        CHECK(std::equal(cc.begin(), cc.end(), ref.begin()));
+    }
+}
+
+static_assert(std::is_same<sfl::segmented::local_iterator_t<sfl::segmented_vector<int, 4>::iterator>, int*>::value, "");
+static_assert(std::is_same<sfl::segmented::local_iterator_t<sfl::segmented_vector<int, 4>::const_iterator>, const int*>::value, "");
+static_assert(std::is_same<sfl::segmented::local_iterator_t<std::vector<int>::iterator>, std::vector<int>::iterator>::value, "");
+
+int main()
+{
+    PRINT("Test sfl::segmented algorithms");
+
+    for (int n : {0, 1, 5, 16, 37})
+    {
+        test_segmented_algorithm<std::vector<int>>(n);
+        test_segmented_algorithm<sfl::segmented_vector<int, 1>>(n);
+        test_segmented_algorithm<sfl::segmented_vector<int, 4>>(n);
+        test_segmented_algorithm<sfl::segmented_vector<int, 5, sfl::test::stateless_fancy_alloc<int>>>(n);
+        test_segmented_algorithm<sfl::segmented_devector<int, 1>>(n);
+        test_segmented_algorithm<sfl::segmented_devector<int, 4>>(n);
+        test_segmented_algorithm<sfl::segmented_devector<int, 5, sfl::test::stateless_fancy_alloc<int>>>(n);
+    }
+}
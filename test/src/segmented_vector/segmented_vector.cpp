@@ -9,6 +9,7 @@
 
 #include "xint.hpp"
 
+#include "at_least_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
@@ -267,6 +268,38 @@ void test_segmented_vector_N_100_A_5()
     #include "segmented_vector.inc"
 }
 
+void test_segmented_vector_allocate_at_least()
+{
+    using sfl::test::xint;
+
+    PRINT("Test allocate_at_least");
+    {
+        // Segment size must be multiple of allocator granularity.
+        sfl::segmented_vector<xint, 8, sfl::test::at_least_alloc<xint>> vec;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        CHECK(vec.size() == 100);
+        CHECK(vec.capacity() == 103);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(vec[i] == i);
+        }
+
+        vec.resize(20);
+        vec.shrink_to_fit();
+        CHECK(vec.size() == 20);
+        CHECK(vec.capacity() == 23);
+
+        vec.reserve(200);
+        CHECK(vec.capacity() == 207);
+    }
+}
+
 int main()
 {
     test_segmented_vector_N_1_A_1();
@@ -298,4 +331,6 @@ int main()
     test_segmented_vector_N_100_A_3();
     test_segmented_vector_N_100_A_4();
     test_segmented_vector_N_100_A_5();
+
+    test_segmented_vector_allocate_at_least();
 }
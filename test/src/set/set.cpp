@@ -1,6 +1,7 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/set.hpp"
+#include "sfl/multiset.hpp"
 
 #include "check.hpp"
 #include "istream_view.hpp"
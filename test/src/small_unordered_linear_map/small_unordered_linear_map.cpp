@@ -3,6 +3,7 @@
 #include "sfl/small_unordered_linear_map.hpp"
 
 #include "check.hpp"
+#include "counting_equal.hpp"
 #include "istream_view.hpp"
 #include "nth.hpp"
 #include "pair_io.hpp"
@@ -16,7 +17,9 @@
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <functional>
 #include <sstream>
+#include <string>
 #include <vector>
 
 void test_small_unordered_linear_map_1()
@@ -54,6 +57,80 @@ void test_small_unordered_linear_map_5()
     #include "small_unordered_linear_map.inc"
 }
 
+void test_small_unordered_linear_map_hash()
+{
+    PRINT("Test Hash");
+    {
+        using equal = sfl::test::counting_equal<std::string>;
+
+        using map_type = sfl::small_unordered_linear_map
+        <
+            std::string,
+            int,
+            16,
+            equal,
+            std::allocator<std::pair<std::string, int>>,
+            std::hash<std::string>
+        >;
+
+        map_type map;
+
+        for (int i = 0; i < 64; ++i)
+        {
+            CHECK(map.emplace("key" + std::to_string(i), i).second == true);
+        }
+
+        CHECK(map.emplace("key10", 0).second == false);
+        CHECK(map.size() == 64);
+
+        // Keys are compared only if fingerprints are equal.
+        {
+            equal::num_calls() = 0;
+
+            for (int i = 64; i < 128; ++i)
+            {
+                CHECK(map.find("key" + std::to_string(i)) == map.end());
+            }
+
+            CHECK(equal::num_calls() < 64);
+        }
+
+        for (int i = 0; i < 64; ++i)
+        {
+            CHECK(map.at("key" + std::to_string(i)) == i);
+        }
+
+        for (int i = 0; i < 64; i += 2)
+        {
+            CHECK(map.erase("key" + std::to_string(i)) == 1);
+        }
+
+        CHECK(map.erase(map.begin(), map.begin() + 4) == map.begin());
+        CHECK(map.size() == 28);
+
+        map_type map2(map);
+        map_type map3(std::move(map2));
+        map2 = map3;
+        map2.swap(map);
+
+        for (const auto& value : map3)
+        {
+            CHECK(map.find(value.first) != map.end());
+            CHECK(map.find(value.first)->second == value.second);
+        }
+
+        for (int i = 0; i < 64; ++i)
+        {
+            CHECK(map.contains("key" + std::to_string(i)) == (map3.count("key" + std::to_string(i)) == 1));
+        }
+
+        CHECK(map == map3);
+
+        map.clear();
+        CHECK(map.find("key1") == map.end());
+    }
+}
+
 int main()
 {
     test_small_unordered_linear_map_1();
@@ -61,4 +138,5 @@ int main()
     test_small_unordered_linear_map_3();
     test_small_unordered_linear_map_4();
     test_small_unordered_linear_map_5();
+    test_small_unordered_linear_map_hash();
 }
@@ -9,12 +9,17 @@
 
 #include "xint.hpp"
 
+#include "at_least_alloc.hpp"
+#include "counting_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <cstring>
+#include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
 void test_small_vector_1()
@@ -52,6 +57,250 @@ void test_small_vector_5()
     #include "small_vector.inc"
 }
 
+void test_small_vector_trivially_relocatable()
+{
+    using sfl::test::xint;
+
+    static_assert(sfl::is_trivially_relocatable<std::unique_ptr<xint>>::value, "");
+
+    PRINT("Test relocation of std::unique_ptr");
+    {
+        sfl::small_vector<std::unique_ptr<xint>, 4> vec;
+
+        for (int i = 0; i < 4; ++i)
+        {
+            vec.emplace_back(new xint(10 * (i + 1)));
+        }
+
+        CHECK(vec.size() == 4);
+        CHECK(vec.capacity() == 4);
+
+        // Internal storage to heap
+        vec.emplace(vec.nth(1), new xint(15));
+
+        CHECK(vec.size() == 5);
+        CHECK(vec.capacity() > 4);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[1] == 15);
+        CHECK(*vec[2] == 20);
+        CHECK(*vec[4] == 40);
+
+        for (int i = 4; i < 10; ++i)
+        {
+            vec.emplace_back(new xint(10 * (i + 1)));
+        }
+
+        CHECK(vec.size() == 11);
+        CHECK(*vec[10] == 100);
+
+        // Insert and erase without reallocation
+        vec.reserve(20);
+        vec.insert(vec.nth(0), std::unique_ptr<xint>(new xint(5)));
+        vec.erase(vec.nth(2));
+        vec.erase(vec.nth(3), vec.nth(9));
+
+        CHECK(vec.size() == 5);
+        CHECK(*vec[0] == 5);
+        CHECK(*vec[1] == 10);
+        CHECK(*vec[2] == 20);
+        CHECK(*vec[3] == 90);
+        CHECK(*vec[4] == 100);
+
+        // Heap to internal storage
+        vec.pop_back();
+        vec.shrink_to_fit();
+
+        CHECK(vec.size() == 4);
+        CHECK(vec.capacity() == 4);
+        CHECK(*vec[0] == 5);
+        CHECK(*vec[1] == 10);
+        CHECK(*vec[2] == 20);
+        CHECK(*vec[3] == 90);
+
+        std::unique_ptr<xint> arr[2] = {std::unique_ptr<xint>(new xint(1)), std::unique_ptr<xint>(new xint(2))};
+
+        vec.insert(vec.nth(1), std::make_move_iterator(arr), std::make_move_iterator(arr + 2));
+
+        CHECK(vec.size() == 6);
+        CHECK(*vec[0] == 5);
+        CHECK(*vec[1] == 1);
+        CHECK(*vec[2] == 2);
+        CHECK(*vec[3] == 10);
+        CHECK(*vec[5] == 90);
+    }
+}
+
+void test_small_vector_growth_policy()
+{
+    PRINT("Test GrowthPolicy");
+    {
+        sfl::small_vector<int, 3, std::allocator<int>, sfl::growth_factor_2> vec;
+
+        vec.push_back(1);
+        vec.push_back(2);
+        vec.push_back(3);
+        CHECK(vec.capacity() == 3);
+
+        vec.push_back(4);
+        CHECK(vec.capacity() == 6);
+
+        vec.push_back(5);
+        vec.push_back(6);
+        vec.push_back(7);
+        CHECK(vec.capacity() == 12);
+    }
+}
+
+void test_small_vector_allocate_at_least()
+{
+    using sfl::test::xint;
+
+    PRINT("Test allocate_at_least");
+    {
+        using alloc_type = sfl::test::at_least_alloc<xint>;
+
+        sfl::small_vector<xint, 3, alloc_type> vec(3);
+        CHECK(vec.size() == 3);
+        CHECK(vec.capacity() == 3);
+
+        vec.emplace_back(3);
+        CHECK(vec.size() == 4);
+        CHECK(vec.capacity() == 8);
+
+        vec.reserve(10);
+        CHECK(vec.capacity() == 16);
+
+        vec.shrink_to_fit();
+        CHECK(vec.capacity() == 8);
+
+        sfl::small_vector<xint, 3, alloc_type> vec2(10, xint(1));
+        CHECK(vec2.size() == 10);
+        CHECK(vec2.capacity() == 16);
+
+        vec2.resize(2);
+        vec2.shrink_to_fit();
+        CHECK(vec2.capacity() == 3);
+    }
+}
+
+void test_small_vector_resize_and_overwrite()
+{
+    using sfl::test::xint;
+
+    PRINT("Test resize(size_type, sfl::default_init_t)");
+    {
+        sfl::small_vector<xint, 5> vec;
+
+        vec.resize(4, sfl::default_init_t());
+        CHECK(vec.size() == 4);
+        CHECK(*vec.nth(0) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(1) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(2) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(3) == SFL_TEST_XINT_DEFAULT_VALUE);
+
+        vec.resize(20, sfl::default_init_t());
+        CHECK(vec.size() == 20);
+        CHECK(*vec.nth(19) == SFL_TEST_XINT_DEFAULT_VALUE);
+
+        vec.resize(2, sfl::default_init_t());
+        CHECK(vec.size() == 2);
+    }
+
+    PRINT("Test resize(size_type, sfl::default_init_t) with Allocator::construct");
+    {
+        using alloc_type = sfl::test::counting_alloc<xint>;
+
+        alloc_type::num_constructed() = 0;
+        alloc_type::num_destroyed() = 0;
+
+        {
+            sfl::small_vector<xint, 5, alloc_type> vec;
+
+            vec.resize(4, sfl::default_init_t());
+            CHECK(vec.size() == 4);
+            CHECK(alloc_type::num_constructed() == 4);
+
+            vec.resize(20, sfl::default_init_t());
+            CHECK(vec.size() == 20);
+
+            vec.resize(2, sfl::default_init_t());
+            CHECK(vec.size() == 2);
+        }
+
+        // Every element destroyed through the allocator was also
+        // constructed through it.
+        CHECK(alloc_type::num_constructed() == alloc_type::num_destroyed());
+    }
+
+    PRINT("Test append_uninitialized(size_type)");
+    {
+        sfl::small_vector<char, 5> vec;
+
+        vec.push_back('a');
+
+        char* p = vec.append_uninitialized(3);
+        CHECK(vec.size() == 4);
+        CHECK(p == vec.data() + 1);
+
+        std::memcpy(p, "bcd", 3);
+
+        p = vec.append_uninitialized(30);
+        CHECK(vec.size() == 34);
+        CHECK(p == vec.data() + 4);
+
+        std::memset(p, 'e', 30);
+
+        CHECK(std::string(vec.begin(), vec.end()) == "abcd" + std::string(30, 'e'));
+    }
+
+    PRINT("Test resize_and_overwrite(size_type, Operation)");
+    {
+        sfl::small_vector<char, 5> vec(2, 'x');
+
+        vec.resize_and_overwrite(10, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 10);
+            CHECK(p[0] == 'x');
+            CHECK(p[1] == 'x');
+            std::memcpy(p + 2, "abc", 3);
+            return 5;
+        });
+
+        CHECK(vec.size() == 5);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxabc");
+
+        vec.resize_and_overwrite(3, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 3);
+            p[2] = 'z';
+            return n;
+        });
+
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            vec.resize_and_overwrite(8, [](char*, std::size_t) -> std::size_t
+            {
+                throw 1;
+            });
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+        #endif
+    }
+}
+
 int main()
 {
     test_small_vector_1();
@@ -59,4 +308,8 @@ int main()
     test_small_vector_3();
     test_small_vector_4();
     test_small_vector_5();
+    test_small_vector_trivially_relocatable();
+    test_small_vector_growth_policy();
+    test_small_vector_allocate_at_least();
+    test_small_vector_resize_and_overwrite();
 }
@@ -1131,6 +1131,279 @@ void test_static_flat_multimap()
         }
     }
 
+    PRINT("Test container(sfl::sorted_equivalent_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_flat_multimap<xint, xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                {10, 1},
+                {10, 2},
+                {20, 1}
+            }
+        );
+
+        {
+            container_type map(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 3);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 2);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_equivalent_t, InputIt, InputIt, const Compare&)");
+    {
+        using container_type = sfl::static_flat_multimap<xint, xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                {10, 1},
+                {10, 2},
+                {20, 1}
+            }
+        );
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type map(sfl::sorted_equivalent_t(), data.begin(), data.end(), comp);
+
+            CHECK(map.size() == 3);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 2);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_equivalent_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_flat_multimap<xint, xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            {10, 1},
+            {10, 2},
+            {20, 1}
+        };
+
+        {
+            container_type map(sfl::sorted_equivalent_t(), ilist);
+
+            CHECK(map.size() == 3);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 2);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_equivalent_t, std::initializer_list, const Compare&)");
+    {
+        using container_type = sfl::static_flat_multimap<xint, xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            {10, 1},
+            {10, 2},
+            {20, 1}
+        };
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type map(sfl::sorted_equivalent_t(), ilist, comp);
+
+            CHECK(map.size() == 3);
+            CHECK(map.nth(0)->first == 10); CHECK(map.nth(0)->second == 1);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 2);
+            CHECK(map.nth(2)->first == 20); CHECK(map.nth(2)->second == 1);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_equivalent_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_flat_multimap<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_equivalent_t(),
+            {
+                {10, 1},
+                {10, 2},
+                {20, 1}
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {5, 2},
+                    {10, 3},
+                    {10, 4},
+                    {20, 2}
+                }
+            );
+
+            map.insert(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 7);
+            CHECK(map.nth(0)->first == 5); CHECK(map.nth(0)->second == 2);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 3);
+            CHECK(map.nth(2)->first == 10); CHECK(map.nth(2)->second == 4);
+            CHECK(map.nth(3)->first == 10); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 10); CHECK(map.nth(4)->second == 2);
+            CHECK(map.nth(5)->first == 20); CHECK(map.nth(5)->second == 2);
+            CHECK(map.nth(6)->first == 20); CHECK(map.nth(6)->second == 1);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {20, 3},
+                    {30, 3}
+                }
+            );
+
+            map.insert(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 9);
+            CHECK(map.nth(0)->first == 5); CHECK(map.nth(0)->second == 2);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 3);
+            CHECK(map.nth(2)->first == 10); CHECK(map.nth(2)->second == 4);
+            CHECK(map.nth(3)->first == 10); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 10); CHECK(map.nth(4)->second == 2);
+            CHECK(map.nth(5)->first == 20); CHECK(map.nth(5)->second == 3);
+            CHECK(map.nth(6)->first == 20); CHECK(map.nth(6)->second == 2);
+            CHECK(map.nth(7)->first == 20); CHECK(map.nth(7)->second == 1);
+            CHECK(map.nth(8)->first == 30); CHECK(map.nth(8)->second == 3);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_equivalent_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_flat_multimap<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_equivalent_t(),
+            {
+                {10, 1},
+                {10, 2},
+                {20, 1}
+            }
+        );
+
+        {
+            map.insert
+            (
+                sfl::sorted_equivalent_t(),
+                {
+                    {5, 2},
+                    {10, 3},
+                    {10, 4},
+                    {20, 2}
+                }
+            );
+
+            CHECK(map.size() == 7);
+            CHECK(map.nth(0)->first == 5); CHECK(map.nth(0)->second == 2);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 3);
+            CHECK(map.nth(2)->first == 10); CHECK(map.nth(2)->second == 4);
+            CHECK(map.nth(3)->first == 10); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 10); CHECK(map.nth(4)->second == 2);
+            CHECK(map.nth(5)->first == 20); CHECK(map.nth(5)->second == 2);
+            CHECK(map.nth(6)->first == 20); CHECK(map.nth(6)->second == 1);
+        }
+
+        {
+            map.insert
+            (
+                sfl::sorted_equivalent_t(),
+                {
+                    {20, 3},
+                    {30, 3}
+                }
+            );
+
+            CHECK(map.size() == 9);
+            CHECK(map.nth(0)->first == 5); CHECK(map.nth(0)->second == 2);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 3);
+            CHECK(map.nth(2)->first == 10); CHECK(map.nth(2)->second == 4);
+            CHECK(map.nth(3)->first == 10); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 10); CHECK(map.nth(4)->second == 2);
+            CHECK(map.nth(5)->first == 20); CHECK(map.nth(5)->second == 3);
+            CHECK(map.nth(6)->first == 20); CHECK(map.nth(6)->second == 2);
+            CHECK(map.nth(7)->first == 20); CHECK(map.nth(7)->second == 1);
+            CHECK(map.nth(8)->first == 30); CHECK(map.nth(8)->second == 3);
+        }
+    }
+
+    PRINT("Test insert_range(sfl::sorted_equivalent_t, Range&&)");
+    {
+        using container_type = sfl::static_flat_multimap<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_equivalent_t(),
+            {
+                {10, 1},
+                {10, 2},
+                {20, 1}
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {5, 2},
+                    {10, 3},
+                    {10, 4},
+                    {20, 2}
+                }
+            );
+
+            map.insert_range(sfl::sorted_equivalent_t(), data);
+
+            CHECK(map.size() == 7);
+            CHECK(map.nth(0)->first == 5); CHECK(map.nth(0)->second == 2);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 3);
+            CHECK(map.nth(2)->first == 10); CHECK(map.nth(2)->second == 4);
+            CHECK(map.nth(3)->first == 10); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 10); CHECK(map.nth(4)->second == 2);
+            CHECK(map.nth(5)->first == 20); CHECK(map.nth(5)->second == 2);
+            CHECK(map.nth(6)->first == 20); CHECK(map.nth(6)->second == 1);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {20, 3},
+                    {30, 3}
+                }
+            );
+
+            map.insert_range(sfl::sorted_equivalent_t(), data);
+
+            CHECK(map.size() == 9);
+            CHECK(map.nth(0)->first == 5); CHECK(map.nth(0)->second == 2);
+            CHECK(map.nth(1)->first == 10); CHECK(map.nth(1)->second == 3);
+            CHECK(map.nth(2)->first == 10); CHECK(map.nth(2)->second == 4);
+            CHECK(map.nth(3)->first == 10); CHECK(map.nth(3)->second == 1);
+            CHECK(map.nth(4)->first == 10); CHECK(map.nth(4)->second == 2);
+            CHECK(map.nth(5)->first == 20); CHECK(map.nth(5)->second == 3);
+            CHECK(map.nth(6)->first == 20); CHECK(map.nth(6)->second == 2);
+            CHECK(map.nth(7)->first == 20); CHECK(map.nth(7)->second == 1);
+            CHECK(map.nth(8)->first == 30); CHECK(map.nth(8)->second == 3);
+        }
+    }
+
     PRINT("Test erase(const_iterator)");
     {
         // Erase at the end
@@ -966,6 +966,279 @@ void test_static_flat_multiset()
         }
     }
 
+    PRINT("Test container(sfl::sorted_equivalent_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_flat_multiset<xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                10,
+                10,
+                20
+            }
+        );
+
+        {
+            container_type set(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(set.size() == 3);
+            CHECK(*set.nth(0) == 10);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 20);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_equivalent_t, InputIt, InputIt, const Compare&)");
+    {
+        using container_type = sfl::static_flat_multiset<xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                10,
+                10,
+                20
+            }
+        );
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type set(sfl::sorted_equivalent_t(), data.begin(), data.end(), comp);
+
+            CHECK(set.size() == 3);
+            CHECK(*set.nth(0) == 10);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 20);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_equivalent_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_flat_multiset<xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            10,
+            10,
+            20
+        };
+
+        {
+            container_type set(sfl::sorted_equivalent_t(), ilist);
+
+            CHECK(set.size() == 3);
+            CHECK(*set.nth(0) == 10);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 20);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_equivalent_t, std::initializer_list, const Compare&)");
+    {
+        using container_type = sfl::static_flat_multiset<xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            10,
+            10,
+            20
+        };
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type set(sfl::sorted_equivalent_t(), ilist, comp);
+
+            CHECK(set.size() == 3);
+            CHECK(*set.nth(0) == 10);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 20);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_equivalent_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_flat_multiset<xint, 32, std::less<xint>>;
+
+        container_type set
+        (
+            sfl::sorted_equivalent_t(),
+            {
+                10,
+                10,
+                20
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    5,
+                    10,
+                    10,
+                    20
+                }
+            );
+
+            set.insert(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(set.size() == 7);
+            CHECK(*set.nth(0) == 5);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 10);
+            CHECK(*set.nth(3) == 10);
+            CHECK(*set.nth(4) == 10);
+            CHECK(*set.nth(5) == 20);
+            CHECK(*set.nth(6) == 20);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    20,
+                    30
+                }
+            );
+
+            set.insert(sfl::sorted_equivalent_t(), data.begin(), data.end());
+
+            CHECK(set.size() == 9);
+            CHECK(*set.nth(0) == 5);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 10);
+            CHECK(*set.nth(3) == 10);
+            CHECK(*set.nth(4) == 10);
+            CHECK(*set.nth(5) == 20);
+            CHECK(*set.nth(6) == 20);
+            CHECK(*set.nth(7) == 20);
+            CHECK(*set.nth(8) == 30);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_equivalent_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_flat_multiset<xint, 32, std::less<xint>>;
+
+        container_type set
+        (
+            sfl::sorted_equivalent_t(),
+            {
+                10,
+                10,
+                20
+            }
+        );
+
+        {
+            set.insert
+            (
+                sfl::sorted_equivalent_t(),
+                {
+                    5,
+                    10,
+                    10,
+                    20
+                }
+            );
+
+            CHECK(set.size() == 7);
+            CHECK(*set.nth(0) == 5);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 10);
+            CHECK(*set.nth(3) == 10);
+            CHECK(*set.nth(4) == 10);
+            CHECK(*set.nth(5) == 20);
+            CHECK(*set.nth(6) == 20);
+        }
+
+        {
+            set.insert
+            (
+                sfl::sorted_equivalent_t(),
+                {
+                    20,
+                    30
+                }
+            );
+
+            CHECK(set.size() == 9);
+            CHECK(*set.nth(0) == 5);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 10);
+            CHECK(*set.nth(3) == 10);
+            CHECK(*set.nth(4) == 10);
+            CHECK(*set.nth(5) == 20);
+            CHECK(*set.nth(6) == 20);
+            CHECK(*set.nth(7) == 20);
+            CHECK(*set.nth(8) == 30);
+        }
+    }
+
+    PRINT("Test insert_range(sfl::sorted_equivalent_t, Range&&)");
+    {
+        using container_type = sfl::static_flat_multiset<xint, 32, std::less<xint>>;
+
+        container_type set
+        (
+            sfl::sorted_equivalent_t(),
+            {
+                10,
+                10,
+                20
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    5,
+                    10,
+                    10,
+                    20
+                }
+            );
+
+            set.insert_range(sfl::sorted_equivalent_t(), data);
+
+            CHECK(set.size() == 7);
+            CHECK(*set.nth(0) == 5);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 10);
+            CHECK(*set.nth(3) == 10);
+            CHECK(*set.nth(4) == 10);
+            CHECK(*set.nth(5) == 20);
+            CHECK(*set.nth(6) == 20);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    20,
+                    30
+                }
+            );
+
+            set.insert_range(sfl::sorted_equivalent_t(), data);
+
+            CHECK(set.size() == 9);
+            CHECK(*set.nth(0) == 5);
+            CHECK(*set.nth(1) == 10);
+            CHECK(*set.nth(2) == 10);
+            CHECK(*set.nth(3) == 10);
+            CHECK(*set.nth(4) == 10);
+            CHECK(*set.nth(5) == 20);
+            CHECK(*set.nth(6) == 20);
+            CHECK(*set.nth(7) == 20);
+            CHECK(*set.nth(8) == 30);
+        }
+    }
+
     PRINT("Test erase(const_iterator)");
     {
         // Erase at the end
@@ -1037,6 +1037,276 @@ void test_static_map()
         }
     }
 
+    PRINT("Test container(sfl::sorted_unique_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            container_type map(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, InputIt, InputIt, const Compare&)");
+    {
+        using container_type = sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type map(sfl::sorted_unique_t(), data.begin(), data.end(), comp);
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1}
+        };
+
+        {
+            container_type map(sfl::sorted_unique_t(), ilist);
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, std::initializer_list, const Compare&)");
+    {
+        using container_type = sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1}
+        };
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type map(sfl::sorted_unique_t(), ilist, comp);
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_unique_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_unique_t(),
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {5, 2},
+                    {20, 2},
+                    {25, 2},
+                    {40, 2}
+                }
+            );
+
+            map.insert(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 6);
+            CHECK(NTH(map, 0)->first == 5); CHECK(NTH(map, 0)->second == 2);
+            CHECK(NTH(map, 1)->first == 10); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 20); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 25); CHECK(NTH(map, 3)->second == 2);
+            CHECK(NTH(map, 4)->first == 30); CHECK(NTH(map, 4)->second == 1);
+            CHECK(NTH(map, 5)->first == 40); CHECK(NTH(map, 5)->second == 2);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {1, 3},
+                    {30, 3},
+                    {50, 3}
+                }
+            );
+
+            map.insert(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 8);
+            CHECK(NTH(map, 0)->first == 1); CHECK(NTH(map, 0)->second == 3);
+            CHECK(NTH(map, 1)->first == 5); CHECK(NTH(map, 1)->second == 2);
+            CHECK(NTH(map, 2)->first == 10); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 20); CHECK(NTH(map, 3)->second == 1);
+            CHECK(NTH(map, 4)->first == 25); CHECK(NTH(map, 4)->second == 2);
+            CHECK(NTH(map, 5)->first == 30); CHECK(NTH(map, 5)->second == 1);
+            CHECK(NTH(map, 6)->first == 40); CHECK(NTH(map, 6)->second == 2);
+            CHECK(NTH(map, 7)->first == 50); CHECK(NTH(map, 7)->second == 3);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_unique_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_unique_t(),
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            map.insert
+            (
+                sfl::sorted_unique_t(),
+                {
+                    {5, 2},
+                    {20, 2},
+                    {25, 2},
+                    {40, 2}
+                }
+            );
+
+            CHECK(map.size() == 6);
+            CHECK(NTH(map, 0)->first == 5); CHECK(NTH(map, 0)->second == 2);
+            CHECK(NTH(map, 1)->first == 10); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 20); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 25); CHECK(NTH(map, 3)->second == 2);
+            CHECK(NTH(map, 4)->first == 30); CHECK(NTH(map, 4)->second == 1);
+            CHECK(NTH(map, 5)->first == 40); CHECK(NTH(map, 5)->second == 2);
+        }
+
+        {
+            map.insert
+            (
+                sfl::sorted_unique_t(),
+                {
+                    {1, 3},
+                    {30, 3},
+                    {50, 3}
+                }
+            );
+
+            CHECK(map.size() == 8);
+            CHECK(NTH(map, 0)->first == 1); CHECK(NTH(map, 0)->second == 3);
+            CHECK(NTH(map, 1)->first == 5); CHECK(NTH(map, 1)->second == 2);
+            CHECK(NTH(map, 2)->first == 10); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 20); CHECK(NTH(map, 3)->second == 1);
+            CHECK(NTH(map, 4)->first == 25); CHECK(NTH(map, 4)->second == 2);
+            CHECK(NTH(map, 5)->first == 30); CHECK(NTH(map, 5)->second == 1);
+            CHECK(NTH(map, 6)->first == 40); CHECK(NTH(map, 6)->second == 2);
+            CHECK(NTH(map, 7)->first == 50); CHECK(NTH(map, 7)->second == 3);
+        }
+    }
+
+    PRINT("Test insert_range(sfl::sorted_unique_t, Range&&)");
+    {
+        using container_type = sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_unique_t(),
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {5, 2},
+                    {20, 2},
+                    {25, 2},
+                    {40, 2}
+                }
+            );
+
+            map.insert_range(sfl::sorted_unique_t(), data);
+
+            CHECK(map.size() == 6);
+            CHECK(NTH(map, 0)->first == 5); CHECK(NTH(map, 0)->second == 2);
+            CHECK(NTH(map, 1)->first == 10); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 20); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 25); CHECK(NTH(map, 3)->second == 2);
+            CHECK(NTH(map, 4)->first == 30); CHECK(NTH(map, 4)->second == 1);
+            CHECK(NTH(map, 5)->first == 40); CHECK(NTH(map, 5)->second == 2);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {1, 3},
+                    {30, 3},
+                    {50, 3}
+                }
+            );
+
+            map.insert_range(sfl::sorted_unique_t(), data);
+
+            CHECK(map.size() == 8);
+            CHECK(NTH(map, 0)->first == 1); CHECK(NTH(map, 0)->second == 3);
+            CHECK(NTH(map, 1)->first == 5); CHECK(NTH(map, 1)->second == 2);
+            CHECK(NTH(map, 2)->first == 10); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 20); CHECK(NTH(map, 3)->second == 1);
+            CHECK(NTH(map, 4)->first == 25); CHECK(NTH(map, 4)->second == 2);
+            CHECK(NTH(map, 5)->first == 30); CHECK(NTH(map, 5)->second == 1);
+            CHECK(NTH(map, 6)->first == 40); CHECK(NTH(map, 6)->second == 2);
+            CHECK(NTH(map, 7)->first == 50); CHECK(NTH(map, 7)->second == 3);
+        }
+    }
+
     PRINT("Test insert_or_assign(const Key&, M&&)");
     {
         sfl::static_map<xint, xint, 32, std::less<xint>> map;
@@ -1884,6 +2154,118 @@ void test_static_map()
         CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
         CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
     }
+
+    PRINT("Test NON-MEMBER set_union_into, set_intersection_into, set_difference_into");
+    {
+        using container_type =
+            sfl::static_map<xint, xint, 32, std::less<xint>>;
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(50, 2);
+
+            CHECK(set_union_into(x, y) == 1);
+            CHECK(x.size() == 5);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 20); CHECK(NTH(x, 1)->second == 1);
+            CHECK(NTH(x, 2)->first == 30); CHECK(NTH(x, 2)->second == 1);
+            CHECK(NTH(x, 3)->first == 40); CHECK(NTH(x, 3)->second == 1);
+            CHECK(NTH(x, 4)->first == 50); CHECK(NTH(x, 4)->second == 2);
+
+            container_type z;
+
+            z.emplace(5, 3);
+
+            CHECK(set_union_into(x, z) == 1);
+            CHECK(x.size() == 6);
+            CHECK(NTH(x, 0)->first ==  5); CHECK(NTH(x, 0)->second == 3);
+            CHECK(NTH(x, 5)->first == 50); CHECK(NTH(x, 5)->second == 2);
+
+            CHECK(set_union_into(x, x) == 0);
+            CHECK(x.size() == 6);
+
+            container_type e;
+
+            CHECK(set_union_into(e, y) == 3);
+            CHECK(e.size() == 3);
+            CHECK(NTH(e, 0)->first == 20); CHECK(NTH(e, 0)->second == 2);
+            CHECK(NTH(e, 1)->first == 40); CHECK(NTH(e, 1)->second == 2);
+            CHECK(NTH(e, 2)->first == 50); CHECK(NTH(e, 2)->second == 2);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+            x.emplace(50, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(60, 2);
+
+            CHECK(set_intersection_into(x, x) == 0);
+            CHECK(x.size() == 5);
+
+            CHECK(set_intersection_into(x, y) == 3);
+            CHECK(x.size() == 2);
+            CHECK(NTH(x, 0)->first == 20); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 40); CHECK(NTH(x, 1)->second == 1);
+
+            container_type e;
+
+            CHECK(set_intersection_into(x, e) == 2);
+            CHECK(x.size() == 0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+            x.emplace(50, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(60, 2);
+
+            CHECK(set_difference_into(x, y) == 2);
+            CHECK(x.size() == 3);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 30); CHECK(NTH(x, 1)->second == 1);
+            CHECK(NTH(x, 2)->first == 50); CHECK(NTH(x, 2)->second == 1);
+
+            container_type z;
+
+            z.emplace(30, 3);
+
+            CHECK(set_difference_into(x, z) == 1);
+            CHECK(x.size() == 2);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 50); CHECK(NTH(x, 1)->second == 1);
+
+            CHECK(set_difference_into(x, x) == 2);
+            CHECK(x.size() == 0);
+        }
+    }
 }
 
 int main()
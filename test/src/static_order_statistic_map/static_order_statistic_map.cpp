@@ -0,0 +1,2337 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/static_order_statistic_map.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "nth.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+#include "xobj.hpp"
+
+#include <sstream>
+#include <vector>
+
+void test_static_order_statistic_map()
+{
+    using sfl::test::xint;
+    using sfl::test::xobj;
+
+    PRINT("Test static_capacity");
+    {
+        CHECK((sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>::static_capacity == 32));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test container()");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.empty() == true);
+        CHECK(map.full() == false);
+        CHECK(map.size() == 0);
+        CHECK(map.max_size() == 32);
+        CHECK(map.capacity() == 32);
+        CHECK(map.available() == 32);
+    }
+
+    PRINT("Test container(const Compare&)");
+    {
+        std::less<xint> comp;
+
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map(comp);
+
+        CHECK(map.empty() == true);
+        CHECK(map.full() == false);
+        CHECK(map.size() == 0);
+        CHECK(map.max_size() == 32);
+        CHECK(map.capacity() == 32);
+        CHECK(map.available() == 32);
+    }
+
+    PRINT("Test container(InputIt, InputIt)");
+    {
+        std::vector<std::pair<int, int>> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map(data.begin(), data.end());
+
+        CHECK(map.empty() == false);
+        CHECK(map.full() == false);
+        CHECK(map.size() == 3);
+        CHECK(map.max_size() == 32);
+        CHECK(map.capacity() == 32);
+        CHECK(map.available() == 29);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+    }
+
+    PRINT("Test container(InputIt, InputIt, const Compare&)");
+    {
+        std::vector<std::pair<int, int>> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        std::less<xint> comp;
+
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map(data.begin(), data.end(), comp);
+
+        CHECK(map.empty() == false);
+        CHECK(map.full() == false);
+        CHECK(map.size() == 3);
+        CHECK(map.max_size() == 32);
+        CHECK(map.capacity() == 32);
+        CHECK(map.available() == 29);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+    }
+
+    PRINT("Test container(std::initializer_list)");
+    {
+        std::initializer_list<std::pair<const xint, xint>> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map(ilist);
+
+        CHECK(map.empty() == false);
+        CHECK(map.full() == false);
+        CHECK(map.size() == 3);
+        CHECK(map.max_size() == 32);
+        CHECK(map.capacity() == 32);
+        CHECK(map.available() == 29);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+    }
+
+    PRINT("Test container(std::initializer_list, const Compare&)");
+    {
+        std::initializer_list<std::pair<const xint, xint>> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        std::less<xint> comp;
+
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map(ilist, comp);
+
+        CHECK(map.empty() == false);
+        CHECK(map.full() == false);
+        CHECK(map.size() == 3);
+        CHECK(map.max_size() == 32);
+        CHECK(map.capacity() == 32);
+        CHECK(map.available() == 29);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+    }
+
+    PRINT("Test container(const container&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map1;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map2(map1);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 10); CHECK(NTH(map2, 0)->second == 1);
+        CHECK(NTH(map2, 1)->first == 20); CHECK(NTH(map2, 1)->second == 1);
+        CHECK(NTH(map2, 2)->first == 30); CHECK(NTH(map2, 2)->second == 1);
+
+        CHECK(map2.max_size() == 32);
+        CHECK(map2.capacity() == 32);
+        CHECK(map2.available() == 29);
+    }
+
+    PRINT("Test container(container&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map1;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map2(std::move(map1));
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == +10); CHECK(NTH(map1, 0)->second == -1);
+        CHECK(NTH(map1, 1)->first == +20); CHECK(NTH(map1, 1)->second == -1);
+        CHECK(NTH(map1, 2)->first == +30); CHECK(NTH(map1, 2)->second == -1);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 10); CHECK(NTH(map2, 0)->second == 1);
+        CHECK(NTH(map2, 1)->first == 20); CHECK(NTH(map2, 1)->second == 1);
+        CHECK(NTH(map2, 2)->first == 30); CHECK(NTH(map2, 2)->second == 1);
+
+        CHECK(map2.max_size() == 32);
+        CHECK(map2.capacity() == 32);
+        CHECK(map2.available() == 29);
+    }
+
+    PRINT("Test container(sfl::from_range_t, Range&&)");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 1 20 1 30 1 20 2 20 3");
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                (sfl::from_range_t()),
+                (std::views::istream<std::pair<int, int>>(iss))
+            );
+            #else
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                (sfl::from_range_t()),
+                (sfl::test::istream_view<std::pair<int, int>>(iss))
+            );
+            #endif
+
+            CHECK(map.empty() == false);
+            CHECK(map.size() == 3);
+            CHECK(map.max_size() > 0);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+
+        // Forward iterator
+        {
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {10, 1},
+                    {20, 1},
+                    {30, 1},
+                    {20, 2},
+                    {20, 3}
+                }
+            );
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                sfl::from_range_t(),
+                std::views::all(data)
+            );
+            #else
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                sfl::from_range_t(),
+                data
+            );
+            #endif
+
+            CHECK(map.empty() == false);
+            CHECK(map.size() == 3);
+            CHECK(map.max_size() > 0);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::from_range_t, Range&&, const Compare&)");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 1 20 1 30 1 20 2 20 3");
+
+            std::less<xint> comp;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                (sfl::from_range_t()),
+                (std::views::istream<std::pair<int, int>>(iss)),
+                comp
+            );
+            #else
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                (sfl::from_range_t()),
+                (sfl::test::istream_view<std::pair<int, int>>(iss)),
+                comp
+            );
+            #endif
+
+            CHECK(map.empty() == false);
+            CHECK(map.size() == 3);
+            CHECK(map.max_size() > 0);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+
+        // Forward iterator
+        {
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {10, 1},
+                    {20, 1},
+                    {30, 1},
+                    {20, 2},
+                    {20, 3}
+                }
+            );
+
+            std::less<xint> comp;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                sfl::from_range_t(),
+                std::views::all(data),
+                comp
+            );
+            #else
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map
+            (
+                sfl::from_range_t(),
+                data,
+                comp
+            );
+            #endif
+
+            CHECK(map.empty() == false);
+            CHECK(map.size() == 3);
+            CHECK(map.max_size() > 0);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test operator=(const container&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        map2.emplace(40, 2);
+        map2.emplace(50, 2);
+        map2.emplace(60, 2);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 40); CHECK(NTH(map2, 0)->second == 2);
+        CHECK(NTH(map2, 1)->first == 50); CHECK(NTH(map2, 1)->second == 2);
+        CHECK(NTH(map2, 2)->first == 60); CHECK(NTH(map2, 2)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        map2 = map1;
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 10); CHECK(NTH(map2, 0)->second == 1);
+        CHECK(NTH(map2, 1)->first == 20); CHECK(NTH(map2, 1)->second == 1);
+        CHECK(NTH(map2, 2)->first == 30); CHECK(NTH(map2, 2)->second == 1);
+    }
+
+    PRINT("Test operator=(container&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        map2.emplace(40, 2);
+        map2.emplace(50, 2);
+        map2.emplace(60, 2);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 40); CHECK(NTH(map2, 0)->second == 2);
+        CHECK(NTH(map2, 1)->first == 50); CHECK(NTH(map2, 1)->second == 2);
+        CHECK(NTH(map2, 2)->first == 60); CHECK(NTH(map2, 2)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        map2 = std::move(map1);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == +10); CHECK(NTH(map1, 0)->second == -1);
+        CHECK(NTH(map1, 1)->first == +20); CHECK(NTH(map1, 1)->second == -1);
+        CHECK(NTH(map1, 2)->first == +30); CHECK(NTH(map1, 2)->second == -1);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 10); CHECK(NTH(map2, 0)->second == 1);
+        CHECK(NTH(map2, 1)->first == 20); CHECK(NTH(map2, 1)->second == 1);
+        CHECK(NTH(map2, 2)->first == 30); CHECK(NTH(map2, 2)->second == 1);
+    }
+
+    PRINT("Test operator=(std::initializer_list)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        std::initializer_list<std::pair<const xint, xint>> ilist
+        {
+            {40, 2},
+            {50, 2},
+            {60, 2},
+            {50, 3},
+            {50, 4}
+        };
+
+        map = ilist;
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 40); CHECK(NTH(map, 0)->second == 2);
+        CHECK(NTH(map, 1)->first == 50); CHECK(NTH(map, 1)->second == 2);
+        CHECK(NTH(map, 2)->first == 60); CHECK(NTH(map, 2)->second == 2);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test key_comp()");
+    {
+        {
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+            auto key_comp = map.key_comp();
+
+            CHECK(key_comp(10, 10) == false);
+            CHECK(key_comp(10, 20) == true);
+            CHECK(key_comp(20, 10) == false);
+            CHECK(key_comp(20, 20) == false);
+        }
+
+        {
+            sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+            auto key_comp = map.key_comp();
+
+            CHECK(key_comp(xobj(10), 10) == false);
+            CHECK(key_comp(xobj(10), 20) == true);
+            CHECK(key_comp(xobj(20), 10) == false);
+            CHECK(key_comp(xobj(20), 20) == false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test value_comp()");
+    {
+        {
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+            auto value_comp = map.value_comp();
+
+            CHECK(value_comp({10, 1}, {10, 2}) == false);
+            CHECK(value_comp({10, 1}, {20, 2}) == true);
+            CHECK(value_comp({20, 1}, {10, 2}) == false);
+            CHECK(value_comp({20, 1}, {20, 2}) == false);
+        }
+
+        {
+            sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+            auto value_comp = map.value_comp();
+
+            CHECK(value_comp({xobj(10), 1}, {xobj(10), 2}) == false);
+            CHECK(value_comp({xobj(10), 1}, {xobj(20), 2}) == true);
+            CHECK(value_comp({xobj(20), 1}, {xobj(10), 2}) == false);
+            CHECK(value_comp({xobj(20), 1}, {xobj(20), 2}) == false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test begin, end, cbegin, cend, rbegin, rend, crbegin, crend");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(20, 1);
+        map.emplace(40, 1);
+        map.emplace(60, 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto it = map.begin();
+        CHECK(it->first == 20); CHECK(it->second == 1); ++it;
+        CHECK(it->first == 40); CHECK(it->second == 1); ++it;
+        CHECK(it->first == 60); CHECK(it->second == 1); ++it;
+        CHECK(it == map.end());
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto cit = map.cbegin();
+        CHECK(cit->first == 20); CHECK(cit->second == 1); ++cit;
+        CHECK(cit->first == 40); CHECK(cit->second == 1); ++cit;
+        CHECK(cit->first == 60); CHECK(cit->second == 1); ++cit;
+        CHECK(cit == map.cend());
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto rit = map.rbegin();
+        CHECK(rit->first == 60); CHECK(rit->second == 1); ++rit;
+        CHECK(rit->first == 40); CHECK(rit->second == 1); ++rit;
+        CHECK(rit->first == 20); CHECK(rit->second == 1); ++rit;
+        CHECK(rit == map.rend());
+
+        ///////////////////////////////////////////////////////////////////////
+
+        auto crit = map.crbegin();
+        CHECK(crit->first == 60); CHECK(crit->second == 1); ++crit;
+        CHECK(crit->first == 40); CHECK(crit->second == 1); ++crit;
+        CHECK(crit->first == 20); CHECK(crit->second == 1); ++crit;
+        CHECK(crit == map.crend());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test nth(size_type), index_of(const_iterator), order_of_key(const Key&)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 100, std::less<xint>>;
+
+        container_type map;
+
+        // Insert keys 0, 10, 20, ..., 990 in scrambled order.
+        for (int i = 0; i < 100; ++i)
+        {
+            map.emplace(10 * ((i * 37) % 100), i);
+        }
+
+        CHECK(map.size() == 100);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(map.nth(i)->first == 10 * i);
+            CHECK(map.index_of(map.nth(i)) == std::size_t(i));
+            CHECK(map.order_of_key(10 * i) == std::size_t(i));
+            CHECK(map.order_of_key(10 * i + 5) == std::size_t(i + 1));
+        }
+
+        CHECK(map.nth(100) == map.end());
+        CHECK(map.index_of(map.end()) == 100);
+        CHECK(map.order_of_key(-1) == 0);
+
+        // Erase every other key.
+        for (int i = 1; i < 100; i += 2)
+        {
+            CHECK(map.erase(10 * i) == 1);
+        }
+
+        CHECK(map.size() == 50);
+
+        for (int i = 0; i < 50; ++i)
+        {
+            CHECK(map.nth(i)->first == 20 * i);
+            CHECK(map.index_of(map.nth(i)) == std::size_t(i));
+            CHECK(map.order_of_key(20 * i) == std::size_t(i));
+            CHECK(map.order_of_key(20 * i + 10) == std::size_t(i + 1));
+        }
+
+        // Copy and sorted construction keep subtree sizes.
+        {
+            const container_type copy(map);
+
+            for (int i = 0; i < 50; ++i)
+            {
+                CHECK(copy.nth(i)->first == 20 * i);
+            }
+
+            const container_type sorted(sfl::sorted_unique_t(), map.begin(), map.end());
+
+            for (int i = 0; i < 50; ++i)
+            {
+                CHECK(sorted.nth(i)->first == 20 * i);
+                CHECK(sorted.order_of_key(20 * i) == std::size_t(i));
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test lower_bound, upper_bound, equal_range, find, count, contains");
+    {
+        // xint, xint
+        {
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint> > map;
+
+            map.emplace(20, 1);
+            map.emplace(40, 1);
+            map.emplace(60, 1);
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.lower_bound(10) == NTH(map, 0));
+            CHECK(map.lower_bound(20) == NTH(map, 0));
+            CHECK(map.lower_bound(30) == NTH(map, 1));
+            CHECK(map.lower_bound(40) == NTH(map, 1));
+            CHECK(map.lower_bound(50) == NTH(map, 2));
+            CHECK(map.lower_bound(60) == NTH(map, 2));
+            CHECK(map.lower_bound(70) == NTH(map, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.upper_bound(10) == NTH(map, 0));
+            CHECK(map.upper_bound(20) == NTH(map, 1));
+            CHECK(map.upper_bound(30) == NTH(map, 1));
+            CHECK(map.upper_bound(40) == NTH(map, 2));
+            CHECK(map.upper_bound(50) == NTH(map, 2));
+            CHECK(map.upper_bound(60) == NTH(map, 3));
+            CHECK(map.upper_bound(70) == NTH(map, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.equal_range(10) == std::make_pair(NTH(map, 0), NTH(map, 0)));
+            CHECK(map.equal_range(20) == std::make_pair(NTH(map, 0), NTH(map, 1)));
+            CHECK(map.equal_range(30) == std::make_pair(NTH(map, 1), NTH(map, 1)));
+            CHECK(map.equal_range(40) == std::make_pair(NTH(map, 1), NTH(map, 2)));
+            CHECK(map.equal_range(50) == std::make_pair(NTH(map, 2), NTH(map, 2)));
+            CHECK(map.equal_range(60) == std::make_pair(NTH(map, 2), NTH(map, 3)));
+            CHECK(map.equal_range(70) == std::make_pair(NTH(map, 3), NTH(map, 3)));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.find(10) == map.end());
+            CHECK(map.find(20) == NTH(map, 0));
+            CHECK(map.find(30) == map.end());
+            CHECK(map.find(40) == NTH(map, 1));
+            CHECK(map.find(50) == map.end());
+            CHECK(map.find(60) == NTH(map, 2));
+            CHECK(map.find(70) == map.end());
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.count(10) == 0);
+            CHECK(map.count(20) == 1);
+            CHECK(map.count(30) == 0);
+            CHECK(map.count(40) == 1);
+            CHECK(map.count(50) == 0);
+            CHECK(map.count(60) == 1);
+            CHECK(map.count(70) == 0);
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.contains(10) == false);
+            CHECK(map.contains(20) == true);
+            CHECK(map.contains(30) == false);
+            CHECK(map.contains(40) == true);
+            CHECK(map.contains(50) == false);
+            CHECK(map.contains(60) == true);
+            CHECK(map.contains(70) == false);
+        }
+
+        // xobj, xint
+        {
+            sfl::static_order_statistic_map<xobj, xint, 32, xobj::less > map;
+
+            map.emplace(std::piecewise_construct, std::forward_as_tuple(20), std::forward_as_tuple(1));
+            map.emplace(std::piecewise_construct, std::forward_as_tuple(40), std::forward_as_tuple(1));
+            map.emplace(std::piecewise_construct, std::forward_as_tuple(60), std::forward_as_tuple(1));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.lower_bound(10) == NTH(map, 0));
+            CHECK(map.lower_bound(20) == NTH(map, 0));
+            CHECK(map.lower_bound(30) == NTH(map, 1));
+            CHECK(map.lower_bound(40) == NTH(map, 1));
+            CHECK(map.lower_bound(50) == NTH(map, 2));
+            CHECK(map.lower_bound(60) == NTH(map, 2));
+            CHECK(map.lower_bound(70) == NTH(map, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.upper_bound(10) == NTH(map, 0));
+            CHECK(map.upper_bound(20) == NTH(map, 1));
+            CHECK(map.upper_bound(30) == NTH(map, 1));
+            CHECK(map.upper_bound(40) == NTH(map, 2));
+            CHECK(map.upper_bound(50) == NTH(map, 2));
+            CHECK(map.upper_bound(60) == NTH(map, 3));
+            CHECK(map.upper_bound(70) == NTH(map, 3));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.equal_range(10) == std::make_pair(NTH(map, 0), NTH(map, 0)));
+            CHECK(map.equal_range(20) == std::make_pair(NTH(map, 0), NTH(map, 1)));
+            CHECK(map.equal_range(30) == std::make_pair(NTH(map, 1), NTH(map, 1)));
+            CHECK(map.equal_range(40) == std::make_pair(NTH(map, 1), NTH(map, 2)));
+            CHECK(map.equal_range(50) == std::make_pair(NTH(map, 2), NTH(map, 2)));
+            CHECK(map.equal_range(60) == std::make_pair(NTH(map, 2), NTH(map, 3)));
+            CHECK(map.equal_range(70) == std::make_pair(NTH(map, 3), NTH(map, 3)));
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.find(10) == map.end());
+            CHECK(map.find(20) == NTH(map, 0));
+            CHECK(map.find(30) == map.end());
+            CHECK(map.find(40) == NTH(map, 1));
+            CHECK(map.find(50) == map.end());
+            CHECK(map.find(60) == NTH(map, 2));
+            CHECK(map.find(70) == map.end());
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.count(10) == 0);
+            CHECK(map.count(20) == 1);
+            CHECK(map.count(30) == 0);
+            CHECK(map.count(40) == 1);
+            CHECK(map.count(50) == 0);
+            CHECK(map.count(60) == 1);
+            CHECK(map.count(70) == 0);
+
+            ///////////////////////////////////////////////////////////////////////
+
+            CHECK(map.contains(10) == false);
+            CHECK(map.contains(20) == true);
+            CHECK(map.contains(30) == false);
+            CHECK(map.contains(40) == true);
+            CHECK(map.contains(50) == false);
+            CHECK(map.contains(60) == true);
+            CHECK(map.contains(70) == false);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test emplace(Args&&...)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const auto res = map.emplace(10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const auto res = map.emplace(10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test emplace_hint(const_iterator, Args&&...)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const auto res = map.emplace_hint(map.begin(), 10, 1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const auto res = map.emplace_hint(map.begin(), 10, 2);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(const value_type&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        using value_type = std::pair<const xint, xint>;
+
+        {
+            const value_type value_10_1(10, 1);
+
+            const auto res = map.insert(value_10_1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const value_type value_10_2(10, 2);
+
+            const auto res = map.insert(value_10_2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(value_type&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        using value_type = std::pair<const xint, xint>;
+
+        {
+            value_type value_10_1(10, 1);
+
+            const auto res = map.insert(std::move(value_10_1));
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(value_10_1.first  == +10);
+            CHECK(value_10_1.second == -1);
+        }
+
+        {
+            value_type value_10_2(10, 2);
+
+            const auto res = map.insert(std::move(value_10_2));
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(value_10_2.first  == +10);
+            CHECK(value_10_2.second == +2);
+        }
+    }
+
+    PRINT("Test insert(P&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        using value_type = std::pair<long, long>;
+
+        {
+            value_type value_10_1(10, 1);
+
+            const auto res = map.insert(value_10_1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            value_type value_10_2(10, 2);
+
+            const auto res = map.insert(value_10_2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(const_iterator, const value_type&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        using value_type = std::pair<const xint, xint>;
+
+        {
+            const value_type value_10_1(10, 1);
+
+            const auto res = map.insert(map.begin(), value_10_1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const value_type value_10_2(10, 2);
+
+            const auto res = map.insert(map.begin(), value_10_2);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(const_iterator, value_type&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        using value_type = std::pair<const xint, xint>;
+
+        {
+            value_type value_10_1(10, 1);
+
+            const auto res = map.insert(map.begin(), std::move(value_10_1));
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(value_10_1.first  == +10);
+            CHECK(value_10_1.second == -1);
+        }
+
+        {
+            value_type value_10_2(10, 2);
+
+            const auto res = map.insert(map.begin(), std::move(value_10_2));
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(value_10_2.first  == +10);
+            CHECK(value_10_2.second == +2);
+        }
+    }
+
+    PRINT("Test insert(const_iterator, P&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        using value_type = std::pair<long, long>;
+
+        {
+            value_type value_10_1(10, 1);
+
+            const auto res = map.insert(map.begin(), value_10_1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            value_type value_10_2(10, 2);
+
+            const auto res = map.insert(map.begin(), value_10_2);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert(InputIt, InputIt");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        std::vector<std::pair<const xint, xint>> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1},
+                {20, 2},
+                {20, 3}
+            }
+        );
+
+        map.insert(data.begin(), data.end());
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+    }
+
+    PRINT("Test insert(std::initializer_list");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        std::initializer_list<std::pair<const xint, xint>> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1},
+            {20, 2},
+            {20, 3}
+        };
+
+        map.insert(ilist);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+    }
+
+    PRINT("Test insert_range(Range&&");
+    {
+        // Input iterator (exactly)
+        {
+            std::istringstream iss("10 1 20 1 30 1 20 2 20 3");
+
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            map.insert_range(std::views::istream<std::pair<int, int>>(iss));
+            #else
+            map.insert_range(sfl::test::istream_view<std::pair<int, int>>(iss));
+            #endif
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+
+        // Forward iterator
+        {
+            std::vector<std::pair<xint, xint>> data
+            (
+                {
+                    {10, 1},
+                    {20, 1},
+                    {30, 1},
+                    {20, 2},
+                    {20, 3}
+                }
+            );
+
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+            #if SFL_CPP_VERSION >= SFL_CPP_20
+            map.insert_range(std::views::all(data));
+            #else
+            map.insert_range(data);
+            #endif
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            container_type map(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, InputIt, InputIt, const Compare&)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type map(sfl::sorted_unique_t(), data.begin(), data.end(), comp);
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1}
+        };
+
+        {
+            container_type map(sfl::sorted_unique_t(), ilist);
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, std::initializer_list, const Compare&)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            {10, 1},
+            {20, 1},
+            {30, 1}
+        };
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type map(sfl::sorted_unique_t(), ilist, comp);
+
+            CHECK(map.size() == 3);
+            CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_unique_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_unique_t(),
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {5, 2},
+                    {20, 2},
+                    {25, 2},
+                    {40, 2}
+                }
+            );
+
+            map.insert(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 6);
+            CHECK(NTH(map, 0)->first == 5); CHECK(NTH(map, 0)->second == 2);
+            CHECK(NTH(map, 1)->first == 10); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 20); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 25); CHECK(NTH(map, 3)->second == 2);
+            CHECK(NTH(map, 4)->first == 30); CHECK(NTH(map, 4)->second == 1);
+            CHECK(NTH(map, 5)->first == 40); CHECK(NTH(map, 5)->second == 2);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {1, 3},
+                    {30, 3},
+                    {50, 3}
+                }
+            );
+
+            map.insert(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(map.size() == 8);
+            CHECK(NTH(map, 0)->first == 1); CHECK(NTH(map, 0)->second == 3);
+            CHECK(NTH(map, 1)->first == 5); CHECK(NTH(map, 1)->second == 2);
+            CHECK(NTH(map, 2)->first == 10); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 20); CHECK(NTH(map, 3)->second == 1);
+            CHECK(NTH(map, 4)->first == 25); CHECK(NTH(map, 4)->second == 2);
+            CHECK(NTH(map, 5)->first == 30); CHECK(NTH(map, 5)->second == 1);
+            CHECK(NTH(map, 6)->first == 40); CHECK(NTH(map, 6)->second == 2);
+            CHECK(NTH(map, 7)->first == 50); CHECK(NTH(map, 7)->second == 3);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_unique_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_unique_t(),
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            map.insert
+            (
+                sfl::sorted_unique_t(),
+                {
+                    {5, 2},
+                    {20, 2},
+                    {25, 2},
+                    {40, 2}
+                }
+            );
+
+            CHECK(map.size() == 6);
+            CHECK(NTH(map, 0)->first == 5); CHECK(NTH(map, 0)->second == 2);
+            CHECK(NTH(map, 1)->first == 10); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 20); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 25); CHECK(NTH(map, 3)->second == 2);
+            CHECK(NTH(map, 4)->first == 30); CHECK(NTH(map, 4)->second == 1);
+            CHECK(NTH(map, 5)->first == 40); CHECK(NTH(map, 5)->second == 2);
+        }
+
+        {
+            map.insert
+            (
+                sfl::sorted_unique_t(),
+                {
+                    {1, 3},
+                    {30, 3},
+                    {50, 3}
+                }
+            );
+
+            CHECK(map.size() == 8);
+            CHECK(NTH(map, 0)->first == 1); CHECK(NTH(map, 0)->second == 3);
+            CHECK(NTH(map, 1)->first == 5); CHECK(NTH(map, 1)->second == 2);
+            CHECK(NTH(map, 2)->first == 10); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 20); CHECK(NTH(map, 3)->second == 1);
+            CHECK(NTH(map, 4)->first == 25); CHECK(NTH(map, 4)->second == 2);
+            CHECK(NTH(map, 5)->first == 30); CHECK(NTH(map, 5)->second == 1);
+            CHECK(NTH(map, 6)->first == 40); CHECK(NTH(map, 6)->second == 2);
+            CHECK(NTH(map, 7)->first == 50); CHECK(NTH(map, 7)->second == 3);
+        }
+    }
+
+    PRINT("Test insert_range(sfl::sorted_unique_t, Range&&)");
+    {
+        using container_type = sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        container_type map
+        (
+            sfl::sorted_unique_t(),
+            {
+                {10, 1},
+                {20, 1},
+                {30, 1}
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {5, 2},
+                    {20, 2},
+                    {25, 2},
+                    {40, 2}
+                }
+            );
+
+            map.insert_range(sfl::sorted_unique_t(), data);
+
+            CHECK(map.size() == 6);
+            CHECK(NTH(map, 0)->first == 5); CHECK(NTH(map, 0)->second == 2);
+            CHECK(NTH(map, 1)->first == 10); CHECK(NTH(map, 1)->second == 1);
+            CHECK(NTH(map, 2)->first == 20); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 25); CHECK(NTH(map, 3)->second == 2);
+            CHECK(NTH(map, 4)->first == 30); CHECK(NTH(map, 4)->second == 1);
+            CHECK(NTH(map, 5)->first == 40); CHECK(NTH(map, 5)->second == 2);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    {1, 3},
+                    {30, 3},
+                    {50, 3}
+                }
+            );
+
+            map.insert_range(sfl::sorted_unique_t(), data);
+
+            CHECK(map.size() == 8);
+            CHECK(NTH(map, 0)->first == 1); CHECK(NTH(map, 0)->second == 3);
+            CHECK(NTH(map, 1)->first == 5); CHECK(NTH(map, 1)->second == 2);
+            CHECK(NTH(map, 2)->first == 10); CHECK(NTH(map, 2)->second == 1);
+            CHECK(NTH(map, 3)->first == 20); CHECK(NTH(map, 3)->second == 1);
+            CHECK(NTH(map, 4)->first == 25); CHECK(NTH(map, 4)->second == 2);
+            CHECK(NTH(map, 5)->first == 30); CHECK(NTH(map, 5)->second == 1);
+            CHECK(NTH(map, 6)->first == 40); CHECK(NTH(map, 6)->second == 2);
+            CHECK(NTH(map, 7)->first == 50); CHECK(NTH(map, 7)->second == 3);
+        }
+    }
+
+    PRINT("Test insert_or_assign(const Key&, M&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.insert_or_assign(key_10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.insert_or_assign(key_10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 2);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert_or_assign(Key&&, M&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            xint key_10(10);
+
+            const auto res = map.insert_or_assign(std::move(key_10), 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == -10);
+        }
+
+        {
+            xint key_10(10);
+
+            const auto res = map.insert_or_assign(std::move(key_10), 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 2);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == +10);
+        }
+    }
+
+    PRINT("Test insert_or_assign(K&&, M&&)");
+    {
+        sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const auto res = map.insert_or_assign(10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first.value() == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const auto res = map.insert_or_assign(10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first.value() == 10); CHECK(res.first->second == 2);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert_or_assign(const_iterator, const Key&, M&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.insert_or_assign(map.begin(), key_10, 1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.insert_or_assign(map.begin(), key_10, 2);
+
+            CHECK(res->first == 10); CHECK(res->second == 2);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test insert_or_assign(const_iterator, Key&&, M&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            xint key_10(10);
+
+            const auto res = map.insert_or_assign(map.begin(), std::move(key_10), 1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == -10);
+        }
+
+        {
+            xint key_10(10);
+
+            const auto res = map.insert_or_assign(map.begin(), std::move(key_10), 2);
+
+            CHECK(res->first == 10); CHECK(res->second == 2);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == +10);
+        }
+    }
+
+    PRINT("Test insert_or_assign(const_iterator, K&&, M&&)");
+    {
+        sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const auto res = map.insert_or_assign(map.begin(), 10, 1);
+
+            CHECK(res->first.value() == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const auto res = map.insert_or_assign(map.begin(), 10, 2);
+
+            CHECK(res->first.value() == 10); CHECK(res->second == 2);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test try_emplace(const Key&, Args&&...)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.try_emplace(key_10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.try_emplace(key_10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test try_emplace(Key&&, Args&&...)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            xint key_10(10);
+
+            const auto res = map.try_emplace(std::move(key_10), 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == -10);
+        }
+
+        {
+            xint key_10(10);
+
+            const auto res = map.try_emplace(std::move(key_10), 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == +10);
+        }
+    }
+
+    PRINT("Test try_emplace(K&&, Args&&...)");
+    {
+        sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const auto res = map.try_emplace(10, 1);
+
+            CHECK(res.second == true);
+            CHECK(res.first->first.value() == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const auto res = map.try_emplace(10, 2);
+
+            CHECK(res.second == false);
+            CHECK(res.first->first.value() == 10); CHECK(res.first->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test try_emplace(const_iterator, const Key&, Args&&...)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.try_emplace(map.begin(), key_10, 1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const xint key_10(10);
+
+            const auto res = map.try_emplace(map.begin(), key_10, 2);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test try_emplace(const_iterator, Key&&, Args&&...)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            xint key_10(10);
+
+            const auto res = map.try_emplace(map.begin(), std::move(key_10), 1);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == -10);
+        }
+
+        {
+            xint key_10(10);
+
+            const auto res = map.try_emplace(map.begin(), std::move(key_10), 2);
+
+            CHECK(res->first == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+
+            CHECK(key_10 == +10);
+        }
+    }
+
+    PRINT("Test try_emplace(const_iterator, K&&, Args&&...)");
+    {
+        sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+        CHECK(map.size() == 0);
+
+        {
+            const auto res = map.try_emplace(map.begin(), 10, 1);
+
+            CHECK(res->first.value() == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+
+        {
+            const auto res = map.try_emplace(map.begin(), 10, 2);
+
+            CHECK(res->first.value() == 10); CHECK(res->second == 1);
+
+            CHECK(map.size() == 1);
+        }
+    }
+
+    PRINT("Test erase(const_iterator)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        {
+            const auto res = map.erase(map.begin());
+
+            CHECK(res == map.begin());
+            CHECK(map.size() == 2);
+            CHECK(NTH(map, 0)->first == 20); CHECK(NTH(map, 0)->second == 1);
+            CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
+        }
+
+        {
+            const auto res = map.erase(map.begin());
+
+            CHECK(res == map.begin());
+            CHECK(map.size() == 1);
+            CHECK(NTH(map, 0)->first == 30); CHECK(NTH(map, 0)->second == 1);
+        }
+
+        {
+            const auto res = map.erase(map.begin());
+
+            CHECK(res == map.end());
+            CHECK(map.size() == 0);
+        }
+    }
+
+    PRINT("Test erase(const_iterator, const_iterator)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        const auto res = map.erase(NTH(map, 1), NTH(map, 2));
+
+        CHECK(res == NTH(map, 1));
+        CHECK(map.size() == 2);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 0)->second == 1);
+    }
+
+    PRINT("Test erase(const Key&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        CHECK(map.erase(30) == 1);
+        CHECK(map.erase(30) == 0);
+        CHECK(map.size() == 2);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+
+        CHECK(map.erase(20) == 1);
+        CHECK(map.erase(20) == 0);
+        CHECK(map.size() == 1);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+
+        CHECK(map.erase(10) == 1);
+        CHECK(map.erase(10) == 0);
+        CHECK(map.size() == 0);
+    }
+
+    PRINT("Test erase(K&&)");
+    {
+        sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(10), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(20), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(30), std::forward_as_tuple(1));
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first.value() == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first.value() == 30); CHECK(NTH(map, 2)->second == 1);
+
+        CHECK(map.erase(30) == 1);
+        CHECK(map.erase(30) == 0);
+        CHECK(map.size() == 2);
+        CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first.value() == 20); CHECK(NTH(map, 1)->second == 1);
+
+        CHECK(map.erase(20) == 1);
+        CHECK(map.erase(20) == 0);
+        CHECK(map.size() == 1);
+        CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 1);
+
+        CHECK(map.erase(10) == 1);
+        CHECK(map.erase(10) == 0);
+        CHECK(map.size() == 0);
+    }
+
+    PRINT("Test swap(container&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        map2.emplace(40, 2);
+        map2.emplace(50, 2);
+        map2.emplace(60, 2);
+        map2.emplace(70, 2);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        CHECK(map2.size() == 4);
+        CHECK(NTH(map2, 0)->first == 40); CHECK(NTH(map2, 0)->second == 2);
+        CHECK(NTH(map2, 1)->first == 50); CHECK(NTH(map2, 1)->second == 2);
+        CHECK(NTH(map2, 2)->first == 60); CHECK(NTH(map2, 2)->second == 2);
+        CHECK(NTH(map2, 3)->first == 70); CHECK(NTH(map2, 3)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        map1.swap(map2);
+
+        CHECK(map1.size() == 4);
+        CHECK(NTH(map1, 0)->first == 40); CHECK(NTH(map1, 0)->second == 2);
+        CHECK(NTH(map1, 1)->first == 50); CHECK(NTH(map1, 1)->second == 2);
+        CHECK(NTH(map1, 2)->first == 60); CHECK(NTH(map1, 2)->second == 2);
+        CHECK(NTH(map1, 3)->first == 70); CHECK(NTH(map1, 3)->second == 2);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 10); CHECK(NTH(map2, 0)->second == 1);
+        CHECK(NTH(map2, 1)->first == 20); CHECK(NTH(map2, 1)->second == 1);
+        CHECK(NTH(map2, 2)->first == 30); CHECK(NTH(map2, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////
+
+        map1.swap(map2);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        CHECK(map2.size() == 4);
+        CHECK(NTH(map2, 0)->first == 40); CHECK(NTH(map2, 0)->second == 2);
+        CHECK(NTH(map2, 1)->first == 50); CHECK(NTH(map2, 1)->second == 2);
+        CHECK(NTH(map2, 2)->first == 60); CHECK(NTH(map2, 2)->second == 2);
+        CHECK(NTH(map2, 3)->first == 70); CHECK(NTH(map2, 3)->second == 2);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test at(const Key&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.at(10) == 1);
+        CHECK(map.at(20) == 1);
+        CHECK(map.at(30) == 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        map.at(10) = 2;
+        map.at(20) = 2;
+        map.at(30) = 2;
+
+        CHECK(map.at(10) == 2);
+        CHECK(map.at(20) == 2);
+        CHECK(map.at(30) == 2);
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            map.at(40) = 1;
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        #endif
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 2);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 2);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 2);
+    }
+
+    PRINT("Test at(const K&)");
+    {
+        sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(10), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(20), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(30), std::forward_as_tuple(1));
+
+        CHECK(map.at(10) == 1);
+        CHECK(map.at(20) == 1);
+        CHECK(map.at(30) == 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first.value() == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first.value() == 30); CHECK(NTH(map, 2)->second == 1);
+
+        map.at(10) = 2;
+        map.at(20) = 2;
+        map.at(30) = 2;
+
+        CHECK(map.at(10) == 2);
+        CHECK(map.at(20) == 2);
+        CHECK(map.at(30) == 2);
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            map.at(40) = 1;
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        #endif
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 2);
+        CHECK(NTH(map, 1)->first.value() == 20); CHECK(NTH(map, 1)->second == 2);
+        CHECK(NTH(map, 2)->first.value() == 30); CHECK(NTH(map, 2)->second == 2);
+    }
+
+    PRINT("Test operator[](const Key&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        xint key_10 = 10;
+        xint key_20 = 20;
+        xint key_30 = 30;
+        xint key_40 = 40;
+        xint key_50 = 50;
+        xint key_60 = 60;
+
+        map[key_10] = 2;
+        map[key_20] = 2;
+        map[key_30] = 2;
+        map[key_40] = 2;
+        map[key_50] = 2;
+        map[key_60] = 2;
+
+        CHECK(map.size() == 6);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 2);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 2);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 2);
+        CHECK(NTH(map, 3)->first == 40); CHECK(NTH(map, 3)->second == 2);
+        CHECK(NTH(map, 4)->first == 50); CHECK(NTH(map, 4)->second == 2);
+        CHECK(NTH(map, 5)->first == 60); CHECK(NTH(map, 5)->second == 2);
+
+        CHECK(key_10 == 10);
+        CHECK(key_20 == 20);
+        CHECK(key_30 == 30);
+        CHECK(key_40 == 40);
+        CHECK(key_50 == 50);
+        CHECK(key_60 == 60);
+    }
+
+    PRINT("Test operator[](Key&&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        xint key_10 = 10;
+        xint key_20 = 20;
+        xint key_30 = 30;
+        xint key_40 = 40;
+        xint key_50 = 50;
+        xint key_60 = 60;
+
+        map[std::move(key_10)] = 2;
+        map[std::move(key_20)] = 2;
+        map[std::move(key_30)] = 2;
+        map[std::move(key_40)] = 2;
+        map[std::move(key_50)] = 2;
+        map[std::move(key_60)] = 2;
+
+        CHECK(map.size() == 6);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 2);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 2);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 2);
+        CHECK(NTH(map, 3)->first == 40); CHECK(NTH(map, 3)->second == 2);
+        CHECK(NTH(map, 4)->first == 50); CHECK(NTH(map, 4)->second == 2);
+        CHECK(NTH(map, 5)->first == 60); CHECK(NTH(map, 5)->second == 2);
+
+        CHECK(key_10 == +10);
+        CHECK(key_20 == +20);
+        CHECK(key_30 == +30);
+        CHECK(key_40 == -40);
+        CHECK(key_50 == -50);
+        CHECK(key_60 == -60);
+    }
+
+    PRINT("Test operator[](K&&)");
+    {
+        sfl::static_order_statistic_map<xobj, xint, 32, xobj::less> map;
+
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(10), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(20), std::forward_as_tuple(1));
+        map.emplace(std::piecewise_construct, std::forward_as_tuple(30), std::forward_as_tuple(1));
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first.value() == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first.value() == 30); CHECK(NTH(map, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        map[10] = 2;
+        map[20] = 2;
+        map[30] = 2;
+        map[40] = 2;
+        map[50] = 2;
+        map[60] = 2;
+
+        CHECK(map.size() == 6);
+        CHECK(NTH(map, 0)->first.value() == 10); CHECK(NTH(map, 0)->second == 2);
+        CHECK(NTH(map, 1)->first.value() == 20); CHECK(NTH(map, 1)->second == 2);
+        CHECK(NTH(map, 2)->first.value() == 30); CHECK(NTH(map, 2)->second == 2);
+        CHECK(NTH(map, 3)->first.value() == 40); CHECK(NTH(map, 3)->second == 2);
+        CHECK(NTH(map, 4)->first.value() == 50); CHECK(NTH(map, 4)->second == 2);
+        CHECK(NTH(map, 5)->first.value() == 60); CHECK(NTH(map, 5)->second == 2);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+
+    PRINT("Test NON-MEMBER comparison operators");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        map2.emplace(10, 1);
+        map2.emplace(20, 1);
+        map2.emplace(30, 1);
+        map2.emplace(40, 1);
+        map2.emplace(50, 1);
+
+        CHECK((map1 == map1) == true);
+        CHECK((map1 == map2) == false);
+        CHECK((map2 == map1) == false);
+        CHECK((map2 == map2) == true);
+
+        CHECK((map1 != map1) == false);
+        CHECK((map1 != map2) == true);
+        CHECK((map2 != map1) == true);
+        CHECK((map2 != map2) == false);
+
+        CHECK((map1 < map1) == false);
+        CHECK((map1 < map2) == true);
+        CHECK((map2 < map1) == false);
+        CHECK((map2 < map2) == false);
+
+        CHECK((map1 > map1) == false);
+        CHECK((map1 > map2) == false);
+        CHECK((map2 > map1) == true);
+        CHECK((map2 > map2) == false);
+
+        CHECK((map1 <= map1) == true);
+        CHECK((map1 <= map2) == true);
+        CHECK((map2 <= map1) == false);
+        CHECK((map2 <= map2) == true);
+
+        CHECK((map1 >= map1) == true);
+        CHECK((map1 >= map2) == false);
+        CHECK((map2 >= map1) == true);
+        CHECK((map2 >= map2) == true);
+    }
+
+    PRINT("Test NON-MEMBER swap(container&)");
+    {
+        sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>> map1, map2;
+
+        map1.emplace(10, 1);
+        map1.emplace(20, 1);
+        map1.emplace(30, 1);
+
+        map2.emplace(40, 2);
+        map2.emplace(50, 2);
+        map2.emplace(60, 2);
+        map2.emplace(70, 2);
+        map2.emplace(80, 2);
+
+        CHECK(map1.size() == 3);
+        CHECK(NTH(map1, 0)->first == 10); CHECK(NTH(map1, 0)->second == 1);
+        CHECK(NTH(map1, 1)->first == 20); CHECK(NTH(map1, 1)->second == 1);
+        CHECK(NTH(map1, 2)->first == 30); CHECK(NTH(map1, 2)->second == 1);
+
+        CHECK(map2.size() == 5);
+        CHECK(NTH(map2, 0)->first == 40); CHECK(NTH(map2, 0)->second == 2);
+        CHECK(NTH(map2, 1)->first == 50); CHECK(NTH(map2, 1)->second == 2);
+        CHECK(NTH(map2, 2)->first == 60); CHECK(NTH(map2, 2)->second == 2);
+        CHECK(NTH(map2, 3)->first == 70); CHECK(NTH(map2, 3)->second == 2);
+        CHECK(NTH(map2, 4)->first == 80); CHECK(NTH(map2, 4)->second == 2);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        swap(map1, map2);
+
+        CHECK(map1.size() == 5);
+        CHECK(NTH(map1, 0)->first == 40); CHECK(NTH(map1, 0)->second == 2);
+        CHECK(NTH(map1, 1)->first == 50); CHECK(NTH(map1, 1)->second == 2);
+        CHECK(NTH(map1, 2)->first == 60); CHECK(NTH(map1, 2)->second == 2);
+        CHECK(NTH(map1, 3)->first == 70); CHECK(NTH(map1, 3)->second == 2);
+        CHECK(NTH(map1, 4)->first == 80); CHECK(NTH(map1, 4)->second == 2);
+
+        CHECK(map2.size() == 3);
+        CHECK(NTH(map2, 0)->first == 10); CHECK(NTH(map2, 0)->second == 1);
+        CHECK(NTH(map2, 1)->first == 20); CHECK(NTH(map2, 1)->second == 1);
+        CHECK(NTH(map2, 2)->first == 30); CHECK(NTH(map2, 2)->second == 1);
+    }
+
+    PRINT("Test NON-MEMBER erase_if(container&, Predicate)");
+    {
+        using container_type =
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        using const_reference = typename container_type::const_reference;
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        container_type map;
+
+        map.emplace(10, 1);
+        map.emplace(20, 1);
+        map.emplace(30, 1);
+
+        CHECK(map.size() == 3);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 20); CHECK(NTH(map, 1)->second == 1);
+        CHECK(NTH(map, 2)->first == 30); CHECK(NTH(map, 2)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(erase_if(map, [](const_reference& value){ return value.first == 20; }) == 1);
+        CHECK(map.size() == 2);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
+
+        ///////////////////////////////////////////////////////////////////////////
+
+        CHECK(erase_if(map, [](const_reference& value){ return value.first == 20; }) == 0);
+        CHECK(map.size() == 2);
+        CHECK(NTH(map, 0)->first == 10); CHECK(NTH(map, 0)->second == 1);
+        CHECK(NTH(map, 1)->first == 30); CHECK(NTH(map, 1)->second == 1);
+    }
+
+    PRINT("Test NON-MEMBER set_union_into, set_intersection_into, set_difference_into");
+    {
+        using container_type =
+            sfl::static_order_statistic_map<xint, xint, 32, std::less<xint>>;
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(50, 2);
+
+            CHECK(set_union_into(x, y) == 1);
+            CHECK(x.size() == 5);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 20); CHECK(NTH(x, 1)->second == 1);
+            CHECK(NTH(x, 2)->first == 30); CHECK(NTH(x, 2)->second == 1);
+            CHECK(NTH(x, 3)->first == 40); CHECK(NTH(x, 3)->second == 1);
+            CHECK(NTH(x, 4)->first == 50); CHECK(NTH(x, 4)->second == 2);
+
+            container_type z;
+
+            z.emplace(5, 3);
+
+            CHECK(set_union_into(x, z) == 1);
+            CHECK(x.size() == 6);
+            CHECK(NTH(x, 0)->first ==  5); CHECK(NTH(x, 0)->second == 3);
+            CHECK(NTH(x, 5)->first == 50); CHECK(NTH(x, 5)->second == 2);
+
+            CHECK(set_union_into(x, x) == 0);
+            CHECK(x.size() == 6);
+
+            container_type e;
+
+            CHECK(set_union_into(e, y) == 3);
+            CHECK(e.size() == 3);
+            CHECK(NTH(e, 0)->first == 20); CHECK(NTH(e, 0)->second == 2);
+            CHECK(NTH(e, 1)->first == 40); CHECK(NTH(e, 1)->second == 2);
+            CHECK(NTH(e, 2)->first == 50); CHECK(NTH(e, 2)->second == 2);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+            x.emplace(50, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(60, 2);
+
+            CHECK(set_intersection_into(x, x) == 0);
+            CHECK(x.size() == 5);
+
+            CHECK(set_intersection_into(x, y) == 3);
+            CHECK(x.size() == 2);
+            CHECK(NTH(x, 0)->first == 20); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 40); CHECK(NTH(x, 1)->second == 1);
+
+            container_type e;
+
+            CHECK(set_intersection_into(x, e) == 2);
+            CHECK(x.size() == 0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+            x.emplace(50, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(60, 2);
+
+            CHECK(set_difference_into(x, y) == 2);
+            CHECK(x.size() == 3);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 30); CHECK(NTH(x, 1)->second == 1);
+            CHECK(NTH(x, 2)->first == 50); CHECK(NTH(x, 2)->second == 1);
+
+            container_type z;
+
+            z.emplace(30, 3);
+
+            CHECK(set_difference_into(x, z) == 1);
+            CHECK(x.size() == 2);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 50); CHECK(NTH(x, 1)->second == 1);
+
+            CHECK(set_difference_into(x, x) == 2);
+            CHECK(x.size() == 0);
+        }
+    }
+}
+
+int main()
+{
+    test_static_order_statistic_map();
+}
@@ -0,0 +1,218 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/static_perfect_map.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if SFL_CPP_VERSION >= SFL_CPP_17
+#include <string_view>
+#endif
+
+#if SFL_CPP_VERSION >= SFL_CPP_14
+
+namespace
+{
+
+enum class opcode { nop, load, store, jump, halt };
+
+// User-defined hash function for std::string keys. It is not usable in
+// constant expressions, so container must be constructed at run time.
+struct string_hash
+{
+    std::uint64_t operator()(const std::string& key) const noexcept
+    {
+        std::uint64_t h = 0;
+
+        for (const char c : key)
+        {
+            h = h * 131 + std::uint64_t(static_cast<unsigned char>(c));
+        }
+
+        return sfl::dtl::mix64(h);
+    }
+};
+
+} // namespace
+
+void test_static_perfect_map()
+{
+    PRINT("Test constexpr construction and lookup (integral keys)");
+    {
+        constexpr auto map = sfl::make_static_perfect_map<int, int>
+        ({
+            {10, 1}, {20, 2}, {30, 3}, {-40, 4}, {50, 5}, {1000000, 6}
+        });
+
+        static_assert(map.size() == 6, "");
+        static_assert(map.max_size() == 6, "");
+        static_assert(!map.empty(), "");
+
+        static_assert(map.at(10) == 1, "");
+        static_assert(map.at(-40) == 4, "");
+        static_assert(map.at(1000000) == 6, "");
+        static_assert(map.contains(20), "");
+        static_assert(!map.contains(21), "");
+        static_assert(map.count(30) == 1, "");
+        static_assert(map.count(31) == 0, "");
+        static_assert(map.find(50)->second == 5, "");
+        static_assert(map.find(0) == map.end(), "");
+
+        CHECK(map.at(10) == 1);
+        CHECK(map.at(20) == 2);
+        CHECK(map.at(30) == 3);
+        CHECK(map.at(-40) == 4);
+        CHECK(map.at(50) == 5);
+        CHECK(map.at(1000000) == 6);
+
+        for (int key = -100; key <= 100; ++key)
+        {
+            const bool expected = key == 10 || key == 20 || key == 30 || key == -40 || key == 50;
+            CHECK(map.contains(key) == expected);
+        }
+
+        // Elements are iterated in the given order.
+        const std::vector<std::pair<int, int>> expected =
+            {{10, 1}, {20, 2}, {30, 3}, {-40, 4}, {50, 5}, {1000000, 6}};
+
+        CHECK(std::size_t(std::distance(map.begin(), map.end())) == expected.size());
+        CHECK(std::equal(map.begin(), map.end(), expected.begin()));
+        CHECK(map.cbegin() == map.begin());
+        CHECK(map.cend() == map.end());
+    }
+
+    PRINT("Test constexpr construction and lookup (enum keys)");
+    {
+        constexpr sfl::static_perfect_map<opcode, int, 4> map
+        ({
+            {opcode::nop, 0}, {opcode::load, 2}, {opcode::store, 2}, {opcode::jump, 1}
+        });
+
+        static_assert(map.at(opcode::load) == 2, "");
+        static_assert(map.at(opcode::jump) == 1, "");
+        static_assert(!map.contains(opcode::halt), "");
+    }
+
+    #if SFL_CPP_VERSION >= SFL_CPP_17
+    PRINT("Test constexpr construction and lookup (std::string_view keys)");
+    {
+        constexpr auto map = sfl::make_static_perfect_map<std::string_view, int>
+        ({
+            {"GET", 1}, {"HEAD", 2}, {"POST", 3}, {"PUT", 4}, {"DELETE", 5},
+            {"CONNECT", 6}, {"OPTIONS", 7}, {"TRACE", 8}, {"PATCH", 9}
+        });
+
+        static_assert(map.at("GET") == 1, "");
+        static_assert(map.at("PATCH") == 9, "");
+        static_assert(!map.contains("get"), "");
+        static_assert(!map.contains(""), "");
+
+        CHECK(map.at(std::string("OPTIONS")) == 7);
+        CHECK(map.contains(std::string("TRACE")));
+        CHECK(!map.contains(std::string("TRACES")));
+    }
+    #endif
+
+    PRINT("Test many keys");
+    {
+        constexpr std::pair<std::uint32_t, std::uint32_t> values[] =
+        {
+            #define SFL_TEST_ROW(i) {(i) * 2654435761U, (i)}
+            SFL_TEST_ROW(0),  SFL_TEST_ROW(1),  SFL_TEST_ROW(2),  SFL_TEST_ROW(3),
+            SFL_TEST_ROW(4),  SFL_TEST_ROW(5),  SFL_TEST_ROW(6),  SFL_TEST_ROW(7),
+            SFL_TEST_ROW(8),  SFL_TEST_ROW(9),  SFL_TEST_ROW(10), SFL_TEST_ROW(11),
+            SFL_TEST_ROW(12), SFL_TEST_ROW(13), SFL_TEST_ROW(14), SFL_TEST_ROW(15),
+            SFL_TEST_ROW(16), SFL_TEST_ROW(17), SFL_TEST_ROW(18), SFL_TEST_ROW(19),
+            SFL_TEST_ROW(20), SFL_TEST_ROW(21), SFL_TEST_ROW(22), SFL_TEST_ROW(23),
+            SFL_TEST_ROW(24), SFL_TEST_ROW(25), SFL_TEST_ROW(26), SFL_TEST_ROW(27),
+            SFL_TEST_ROW(28), SFL_TEST_ROW(29), SFL_TEST_ROW(30), SFL_TEST_ROW(31)
+            #undef SFL_TEST_ROW
+        };
+
+        constexpr auto map = sfl::make_static_perfect_map(values);
+
+        static_assert(map.size() == 32, "");
+
+        for (std::uint32_t i = 0; i < 32; ++i)
+        {
+            CHECK(map.at(i * 2654435761U) == i);
+            CHECK(!map.contains(i * 2654435761U + 1));
+        }
+    }
+
+    PRINT("Test run-time construction with user-defined hash function");
+    {
+        const std::pair<std::string, int> values[] =
+        {
+            {"alpha", 1}, {"beta", 2}, {"gamma", 3}, {"delta", 4}, {"epsilon", 5}
+        };
+
+        const sfl::static_perfect_map<std::string, int, 5, string_hash> map(values);
+
+        CHECK(map.at("alpha") == 1);
+        CHECK(map.at("beta") == 2);
+        CHECK(map.at("gamma") == 3);
+        CHECK(map.at("delta") == 4);
+        CHECK(map.at("epsilon") == 5);
+        CHECK(!map.contains("zeta"));
+        CHECK(map.find("zeta") == map.end());
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            (void)map.at("zeta");
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        #endif
+    }
+
+    #if !defined(SFL_NO_EXCEPTIONS)
+    PRINT("Test duplicate keys");
+    {
+        const std::pair<int, int> values[] = {{1, 1}, {2, 2}, {1, 3}};
+
+        bool caught_exception = false;
+
+        try
+        {
+            const sfl::static_perfect_map<int, int, 3> map(values);
+            (void)map;
+        }
+        catch (const std::invalid_argument&)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+    }
+    #endif
+}
+
+#else // before C++14
+
+void test_static_perfect_map()
+{
+    PRINT("sfl::static_perfect_map requires C++14");
+}
+
+#endif // before C++14
+
+int main()
+{
+    test_static_perfect_map();
+}
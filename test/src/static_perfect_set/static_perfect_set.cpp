@@ -0,0 +1,122 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/static_perfect_set.hpp"
+
+#include "check.hpp"
+#include "print.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#if SFL_CPP_VERSION >= SFL_CPP_17
+#include <string_view>
+#endif
+
+#if SFL_CPP_VERSION >= SFL_CPP_14
+
+void test_static_perfect_set()
+{
+    PRINT("Test constexpr construction and lookup (integral keys)");
+    {
+        constexpr auto set = sfl::make_static_perfect_set<long>({7, 3, -11, 1L << 40, 0});
+
+        static_assert(set.size() == 5, "");
+        static_assert(set.max_size() == 5, "");
+        static_assert(!set.empty(), "");
+
+        static_assert(set.contains(7), "");
+        static_assert(set.contains(-11), "");
+        static_assert(set.contains(1L << 40), "");
+        static_assert(set.contains(0), "");
+        static_assert(!set.contains(1), "");
+        static_assert(set.count(3) == 1, "");
+        static_assert(set.count(4) == 0, "");
+        static_assert(*set.find(3) == 3, "");
+        static_assert(set.find(4) == set.end(), "");
+
+        for (long key = -100; key <= 100; ++key)
+        {
+            const bool expected = key == 7 || key == 3 || key == -11 || key == 0;
+            CHECK(set.contains(key) == expected);
+        }
+
+        // Elements are iterated in the given order.
+        const std::vector<long> expected = {7, 3, -11, 1L << 40, 0};
+
+        CHECK(std::size_t(std::distance(set.begin(), set.end())) == expected.size());
+        CHECK(std::equal(set.begin(), set.end(), expected.begin()));
+        CHECK(set.cbegin() == set.begin());
+        CHECK(set.cend() == set.end());
+    }
+
+    PRINT("Test single key");
+    {
+        constexpr sfl::static_perfect_set<char, 1> set({'x'});
+
+        static_assert(set.contains('x'), "");
+        static_assert(!set.contains('y'), "");
+    }
+
+    #if SFL_CPP_VERSION >= SFL_CPP_17
+    PRINT("Test constexpr construction and lookup (std::string_view keys)");
+    {
+        constexpr auto set = sfl::make_static_perfect_set<std::string_view>
+        ({
+            "alignas", "alignof", "and", "asm", "auto", "bool", "break", "case",
+            "catch", "char", "class", "const", "constexpr", "continue", "default",
+            "delete", "do", "double", "else", "enum", "explicit", "export", "extern",
+            "false", "float", "for", "friend", "goto", "if", "inline", "int", "long"
+        });
+
+        static_assert(set.size() == 32, "");
+        static_assert(set.contains("constexpr"), "");
+        static_assert(set.contains("long"), "");
+        static_assert(!set.contains("short"), "");
+        static_assert(!set.contains("Int"), "");
+
+        for (const auto& key : set)
+        {
+            CHECK(set.contains(key));
+            CHECK(*set.find(key) == key);
+        }
+    }
+    #endif
+
+    #if !defined(SFL_NO_EXCEPTIONS)
+    PRINT("Test duplicate keys");
+    {
+        const int values[] = {5, 6, 7, 6};
+
+        bool caught_exception = false;
+
+        try
+        {
+            const sfl::static_perfect_set<int, 4> set(values);
+            (void)set;
+        }
+        catch (const std::invalid_argument&)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+    }
+    #endif
+}
+
+#else // before C++14
+
+void test_static_perfect_set()
+{
+    PRINT("sfl::static_perfect_set requires C++14");
+}
+
+#endif // before C++14
+
+int main()
+{
+    test_static_perfect_set();
+}
@@ -1000,6 +1000,276 @@ void test_static_set()
         }
     }
 
+    PRINT("Test container(sfl::sorted_unique_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_set<xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                10,
+                20,
+                30
+            }
+        );
+
+        {
+            container_type set(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(set.size() == 3);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, InputIt, InputIt, const Compare&)");
+    {
+        using container_type = sfl::static_set<xint, 32, std::less<xint>>;
+
+        std::vector<typename container_type::value_type> data
+        (
+            {
+                10,
+                20,
+                30
+            }
+        );
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type set(sfl::sorted_unique_t(), data.begin(), data.end(), comp);
+
+            CHECK(set.size() == 3);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_set<xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            10,
+            20,
+            30
+        };
+
+        {
+            container_type set(sfl::sorted_unique_t(), ilist);
+
+            CHECK(set.size() == 3);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+    }
+
+    PRINT("Test container(sfl::sorted_unique_t, std::initializer_list, const Compare&)");
+    {
+        using container_type = sfl::static_set<xint, 32, std::less<xint>>;
+
+        std::initializer_list<typename container_type::value_type> ilist
+        {
+            10,
+            20,
+            30
+        };
+
+        {
+            typename container_type::key_compare comp;
+
+            container_type set(sfl::sorted_unique_t(), ilist, comp);
+
+            CHECK(set.size() == 3);
+            CHECK(*NTH(set, 0) == 10);
+            CHECK(*NTH(set, 1) == 20);
+            CHECK(*NTH(set, 2) == 30);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_unique_t, InputIt, InputIt)");
+    {
+        using container_type = sfl::static_set<xint, 32, std::less<xint>>;
+
+        container_type set
+        (
+            sfl::sorted_unique_t(),
+            {
+                10,
+                20,
+                30
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    5,
+                    20,
+                    25,
+                    40
+                }
+            );
+
+            set.insert(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(set.size() == 6);
+            CHECK(*NTH(set, 0) == 5);
+            CHECK(*NTH(set, 1) == 10);
+            CHECK(*NTH(set, 2) == 20);
+            CHECK(*NTH(set, 3) == 25);
+            CHECK(*NTH(set, 4) == 30);
+            CHECK(*NTH(set, 5) == 40);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    1,
+                    30,
+                    50
+                }
+            );
+
+            set.insert(sfl::sorted_unique_t(), data.begin(), data.end());
+
+            CHECK(set.size() == 8);
+            CHECK(*NTH(set, 0) == 1);
+            CHECK(*NTH(set, 1) == 5);
+            CHECK(*NTH(set, 2) == 10);
+            CHECK(*NTH(set, 3) == 20);
+            CHECK(*NTH(set, 4) == 25);
+            CHECK(*NTH(set, 5) == 30);
+            CHECK(*NTH(set, 6) == 40);
+            CHECK(*NTH(set, 7) == 50);
+        }
+    }
+
+    PRINT("Test insert(sfl::sorted_unique_t, std::initializer_list)");
+    {
+        using container_type = sfl::static_set<xint, 32, std::less<xint>>;
+
+        container_type set
+        (
+            sfl::sorted_unique_t(),
+            {
+                10,
+                20,
+                30
+            }
+        );
+
+        {
+            set.insert
+            (
+                sfl::sorted_unique_t(),
+                {
+                    5,
+                    20,
+                    25,
+                    40
+                }
+            );
+
+            CHECK(set.size() == 6);
+            CHECK(*NTH(set, 0) == 5);
+            CHECK(*NTH(set, 1) == 10);
+            CHECK(*NTH(set, 2) == 20);
+            CHECK(*NTH(set, 3) == 25);
+            CHECK(*NTH(set, 4) == 30);
+            CHECK(*NTH(set, 5) == 40);
+        }
+
+        {
+            set.insert
+            (
+                sfl::sorted_unique_t(),
+                {
+                    1,
+                    30,
+                    50
+                }
+            );
+
+            CHECK(set.size() == 8);
+            CHECK(*NTH(set, 0) == 1);
+            CHECK(*NTH(set, 1) == 5);
+            CHECK(*NTH(set, 2) == 10);
+            CHECK(*NTH(set, 3) == 20);
+            CHECK(*NTH(set, 4) == 25);
+            CHECK(*NTH(set, 5) == 30);
+            CHECK(*NTH(set, 6) == 40);
+            CHECK(*NTH(set, 7) == 50);
+        }
+    }
+
+    PRINT("Test insert_range(sfl::sorted_unique_t, Range&&)");
+    {
+        using container_type = sfl::static_set<xint, 32, std::less<xint>>;
+
+        container_type set
+        (
+            sfl::sorted_unique_t(),
+            {
+                10,
+                20,
+                30
+            }
+        );
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    5,
+                    20,
+                    25,
+                    40
+                }
+            );
+
+            set.insert_range(sfl::sorted_unique_t(), data);
+
+            CHECK(set.size() == 6);
+            CHECK(*NTH(set, 0) == 5);
+            CHECK(*NTH(set, 1) == 10);
+            CHECK(*NTH(set, 2) == 20);
+            CHECK(*NTH(set, 3) == 25);
+            CHECK(*NTH(set, 4) == 30);
+            CHECK(*NTH(set, 5) == 40);
+        }
+
+        {
+            std::vector<typename container_type::value_type> data
+            (
+                {
+                    1,
+                    30,
+                    50
+                }
+            );
+
+            set.insert_range(sfl::sorted_unique_t(), data);
+
+            CHECK(set.size() == 8);
+            CHECK(*NTH(set, 0) == 1);
+            CHECK(*NTH(set, 1) == 5);
+            CHECK(*NTH(set, 2) == 10);
+            CHECK(*NTH(set, 3) == 20);
+            CHECK(*NTH(set, 4) == 25);
+            CHECK(*NTH(set, 5) == 30);
+            CHECK(*NTH(set, 6) == 40);
+            CHECK(*NTH(set, 7) == 50);
+        }
+    }
+
     PRINT("Test erase(const_iterator)");
     {
         sfl::static_set<xint_xint, 32, std::less<xint_xint>> set;
@@ -1296,6 +1566,118 @@ void test_static_set()
         CHECK(NTH(set, 0)->first == 10); CHECK(NTH(set, 0)->second == 1);
         CHECK(NTH(set, 1)->first == 30); CHECK(NTH(set, 1)->second == 1);
     }
+
+    PRINT("Test NON-MEMBER set_union_into, set_intersection_into, set_difference_into");
+    {
+        using container_type =
+            sfl::static_set<xint_xint, 32, std::less<xint_xint>>;
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(50, 2);
+
+            CHECK(set_union_into(x, y) == 1);
+            CHECK(x.size() == 5);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 20); CHECK(NTH(x, 1)->second == 1);
+            CHECK(NTH(x, 2)->first == 30); CHECK(NTH(x, 2)->second == 1);
+            CHECK(NTH(x, 3)->first == 40); CHECK(NTH(x, 3)->second == 1);
+            CHECK(NTH(x, 4)->first == 50); CHECK(NTH(x, 4)->second == 2);
+
+            container_type z;
+
+            z.emplace(5, 3);
+
+            CHECK(set_union_into(x, z) == 1);
+            CHECK(x.size() == 6);
+            CHECK(NTH(x, 0)->first ==  5); CHECK(NTH(x, 0)->second == 3);
+            CHECK(NTH(x, 5)->first == 50); CHECK(NTH(x, 5)->second == 2);
+
+            CHECK(set_union_into(x, x) == 0);
+            CHECK(x.size() == 6);
+
+            container_type e;
+
+            CHECK(set_union_into(e, y) == 3);
+            CHECK(e.size() == 3);
+            CHECK(NTH(e, 0)->first == 20); CHECK(NTH(e, 0)->second == 2);
+            CHECK(NTH(e, 1)->first == 40); CHECK(NTH(e, 1)->second == 2);
+            CHECK(NTH(e, 2)->first == 50); CHECK(NTH(e, 2)->second == 2);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+            x.emplace(50, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(60, 2);
+
+            CHECK(set_intersection_into(x, x) == 0);
+            CHECK(x.size() == 5);
+
+            CHECK(set_intersection_into(x, y) == 3);
+            CHECK(x.size() == 2);
+            CHECK(NTH(x, 0)->first == 20); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 40); CHECK(NTH(x, 1)->second == 1);
+
+            container_type e;
+
+            CHECK(set_intersection_into(x, e) == 2);
+            CHECK(x.size() == 0);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+
+        {
+            container_type x, y;
+
+            x.emplace(10, 1);
+            x.emplace(20, 1);
+            x.emplace(30, 1);
+            x.emplace(40, 1);
+            x.emplace(50, 1);
+
+            y.emplace(20, 2);
+            y.emplace(40, 2);
+            y.emplace(60, 2);
+
+            CHECK(set_difference_into(x, y) == 2);
+            CHECK(x.size() == 3);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 30); CHECK(NTH(x, 1)->second == 1);
+            CHECK(NTH(x, 2)->first == 50); CHECK(NTH(x, 2)->second == 1);
+
+            container_type z;
+
+            z.emplace(30, 3);
+
+            CHECK(set_difference_into(x, z) == 1);
+            CHECK(x.size() == 2);
+            CHECK(NTH(x, 0)->first == 10); CHECK(NTH(x, 0)->second == 1);
+            CHECK(NTH(x, 1)->first == 50); CHECK(NTH(x, 1)->second == 1);
+
+            CHECK(set_difference_into(x, x) == 2);
+            CHECK(x.size() == 0);
+        }
+    }
 }
 
 int main()
@@ -3,6 +3,7 @@
 #include "sfl/static_unordered_linear_multiset.hpp"
 
 #include "check.hpp"
+#include "counting_equal.hpp"
 #include "istream_view.hpp"
 #include "nth.hpp"
 #include "pair_io.hpp"
@@ -12,7 +13,9 @@
 #include "xint_xint.hpp"
 #include "xobj.hpp"
 
+#include <functional>
 #include <sstream>
+#include <string>
 #include <vector>
 
 void test_static_unordered_linear_multiset()
@@ -2079,7 +2082,63 @@ void test_static_unordered_linear_multiset()
     }
 }
 
+void test_static_unordered_linear_multiset_hash()
+{
+    PRINT("Test Hash");
+    {
+        using equal = sfl::test::counting_equal<std::string>;
+
+        using set_type = sfl::static_unordered_linear_multiset<std::string, 96, equal, std::hash<std::string>>;
+
+        set_type set;
+
+        for (int i = 0; i < 96; ++i)
+        {
+            set.emplace("key" + std::to_string(i % 32));
+        }
+
+        CHECK(set.size() == 96);
+
+        // Keys are compared only if fingerprints are equal.
+        {
+            equal::num_calls() = 0;
+
+            for (int i = 32; i < 64; ++i)
+            {
+                CHECK(set.count("key" + std::to_string(i)) == 0);
+            }
+
+            CHECK(equal::num_calls() < 96);
+        }
+
+        for (int i = 0; i < 32; ++i)
+        {
+            CHECK(set.count("key" + std::to_string(i)) == 3);
+        }
+
+        for (int i = 0; i < 32; i += 2)
+        {
+            CHECK(set.erase("key" + std::to_string(i)) == 3);
+        }
+
+        CHECK(set.size() == 48);
+
+        for (int i = 0; i < 32; ++i)
+        {
+            CHECK(set.count("key" + std::to_string(i)) == (i % 2 == 0 ? 0 : 3));
+            CHECK(set.contains("key" + std::to_string(i)) == (i % 2 == 1));
+        }
+
+        set_type set2(set);
+        CHECK(set2 == set);
+        CHECK(erase_if(set2, [](const std::string& s) { return s == "key1"; }) == 3);
+        CHECK(set2.count("key1") == 0);
+        CHECK(set2.count("key3") == 3);
+    }
+}
+
 int main()
 {
     test_static_unordered_linear_multiset();
+    test_static_unordered_linear_multiset_hash();
 }
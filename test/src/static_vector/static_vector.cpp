@@ -9,7 +9,9 @@
 
 #include "xint.hpp"
 
+#include <cstring>
 #include <sstream>
+#include <string>
 #include <vector>
 
 void test_static_vector()
@@ -2199,6 +2201,74 @@ void test_static_vector()
         }
     }
 
+    PRINT("Test append_uninitialized(size_type)");
+    {
+        sfl::static_vector<char, 100> vec;
+
+        vec.push_back('a');
+
+        char* p = vec.append_uninitialized(3);
+        CHECK(vec.size() == 4);
+        CHECK(p == vec.data() + 1);
+
+        std::memcpy(p, "bcd", 3);
+
+        p = vec.append_uninitialized(30);
+        CHECK(vec.size() == 34);
+        CHECK(p == vec.data() + 4);
+
+        std::memset(p, 'e', 30);
+
+        CHECK(std::string(vec.begin(), vec.end()) == "abcd" + std::string(30, 'e'));
+    }
+
+    PRINT("Test resize_and_overwrite(size_type, Operation)");
+    {
+        sfl::static_vector<char, 100> vec(2, 'x');
+
+        vec.resize_and_overwrite(10, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 10);
+            CHECK(p[0] == 'x');
+            CHECK(p[1] == 'x');
+            std::memcpy(p + 2, "abc", 3);
+            return 5;
+        });
+
+        CHECK(vec.size() == 5);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxabc");
+
+        vec.resize_and_overwrite(3, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 3);
+            p[2] = 'z';
+            return n;
+        });
+
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            vec.resize_and_overwrite(8, [](char*, std::size_t) -> std::size_t
+            {
+                throw 1;
+            });
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+        #endif
+    }
+
     PRINT("Test resize(size_type, const T&)");
     {
         #define CONDITION n < vec.size()
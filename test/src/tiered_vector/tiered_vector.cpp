@@ -0,0 +1,339 @@
+#undef NDEBUG // This is very important. Must be in the first line.
+
+#include "sfl/tiered_vector.hpp"
+
+#include "check.hpp"
+#include "istream_view.hpp"
+#include "pair_io.hpp"
+#include "print.hpp"
+
+#include "xint.hpp"
+
+#include "at_least_alloc.hpp"
+#include "statefull_alloc.hpp"
+#include "stateless_alloc.hpp"
+#include "stateless_alloc_no_prop.hpp"
+#include "stateless_fancy_alloc.hpp"
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <vector>
+
+void test_tiered_vector_N_1_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_1_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_1_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_1_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_1_A_5()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 1
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_2_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 2
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_2_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 2
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_2_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 2
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_2_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 2
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_2_A_5()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 2
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_3_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_3_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_3_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_3_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_3_A_5()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 3
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_4_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 4
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_4_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 4
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_4_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 4
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_4_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 4
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_4_A_5()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 4
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_100_A_1()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 100
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR std::allocator
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_100_A_2()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 100
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::statefull_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_100_A_3()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 100
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_100_A_4()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 100
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_alloc_no_prop
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_N_100_A_5()
+{
+    #undef   TPARAM_N
+    #define  TPARAM_N 100
+
+    #undef   TPARAM_ALLOCATOR
+    #define  TPARAM_ALLOCATOR sfl::test::stateless_fancy_alloc
+    #include "tiered_vector.inc"
+}
+
+void test_tiered_vector_allocate_at_least()
+{
+    using sfl::test::xint;
+
+    PRINT("Test allocate_at_least");
+    {
+        // Segments are always allocated with exact size,
+        // only the table can use extra storage.
+        sfl::tiered_vector<xint, 8, sfl::test::at_least_alloc<xint>> vec;
+
+        for (int i = 0; i < 100; ++i)
+        {
+            vec.emplace_back(i);
+        }
+
+        CHECK(vec.size() == 100);
+        CHECK(vec.capacity() == 104);
+
+        for (int i = 0; i < 100; ++i)
+        {
+            CHECK(vec[i] == i);
+        }
+
+        vec.resize(20);
+        vec.shrink_to_fit();
+        CHECK(vec.size() == 20);
+        CHECK(vec.capacity() == 24);
+
+        vec.reserve(200);
+        CHECK(vec.capacity() == 200);
+    }
+}
+
+int main()
+{
+    test_tiered_vector_N_1_A_1();
+    test_tiered_vector_N_1_A_2();
+    test_tiered_vector_N_1_A_3();
+    test_tiered_vector_N_1_A_4();
+    test_tiered_vector_N_1_A_5();
+
+    test_tiered_vector_N_2_A_1();
+    test_tiered_vector_N_2_A_2();
+    test_tiered_vector_N_2_A_3();
+    test_tiered_vector_N_2_A_4();
+    test_tiered_vector_N_2_A_5();
+
+    test_tiered_vector_N_3_A_1();
+    test_tiered_vector_N_3_A_2();
+    test_tiered_vector_N_3_A_3();
+    test_tiered_vector_N_3_A_4();
+    test_tiered_vector_N_3_A_5();
+
+    test_tiered_vector_N_4_A_1();
+    test_tiered_vector_N_4_A_2();
+    test_tiered_vector_N_4_A_3();
+    test_tiered_vector_N_4_A_4();
+    test_tiered_vector_N_4_A_5();
+
+    test_tiered_vector_N_100_A_1();
+    test_tiered_vector_N_100_A_2();
+    test_tiered_vector_N_100_A_3();
+    test_tiered_vector_N_100_A_4();
+    test_tiered_vector_N_100_A_5();
+
+    test_tiered_vector_allocate_at_least();
+}
@@ -3,8 +3,14 @@
 #include "sfl/detail/type_traits/conjunction.hpp"
 #include "sfl/detail/type_traits/disjunction.hpp"
 #include "sfl/detail/type_traits/is_nothrow_swappable.hpp"
+#include "sfl/detail/type_traits/is_trivially_relocatable.hpp"
 #include "sfl/detail/type_traits/negation.hpp"
 
+#include "statefull_alloc.hpp"
+
+#include <memory>
+#include <string>
+
 ///////////////////////////////////////////////////////////////////////////////
 
 static_assert(sfl::dtl::conjunction<std::true_type>::value == true, "");
@@ -107,5 +113,57 @@ static_assert(sfl::dtl::is_nothrow_swappable<S5>::value == true, "");
 
 ///////////////////////////////////////////////////////////////////////////////
 
+namespace test_is_trivially_relocatable
+{
+
+struct S0
+{
+    int i;
+    double d;
+};
+
+struct S1
+{
+    S1(const S1&);
+};
+
+struct S2
+{
+    S2(const S2&);
+};
+
+} // namespace test_is_trivially_relocatable
+
+namespace sfl
+{
+
+template <>
+struct is_trivially_relocatable<test_is_trivially_relocatable::S2> : std::true_type {};
+
+} // namespace sfl
+
+namespace test_is_trivially_relocatable
+{
+
+static_assert(sfl::is_trivially_relocatable<int>::value == true, "");
+static_assert(sfl::is_trivially_relocatable<int*>::value == true, "");
+static_assert(sfl::is_trivially_relocatable<S0>::value == true, "");
+static_assert(sfl::is_trivially_relocatable<S1>::value == false, "");
+static_assert(sfl::is_trivially_relocatable<S2>::value == true, "");
+static_assert(sfl::is_trivially_relocatable<std::unique_ptr<int>>::value == true, "");
+static_assert(sfl::is_trivially_relocatable<std::unique_ptr<int[]>>::value == true, "");
+static_assert(sfl::is_trivially_relocatable<std::string>::value == false, "");
+
+static_assert(sfl::dtl::is_trivially_relocatable_a<std::allocator<int>>::value == true, "");
+static_assert(sfl::dtl::is_trivially_relocatable_a<std::allocator<S0>>::value == true, "");
+static_assert(sfl::dtl::is_trivially_relocatable_a<std::allocator<S1>>::value == false, "");
+static_assert(sfl::dtl::is_trivially_relocatable_a<std::allocator<S2>>::value == true, "");
+static_assert(sfl::dtl::is_trivially_relocatable_a<std::allocator<std::unique_ptr<int>>>::value == true, "");
+static_assert(sfl::dtl::is_trivially_relocatable_a<sfl::test::statefull_alloc<int>>::value == false, "");
+
+} // namespace test_is_trivially_relocatable
+
+///////////////////////////////////////////////////////////////////////////////
+
 int main()
 {}
@@ -5,6 +5,8 @@
 
 #include "sfl/detail/functional/first.hpp"
 #include "sfl/detail/functional/identity.hpp"
+#include "sfl/detail/linear_fingerprints.hpp"
+#include "sfl/detail/linear_hash_index.hpp"
 #include "sfl/vector.hpp"
 
 #include "check.hpp"
@@ -24,9 +26,348 @@
 #include "partially_propagable_alloc.hpp"
 
 #include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <random>
 #include <vector>
 
+// Compares `find` with a plain linear search for all sizes up to 70.
+// Some keys repeat and some keys are missing.
+template <typename UnorderedAssociativeVector, typename KeyOfValue, typename MakeValue>
+void check_find_against_linear_search(MakeValue make_value)
+{
+    using key_of_value = KeyOfValue;
+
+    for (int n = 0; n <= 70; ++n)
+    {
+        UnorderedAssociativeVector vec;
+
+        for (int i = 0; i < n; ++i)
+        {
+            vec.ref_to_vector().emplace_back(make_value((i * 5) % 37));
+        }
+
+        const UnorderedAssociativeVector& cvec = vec;
+
+        for (int q = 0; q < 40; ++q)
+        {
+            const auto value = make_value(q);
+            const auto& key = key_of_value()(value);
+
+            const auto expected = std::distance
+            (
+                cvec.begin(),
+                std::find_if
+                (
+                    cvec.begin(),
+                    cvec.end(),
+                    [&](const typename UnorderedAssociativeVector::value_type& x) { return key_of_value()(x) == key; }
+                )
+            );
+
+            CHECK(std::distance(vec.begin(), vec.find(key)) == expected);
+            CHECK(std::distance(cvec.begin(), cvec.find(key)) == expected);
+        }
+    }
+}
+
+// Element whose assignment changes the key and then throws if the mapped
+// value of the source is negative. Exception leaves the target with a new
+// key, so fingerprint of the target must be repaired.
+struct throwing_assign_pair
+{
+    using first_type = int;
+
+    int first;
+    int second;
+
+    throwing_assign_pair(int f, int s)
+        : first(f)
+        , second(s)
+    {}
+
+    throwing_assign_pair(const throwing_assign_pair& other) = default;
+
+    throwing_assign_pair& operator=(const throwing_assign_pair& other)
+    {
+        first = other.first;
+
+        if (other.second < 0)
+        {
+            throw 1;
+        }
+
+        second = other.second;
+        return *this;
+    }
+};
+
+// Checks that elements are kept and lookup still works after an element
+// assignment throws in `assign_copy`, `assign_range_equal` and `erase`.
+template <typename UnorderedAssociativeVector>
+void check_repair_after_exception()
+{
+    using value_type = throwing_assign_pair;
+
+    auto make = [](int n, int negative)
+    {
+        UnorderedAssociativeVector vec;
+
+        for (int i = 0; i < n; ++i)
+        {
+            vec.emplace_equal(i, i == negative ? -1 : i);
+        }
+
+        return vec;
+    };
+
+    auto check_lookup = [](const UnorderedAssociativeVector& vec)
+    {
+        for (int k = -1; k < 50; ++k)
+        {
+            auto it = std::find_if(vec.begin(), vec.end(), [&](const value_type& x) { return x.first == k; });
+            CHECK(vec.find(k) == it);
+        }
+    };
+
+    // assign_copy
+    {
+        auto vec = make(20, -1);
+
+        UnorderedAssociativeVector other;
+        other.emplace_equal(40, 0);
+        other.emplace_equal(41, 0);
+        other.emplace_equal(42, -1);
+        other.emplace_equal(43, 0);
+
+        bool caught_exception = false;
+
+        try
+        {
+            vec.assign_copy(other);
+        }
+        catch (int)
+        {
+            caught_exception = true;
+        }
+
+        // Vector copies elements by construction instead of assignment if
+        // allocator propagates and storage is reallocated.
+        if (caught_exception)
+        {
+            CHECK(vec.empty() == false);
+            CHECK(vec.nth(2)->first == 42);
+        }
+
+        check_lookup(vec);
+    }
+
+    // assign_range_equal
+    {
+        auto vec = make(20, -1);
+
+        const std::vector<value_type> values{{30, 0}, {31, 0}, {32, -1}, {33, 0}};
+
+        bool caught_exception = false;
+
+        try
+        {
+            vec.assign_range_equal(values.begin(), values.end());
+        }
+        catch (int)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        CHECK(vec.size() == 20);
+        CHECK(vec.nth(2)->first == 32);
+        check_lookup(vec);
+    }
+
+    // erase(const_iterator), last element is moved into erased position
+    {
+        auto vec = make(20, 19);
+
+        bool caught_exception = false;
+
+        try
+        {
+            vec.erase(vec.nth(3));
+        }
+        catch (int)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        CHECK(vec.size() == 20);
+        CHECK(vec.nth(3)->first == 19);
+        check_lookup(vec);
+    }
+
+    // erase(const_iterator, const_iterator), tail is moved into erased range
+    {
+        auto vec = make(20, 18);
+
+        bool caught_exception = false;
+
+        try
+        {
+            vec.erase(vec.nth(2), vec.nth(4));
+        }
+        catch (int)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        CHECK(vec.size() == 20);
+        CHECK(vec.nth(2)->first == 18);
+        check_lookup(vec);
+    }
+}
+
+// Hash function that throws while `armed()` is true.
+struct throwing_hash
+{
+    static bool& armed()
+    {
+        static bool b = false;
+        return b;
+    }
+
+    std::size_t operator()(int x) const
+    {
+        if (armed())
+        {
+            throw 2;
+        }
+
+        return std::hash<int>()(x);
+    }
+};
+
+// Checks that elements are kept and lookup still works if fingerprints
+// cannot be recomputed after an exception, and that fingerprints become
+// valid again after `clear`.
+template <typename UnorderedAssociativeVector>
+void check_invalidate_after_exception()
+{
+    using value_type = throwing_assign_pair;
+
+    auto make = [](int n, int negative)
+    {
+        UnorderedAssociativeVector vec;
+
+        for (int i = 0; i < n; ++i)
+        {
+            vec.emplace_equal(i, i == negative ? -1 : i);
+        }
+
+        return vec;
+    };
+
+    auto check_lookup = [](const UnorderedAssociativeVector& vec)
+    {
+        for (int k = -1; k < 60; ++k)
+        {
+            auto it = std::find_if(vec.begin(), vec.end(), [&](const value_type& x) { return x.first == k; });
+            CHECK(vec.find(k) == it);
+        }
+    };
+
+    // assign_range_equal, hash function throws while fingerprints are repaired
+    {
+        auto vec = make(20, -1);
+
+        const std::vector<value_type> values{{30, 0}, {31, 0}};
+
+        bool caught_exception = false;
+
+        throwing_hash::armed() = true;
+
+        try
+        {
+            vec.assign_range_equal(values.begin(), values.end());
+        }
+        catch (int)
+        {
+            caught_exception = true;
+        }
+
+        throwing_hash::armed() = false;
+
+        CHECK(caught_exception == true);
+        CHECK(vec.ref_to_fingerprints().valid() == false);
+        CHECK(vec.size() == 20);
+        CHECK(vec.nth(0)->first == 30);
+        CHECK(vec.nth(1)->first == 1);
+        check_lookup(vec);
+
+        // Container can be modified while fingerprints are invalid
+        vec.emplace_equal(50, 0);
+        vec.emplace_equal(51, 0);
+        vec.erase(vec.nth(0));
+        vec.erase(vec.nth(3), vec.nth(6));
+        CHECK(vec.size() == 18);
+        CHECK(vec.ref_to_fingerprints().valid() == false);
+        check_lookup(vec);
+
+        vec.clear();
+        CHECK(vec.ref_to_fingerprints().valid() == true);
+
+        for (int i = 0; i < 20; ++i)
+        {
+            vec.emplace_equal(i, i);
+        }
+
+        check_lookup(vec);
+    }
+
+    // assign_copy, hash function throws while fingerprints are rebuilt
+    {
+        auto vec = make(20, -1);
+
+        UnorderedAssociativeVector other;
+        other.emplace_equal(40, 0);
+        other.emplace_equal(41, 0);
+        other.emplace_equal(42, -1);
+        other.emplace_equal(43, 0);
+
+        bool caught_exception = false;
+
+        throwing_hash::armed() = true;
+
+        try
+        {
+            vec.assign_copy(other);
+        }
+        catch (int)
+        {
+            caught_exception = true;
+        }
+
+        throwing_hash::armed() = false;
+
+        // Vector copies elements by construction instead of assignment if
+        // allocator propagates and storage is reallocated.
+        if (caught_exception)
+        {
+            CHECK(vec.ref_to_fingerprints().valid() == false);
+            CHECK(vec.empty() == false);
+            CHECK(vec.nth(2)->first == 42);
+        }
+        else
+        {
+            CHECK(vec.ref_to_fingerprints().valid() == true);
+            CHECK(vec.size() == 4);
+        }
+
+        check_lookup(vec);
+    }
+}
+
 template <>
 void test_unordered_associative_vector<1>()
 {
@@ -1,8 +1,10 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/unordered_map.hpp"
+#include "sfl/unordered_multimap.hpp"
 
 #include "check.hpp"
+#include "counting_hash.hpp"
 #include "count_kv.hpp"
 #include "istream_view.hpp"
 #include "nth.hpp"
@@ -17,6 +19,7 @@
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <iterator>
 #include <sstream>
 #include <vector>
 
@@ -55,6 +58,179 @@ void test_unordered_map_5()
     #include "unordered_map.inc"
 }
 
+void test_unordered_map_store_hash()
+{
+    PRINT("Test StoreHash");
+    {
+        using hash = sfl::test::counting_hash<int>;
+
+        using map_type = sfl::unordered_map<int, int, hash, std::equal_to<int>, std::allocator<std::pair<const int, int>>, true>;
+
+        map_type map;
+
+        hash::num_calls() = 0;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            map.insert({i, 10 * i});
+        }
+
+        CHECK(map.size() == 1000);
+
+        // Rehashing must reuse hashes stored in nodes.
+        {
+            const std::size_t calls = hash::num_calls();
+            map.rehash(4 * map.bucket_count());
+            CHECK(hash::num_calls() == calls);
+        }
+
+        // Copying must reuse hashes stored in nodes.
+        {
+            const std::size_t calls = hash::num_calls();
+            map_type map2(map);
+            CHECK(hash::num_calls() == calls);
+            CHECK(map2 == map);
+        }
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            CHECK(map.find(i) != map.end());
+            CHECK(map.find(i)->second % 10 == 0);
+        }
+
+        CHECK(map.find(1000) == map.end());
+
+        for (int i = 0; i < 1000; i += 2)
+        {
+            map.erase(i);
+        }
+
+        CHECK(map.size() == 1000 / 2);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            CHECK(map.contains(i) == (i % 2 == 1));
+        }
+    }
+}
+
+void test_unordered_map_incremental_rehash()
+{
+    PRINT("Test IncrementalRehash");
+    {
+        using map_type = sfl::unordered_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<const int, int>>, false, true>;
+
+        map_type map;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            CHECK(map.insert({i, 10 * i}).second == true);
+
+            CHECK(map.load_factor() <= map.max_load_factor());
+
+            // Elements must be reachable while rehashing is in progress.
+            for (int j = 0; j <= i; j += 97)
+            {
+                CHECK(map.find(j) != map.end());
+                CHECK(map.find(j)->second == 10 * j);
+            }
+        }
+
+        CHECK(map.size() == 1000);
+        CHECK(std::distance(map.begin(), map.end()) == 1000);
+
+        for (auto it = map.begin(); it != map.end(); )
+        {
+            if (it->first % 2 == 0)
+            {
+                it = map.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        CHECK(map.size() == 1000 / 2);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            CHECK(map.contains(i) == (i % 2 == 1));
+        }
+
+        map_type map2(map);
+
+        CHECK(map2 == map);
+
+        map.rehash(0);
+
+        CHECK(map2 == map);
+    }
+
+    PRINT("Test IncrementalRehash bucket interface");
+    {
+        using map_type = sfl::unordered_map<int, int, std::hash<int>, std::equal_to<int>, std::allocator<std::pair<const int, int>>, false, true>;
+
+        map_type map;
+
+        // Stop shortly after the table has grown, so that rehashing is still
+        // in progress when the bucket interface is used.
+        for (int i = 0; i < 1030; ++i)
+        {
+            map.insert({i, 10 * i});
+        }
+
+        int sum = 0;
+        std::size_t count = 0;
+
+        for (std::size_t i = 0; i < map.bucket_count(); ++i)
+        {
+            count += map.bucket_size(i);
+
+            for (auto it = map.begin(i); it != map.end(i); ++it)
+            {
+                CHECK(map.bucket(it->first) == i);
+                sum += it->first;
+            }
+        }
+
+        CHECK(count == 1030);
+        CHECK(sum == 1029 * 1030 / 2);
+    }
+}
+
+void test_unordered_map_find_batch()
+{
+    PRINT("Test find_batch and contains_batch");
+    {
+        sfl::unordered_map<int, int> map;
+
+        for (int i = 0; i < 1000; i += 3)
+        {
+            map.emplace(i, 10 * i);
+        }
+
+        std::vector<int> keys;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            keys.push_back(i);
+        }
+
+        std::vector<sfl::unordered_map<int, int>::iterator> iterators(keys.size());
+        std::vector<bool> flags(keys.size());
+
+        CHECK(map.find_batch(keys.begin(), keys.end(), iterators.begin()) == iterators.end());
+        CHECK(map.contains_batch(keys.begin(), keys.end(), flags.begin()) == flags.end());
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            CHECK(iterators[i] == map.find(i));
+            CHECK(flags[i] == (i % 3 == 0));
+        }
+    }
+}
+
 int main()
 {
     test_unordered_map_1();
@@ -62,4 +238,7 @@ int main()
     test_unordered_map_3();
     test_unordered_map_4();
     test_unordered_map_5();
+    test_unordered_map_store_hash();
+    test_unordered_map_incremental_rehash();
+    test_unordered_map_find_batch();
 }
@@ -1,8 +1,10 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/unordered_multimap.hpp"
+#include "sfl/unordered_map.hpp"
 
 #include "check.hpp"
+#include "counting_hash.hpp"
 #include "count_kv.hpp"
 #include "istream_view.hpp"
 #include "nth.hpp"
@@ -55,6 +57,63 @@ void test_unordered_multimap_5()
     #include "unordered_multimap.inc"
 }
 
+void test_unordered_multimap_store_hash()
+{
+    PRINT("Test StoreHash");
+    {
+        using hash = sfl::test::counting_hash<int>;
+
+        using map_type = sfl::unordered_multimap<int, int, hash, std::equal_to<int>, std::allocator<std::pair<const int, int>>, true>;
+
+        map_type map;
+
+        hash::num_calls() = 0;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            map.insert({i, 10 * i});
+            map.insert({i, 20 * i});
+        }
+
+        CHECK(map.size() == 2000);
+
+        // Rehashing must reuse hashes stored in nodes.
+        {
+            const std::size_t calls = hash::num_calls();
+            map.rehash(4 * map.bucket_count());
+            CHECK(hash::num_calls() == calls);
+        }
+
+        // Copying must reuse hashes stored in nodes.
+        {
+            const std::size_t calls = hash::num_calls();
+            map_type map2(map);
+            CHECK(hash::num_calls() == calls);
+            CHECK(map2 == map);
+        }
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            CHECK(map.find(i) != map.end());
+            CHECK(map.find(i)->second % 10 == 0);
+        }
+
+        CHECK(map.find(1000) == map.end());
+
+        for (int i = 0; i < 1000; i += 2)
+        {
+            map.erase(i);
+        }
+
+        CHECK(map.size() == 2000 / 2);
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            CHECK(map.contains(i) == (i % 2 == 1));
+        }
+    }
+}
+
 int main()
 {
     test_unordered_multimap_1();
@@ -62,4 +121,5 @@ int main()
     test_unordered_multimap_3();
     test_unordered_multimap_4();
     test_unordered_multimap_5();
+    test_unordered_multimap_store_hash();
 }
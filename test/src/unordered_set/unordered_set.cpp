@@ -1,6 +1,7 @@
 #undef NDEBUG // This is very important. Must be in the first line.
 
 #include "sfl/unordered_set.hpp"
+#include "sfl/unordered_multiset.hpp"
 
 #include "check.hpp"
 #include "count_kv.hpp"
@@ -9,12 +9,17 @@
 
 #include "xint.hpp"
 
+#include "at_least_alloc.hpp"
+#include "counting_alloc.hpp"
 #include "statefull_alloc.hpp"
 #include "stateless_alloc.hpp"
 #include "stateless_alloc_no_prop.hpp"
 #include "stateless_fancy_alloc.hpp"
 
+#include <cstring>
+#include <memory>
 #include <sstream>
+#include <string>
 #include <vector>
 
 void test_vector_1()
@@ -52,6 +57,275 @@ void test_vector_5()
     #include "vector.inc"
 }
 
+void test_vector_trivially_relocatable()
+{
+    using sfl::test::xint;
+
+    static_assert(sfl::is_trivially_relocatable<std::unique_ptr<xint>>::value, "");
+
+    PRINT("Test relocation of std::unique_ptr");
+    {
+        sfl::vector<std::unique_ptr<xint>> vec;
+
+        for (int i = 0; i < 10; ++i)
+        {
+            vec.emplace_back(new xint(10 * (i + 1)));
+        }
+
+        CHECK(vec.size() == 10);
+        CHECK(vec.capacity() == 13);
+
+        // Insert with reallocation
+        vec.shrink_to_fit();
+        vec.emplace(vec.nth(1), new xint(15));
+
+        // Insert without reallocation
+        vec.emplace(vec.nth(3), new xint(25));
+        vec.insert(vec.nth(0), std::unique_ptr<xint>(new xint(5)));
+
+        CHECK(vec.size() == 13);
+        CHECK(*vec[0] == 5);
+        CHECK(*vec[1] == 10);
+        CHECK(*vec[2] == 15);
+        CHECK(*vec[3] == 20);
+        CHECK(*vec[4] == 25);
+        CHECK(*vec[5] == 30);
+        CHECK(*vec[12] == 100);
+
+        vec.erase(vec.nth(0));
+        vec.erase(vec.nth(1), vec.nth(4));
+
+        CHECK(vec.size() == 9);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[1] == 30);
+        CHECK(*vec[2] == 40);
+        CHECK(*vec[8] == 100);
+
+        vec.reserve(100);
+        vec.resize(12);
+
+        CHECK(vec.size() == 12);
+        CHECK(vec.capacity() == 100);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[8] == 100);
+        CHECK(vec[9] == nullptr);
+        CHECK(vec[11] == nullptr);
+
+        vec.shrink_to_fit();
+
+        CHECK(vec.size() == 12);
+        CHECK(vec.capacity() == 12);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[8] == 100);
+
+        std::unique_ptr<xint> arr[2] = {std::unique_ptr<xint>(new xint(1)), std::unique_ptr<xint>(new xint(2))};
+
+        vec.insert(vec.nth(1), std::make_move_iterator(arr), std::make_move_iterator(arr + 2));
+
+        CHECK(vec.size() == 14);
+        CHECK(*vec[0] == 10);
+        CHECK(*vec[1] == 1);
+        CHECK(*vec[2] == 2);
+        CHECK(*vec[3] == 30);
+        CHECK(*vec[10] == 100);
+    }
+}
+
+void test_vector_growth_policy()
+{
+    PRINT("Test GrowthPolicy");
+    {
+        sfl::vector<int, std::allocator<int>, sfl::growth_factor_2> vec;
+
+        vec.push_back(1);
+        CHECK(vec.capacity() == 1);
+
+        vec.push_back(2);
+        CHECK(vec.capacity() == 2);
+
+        vec.push_back(3);
+        CHECK(vec.capacity() == 4);
+
+        vec.push_back(4);
+        vec.push_back(5);
+        CHECK(vec.capacity() == 8);
+
+        vec.insert(vec.begin(), 10, 0);
+        CHECK(vec.size() == 15);
+        CHECK(vec.capacity() == 16);
+    }
+
+    PRINT("Test GrowthPolicy (page rounded)");
+    {
+        sfl::vector<int, std::allocator<int>, sfl::page_rounded_growth_4k> vec;
+
+        vec.reserve(1000);
+        vec.resize(1000);
+        CHECK(vec.capacity() == 1000);
+
+        vec.push_back(1);
+        CHECK(vec.capacity() == 2048);
+    }
+}
+
+void test_vector_allocate_at_least()
+{
+    using sfl::test::xint;
+
+    PRINT("Test allocate_at_least");
+    {
+        using alloc_type = sfl::test::at_least_alloc<xint>;
+
+        sfl::vector<xint, alloc_type> vec(3);
+        CHECK(vec.size() == 3);
+        CHECK(vec.capacity() == 8);
+
+        for (int i = 0; i < 5; ++i)
+        {
+            vec.emplace_back(i);
+        }
+        CHECK(vec.size() == 8);
+        CHECK(vec.capacity() == 8);
+
+        vec.emplace_back(5);
+        CHECK(vec.size() == 9);
+        CHECK(vec.capacity() == 16);
+
+        vec.reserve(20);
+        CHECK(vec.capacity() == 24);
+
+        vec.insert(vec.begin(), 20, xint(-1));
+        CHECK(vec.size() == 29);
+        CHECK(vec.capacity() == 40);
+
+        vec.shrink_to_fit();
+        CHECK(vec.capacity() == 32);
+
+        sfl::vector<xint, alloc_type> vec2(vec);
+        CHECK(vec2.size() == 29);
+        CHECK(vec2.capacity() == 32);
+        CHECK(vec2 == vec);
+    }
+}
+
+void test_vector_resize_and_overwrite()
+{
+    using sfl::test::xint;
+
+    PRINT("Test resize(size_type, sfl::default_init_t)");
+    {
+        sfl::vector<xint> vec;
+
+        vec.resize(4, sfl::default_init_t());
+        CHECK(vec.size() == 4);
+        CHECK(*vec.nth(0) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(1) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(2) == SFL_TEST_XINT_DEFAULT_VALUE);
+        CHECK(*vec.nth(3) == SFL_TEST_XINT_DEFAULT_VALUE);
+
+        vec.resize(20, sfl::default_init_t());
+        CHECK(vec.size() == 20);
+        CHECK(*vec.nth(19) == SFL_TEST_XINT_DEFAULT_VALUE);
+
+        vec.resize(2, sfl::default_init_t());
+        CHECK(vec.size() == 2);
+    }
+
+    PRINT("Test resize(size_type, sfl::default_init_t) with Allocator::construct");
+    {
+        using alloc_type = sfl::test::counting_alloc<xint>;
+
+        alloc_type::num_constructed() = 0;
+        alloc_type::num_destroyed() = 0;
+
+        {
+            sfl::vector<xint, alloc_type> vec;
+
+            vec.resize(4, sfl::default_init_t());
+            CHECK(vec.size() == 4);
+            CHECK(alloc_type::num_constructed() == 4);
+
+            vec.resize(20, sfl::default_init_t());
+            CHECK(vec.size() == 20);
+
+            vec.resize(2, sfl::default_init_t());
+            CHECK(vec.size() == 2);
+        }
+
+        // Every element destroyed through the allocator was also
+        // constructed through it.
+        CHECK(alloc_type::num_constructed() == alloc_type::num_destroyed());
+    }
+
+    PRINT("Test append_uninitialized(size_type)");
+    {
+        sfl::vector<char> vec;
+
+        vec.push_back('a');
+
+        char* p = vec.append_uninitialized(3);
+        CHECK(vec.size() == 4);
+        CHECK(p == vec.data() + 1);
+
+        std::memcpy(p, "bcd", 3);
+
+        p = vec.append_uninitialized(30);
+        CHECK(vec.size() == 34);
+        CHECK(p == vec.data() + 4);
+
+        std::memset(p, 'e', 30);
+
+        CHECK(std::string(vec.begin(), vec.end()) == "abcd" + std::string(30, 'e'));
+    }
+
+    PRINT("Test resize_and_overwrite(size_type, Operation)");
+    {
+        sfl::vector<char> vec(2, 'x');
+
+        vec.resize_and_overwrite(10, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 10);
+            CHECK(p[0] == 'x');
+            CHECK(p[1] == 'x');
+            std::memcpy(p + 2, "abc", 3);
+            return 5;
+        });
+
+        CHECK(vec.size() == 5);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxabc");
+
+        vec.resize_and_overwrite(3, [](char* p, std::size_t n) -> std::size_t
+        {
+            CHECK(n == 3);
+            p[2] = 'z';
+            return n;
+        });
+
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+
+        #if !defined(SFL_NO_EXCEPTIONS)
+        bool caught_exception = false;
+
+        try
+        {
+            vec.resize_and_overwrite(8, [](char*, std::size_t) -> std::size_t
+            {
+                throw 1;
+            });
+        }
+        catch (...)
+        {
+            caught_exception = true;
+        }
+
+        CHECK(caught_exception == true);
+        CHECK(vec.size() == 3);
+        CHECK(std::string(vec.begin(), vec.end()) == "xxz");
+        #endif
+    }
+}
+
 int main()
 {
     test_vector_1();
@@ -59,4 +333,8 @@ int main()
     test_vector_3();
     test_vector_4();
     test_vector_5();
+    test_vector_trivially_relocatable();
+    test_vector_growth_policy();
+    test_vector_allocate_at_least();
+    test_vector_resize_and_overwrite();
 }